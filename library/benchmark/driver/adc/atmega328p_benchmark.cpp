@@ -0,0 +1,105 @@
+/**
+ * @brief Benchmarks for the Atmega328p ADC.
+ */
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+#include "arch/avr/hw_platform.h"
+#include "driver/adc/atmega328p.h"
+#include "utils/utils.h"
+
+#ifdef TESTSUITE
+
+namespace driver
+{
+namespace adc
+{
+/** ADC conversion-complete interrupt service routine. */
+void ADC_vect() noexcept;
+} // namespace adc
+
+namespace
+{
+// -----------------------------------------------------------------------------
+adc::Interface& setupAdc() noexcept
+{
+    // Set the ADC interrupt flag so that we don't get stuck in the read loop.
+    utils::set(ADCSRA, ADIF);
+    return adc::Atmega328p::getInstance();
+}
+
+/**
+ * @brief Benchmark of blocking reads.
+ * 
+ *        Each read reconfigures the ADC and polls the interrupt flag, which is set in advance
+ *        on the host platform. On the MCU, each read additionally blocks for 104 us.
+ */
+void Adc_Atmega328p_BlockingRead(benchmark::State& state)
+{
+    adc::Interface& adc{setupAdc()};
+    adc.stopSampling();
+
+    for (auto _ : state)
+    {
+        utils::set(ADCSRA, ADIF);
+        benchmark::DoNotOptimize(adc.read(adc::Atmega328p::Pin::A0));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(Adc_Atmega328p_BlockingRead);
+
+/**
+ * @brief Benchmark of continuous sampling.
+ * 
+ *        Each iteration runs the conversion-complete interrupt service routine and consumes 
+ *        the stored sample, which is the CPU cost per sample in continuous sampling mode.
+ */
+void Adc_Atmega328p_Sampling(benchmark::State& state)
+{
+    adc::Interface& adc{setupAdc()};
+    adc.startSampling(adc::Atmega328p::Pin::A0);
+    std::uint16_t sample{};
+
+    for (auto _ : state)
+    {
+        ADC = static_cast<std::uint16_t>(state.iterations() & 0x3FFU);
+        adc::ADC_vect();
+        adc.readSample(sample);
+        benchmark::DoNotOptimize(sample);
+    }
+    adc.stopSampling();
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(Adc_Atmega328p_Sampling);
+
+/**
+ * @brief Benchmark of continuous sampling with oversampling.
+ * 
+ *        Each iteration runs the conversion-complete interrupt service routine, which 
+ *        accumulates the conversion, and consumes a sample whenever 4^n conversions have been 
+ *        accumulated. The number of extra bits n is passed as the benchmark argument.
+ */
+void Adc_Atmega328p_Oversampling(benchmark::State& state)
+{
+    adc::Interface& adc{setupAdc()};
+    adc.setOversampling(static_cast<std::uint8_t>(state.range(0)));
+    adc.startSampling(adc::Atmega328p::Pin::A0);
+    std::uint16_t sample{};
+
+    for (auto _ : state)
+    {
+        ADC = static_cast<std::uint16_t>(state.iterations() & 0x3FFU);
+        adc::ADC_vect();
+        adc.readSample(sample);
+        benchmark::DoNotOptimize(sample);
+    }
+    adc.stopSampling();
+    adc.setOversampling(0U);
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(Adc_Atmega328p_Oversampling)->DenseRange(0, adc::Atmega328p::MaxOversampling);
+} // namespace
+} // namespace driver
+
+#endif /** TESTSUITE */
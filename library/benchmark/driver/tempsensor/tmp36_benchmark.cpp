@@ -0,0 +1,78 @@
+/**
+ * @brief Benchmarks for the TMP36 temp sensor.
+ */
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+#include "arch/avr/hw_platform.h"
+#include "driver/adc/atmega328p.h"
+#include "driver/tempsensor/tmp36.h"
+#include "utils/utils.h"
+
+#ifdef TESTSUITE
+
+namespace driver
+{
+namespace
+{
+/** Temp sensor pin. */
+constexpr std::uint8_t Pin{adc::Atmega328p::Pin::A2};
+
+// -----------------------------------------------------------------------------
+adc::Interface& setupAdc() noexcept
+{
+    // Set the ADC interrupt flag so that reads don't get stuck in the read loop.
+    utils::set(ADCSRA, ADIF);
+    return adc::Atmega328p::getInstance();
+}
+
+// -----------------------------------------------------------------------------
+std::int16_t readFloat(const adc::Interface& adc) noexcept
+{
+    // Read implementation used before the integer ADC API was added.
+    if (!adc.isChannelValid(Pin) || !adc.isInitialized()) { return 0; }
+    return utils::round<std::int16_t>(100.0 * adc.inputVoltage(Pin) - 50.0);
+}
+
+/**
+ * @brief Benchmark of temperature reads with floating-point conversion (reference).
+ * 
+ *        Each iteration reads the input voltage in Volts and converts it to temperature in 
+ *        double precision, which is emulated in software on the MCU.
+ */
+void TempSensor_Tmp36_ReadFloat(benchmark::State& state)
+{
+    const adc::Interface& adc{setupAdc()};
+
+    for (auto _ : state)
+    {
+        ADC = static_cast<std::uint16_t>(state.iterations() & 0x3FFU);
+        benchmark::DoNotOptimize(readFloat(adc));
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(TempSensor_Tmp36_ReadFloat);
+
+/**
+ * @brief Benchmark of temperature reads via the lookup table.
+ * 
+ *        Each iteration reads the temperature via Tmp36::read, which looks up the temperature 
+ *        of the ADC value in a table stored in program memory.
+ */
+void TempSensor_Tmp36_Read(benchmark::State& state)
+{
+    tempsensor::Tmp36 tempSensor{Pin, setupAdc()};
+
+    for (auto _ : state)
+    {
+        ADC = static_cast<std::uint16_t>(state.iterations() & 0x3FFU);
+        benchmark::DoNotOptimize(tempSensor.read());
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(TempSensor_Tmp36_Read);
+} // namespace
+} // namespace driver
+
+#endif /** TESTSUITE */
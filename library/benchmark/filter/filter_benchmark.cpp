@@ -0,0 +1,54 @@
+/**
+ * @brief Benchmarks for the streaming filters.
+ */
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+#include "filter/chain.h"
+#include "filter/ema.h"
+#include "filter/median.h"
+#include "filter/moving_average.h"
+
+#ifdef TESTSUITE
+
+namespace filter
+{
+namespace
+{
+// -----------------------------------------------------------------------------
+std::int16_t nextSample(std::uint16_t& seed) noexcept
+{
+    // Generate noisy temperatures around 22 degrees Celsius.
+    seed = static_cast<std::uint16_t>(seed * 25173U + 13849U);
+    return static_cast<std::int16_t>(22 + static_cast<std::int16_t>(seed >> 12U) - 8);
+}
+
+/**
+ * @brief Benchmark of the per-sample cost of given filter.
+ * 
+ *        Each iteration generates a pseudo-random sample and passes it through the filter.
+ * 
+ * @tparam Filter The filter to benchmark.
+ */
+template <typename Filter>
+void Filter_Update(benchmark::State& state)
+{
+    Filter filter{};
+    std::uint16_t seed{0xACE1U};
+
+    for (auto _ : state) { benchmark::DoNotOptimize(filter.update(nextSample(seed))); }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK_TEMPLATE(Filter_Update, Chain<>);
+BENCHMARK_TEMPLATE(Filter_Update, MovingAverage<std::int16_t, 4U>);
+BENCHMARK_TEMPLATE(Filter_Update, MovingAverage<std::int16_t, 64U>);
+BENCHMARK_TEMPLATE(Filter_Update, Median<std::int16_t, 3U>);
+BENCHMARK_TEMPLATE(Filter_Update, Median<std::int16_t, 15U>);
+BENCHMARK_TEMPLATE(Filter_Update, Ema<std::int16_t, 3U>);
+BENCHMARK_TEMPLATE(Filter_Update, Chain<Median<std::int16_t, 5U>, 
+                                        MovingAverage<std::int16_t, 8U>, Ema<std::int16_t, 2U>>);
+} // namespace
+} // namespace filter
+
+#endif /** TESTSUITE */
@@ -0,0 +1,114 @@
+/**
+ * @brief Benchmarks for batch prediction.
+ */
+#include <cstddef>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "ml/lin_reg/fixed.h"
+#include "ml/lin_reg/interface.h"
+#include "ml/poly_reg/fixed.h"
+
+#ifdef TESTSUITE
+
+namespace ml
+{
+namespace
+{
+/** The number of samples per batch, for instance a logged dataset replayed on the host. */
+constexpr std::size_t SampleCount{1000000U};
+
+// -----------------------------------------------------------------------------
+std::vector<double> createSamples() noexcept
+{
+    // Create input voltages of the temperature sensor between 0.0 V and 1.5 V.
+    std::vector<double> samples(SampleCount);
+    for (std::size_t i{}; i < SampleCount; ++i)
+    {
+        samples[i] = 1.5 * static_cast<double>(i) / static_cast<double>(SampleCount);
+    }
+    return samples;
+}
+
+// -----------------------------------------------------------------------------
+void predictEach(benchmark::State& state, const lin_reg::Interface& model)
+{
+    const std::vector<double> inputs{createSamples()};
+    std::vector<double> outputs(SampleCount);
+
+    for (auto _ : state)
+    {
+        for (std::size_t i{}; i < SampleCount; ++i) { outputs[i] = model.predict(inputs[i]); }
+        benchmark::DoNotOptimize(outputs.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * SampleCount);
+}
+
+// -----------------------------------------------------------------------------
+void predictBatch(benchmark::State& state, const lin_reg::Interface& model)
+{
+    const std::vector<double> inputs{createSamples()};
+    std::vector<double> outputs(SampleCount);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(model.predictBatch(inputs.data(), outputs.data(), SampleCount));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * SampleCount);
+}
+
+/**
+ * @brief Benchmark of predicting one sample at a time with the linear model (reference).
+ *
+ *        Each iteration calls the virtual predict() method once per sample, as done by
+ *        callers holding an Interface reference.
+ */
+void Batch_LinRegPredict(benchmark::State& state)
+{
+    const lin_reg::Fixed model{lin_reg::Parameters{100.0, -50.0, true}};
+    predictEach(state, model);
+}
+BENCHMARK(Batch_LinRegPredict)->Unit(benchmark::kMillisecond);
+
+/**
+ * @brief Benchmark of predicting all samples at once with the linear model.
+ *
+ *        Each iteration performs a single virtual call, after which the samples are processed
+ *        with SIMD vector operations. Compare with Batch_LinRegPredict.
+ */
+void Batch_LinRegPredictBatch(benchmark::State& state)
+{
+    const lin_reg::Fixed model{lin_reg::Parameters{100.0, -50.0, true}};
+    predictBatch(state, model);
+}
+BENCHMARK(Batch_LinRegPredictBatch)->Unit(benchmark::kMillisecond);
+
+/**
+ * @brief Benchmark of predicting one sample at a time with the cubic model (reference).
+ */
+void Batch_PolyRegPredict(benchmark::State& state)
+{
+    const poly_reg::Fixed<3U> model{{-50.0, 120.0, -30.0, 10.0}};
+    predictEach(state, model);
+}
+BENCHMARK(Batch_PolyRegPredict)->Unit(benchmark::kMillisecond);
+
+/**
+ * @brief Benchmark of predicting all samples at once with the cubic model.
+ *
+ *        Each iteration runs Horner's method on vectors of samples. Compare with
+ *        Batch_PolyRegPredict.
+ */
+void Batch_PolyRegPredictBatch(benchmark::State& state)
+{
+    const poly_reg::Fixed<3U> model{{-50.0, 120.0, -30.0, 10.0}};
+    predictBatch(state, model);
+}
+BENCHMARK(Batch_PolyRegPredictBatch)->Unit(benchmark::kMillisecond);
+} // namespace
+} // namespace ml
+
+#endif /** TESTSUITE */
@@ -0,0 +1,120 @@
+/**
+ * @brief Benchmarks for the fixed linear regression model.
+ */
+#include <cstddef>
+
+#include <benchmark/benchmark.h>
+
+#include "driver/eeprom/stub.h"
+#include "ml/lin_reg/fixed.h"
+#include "ml/lin_reg/storage.h"
+#include "ml/types.h"
+
+#ifdef TESTSUITE
+
+namespace ml
+{
+namespace
+{
+/** Training data input values, the input voltage of the temperature sensor in Volts. */
+const Matrix1d TrainIn{0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 
+                       0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5};
+
+/** Training data output values, the temperature T = 100 * Uin - 50 in degrees Celsius. */
+const Matrix2d TrainOut{-50.0, -40.0, -30.0, -20.0, -10.0, 0.0, 10.0, 20.0, 
+                        30.0, 40.0, 50.0, 60.0, 70.0, 80.0, 90.0, 100.0};
+
+// -----------------------------------------------------------------------------
+double meanSquaredError(const lin_reg::Fixed& model) noexcept
+{
+    double sum{};
+    for (std::size_t i{}; i < TrainIn.size(); ++i)
+    {
+        const double error{TrainOut[i] - model.predict(TrainIn[i])};
+        sum += error * error;
+    }
+    return sum / TrainIn.size();
+}
+
+/**
+ * @brief Benchmark of gradient descent training (reference).
+ * 
+ *        Each iteration trains the model with the given number of epochs and a learning 
+ *        rate of 0.01, as done at boot in main.cpp with 100 epochs. The mean squared error 
+ *        of the trained model is reported as a counter.
+ */
+void LinRegFixed_Train(benchmark::State& state)
+{
+    lin_reg::Fixed model{};
+    const std::size_t epochCount{static_cast<std::size_t>(state.range(0))};
+
+    for (auto _ : state) { benchmark::DoNotOptimize(model.train(TrainIn, TrainOut, epochCount)); }
+    state.counters["mse"] = meanSquaredError(model);
+}
+BENCHMARK(LinRegFixed_Train)->Arg(10)->Arg(100)->Arg(1000);
+
+/**
+ * @brief Benchmark of gradient descent training with early stopping.
+ * 
+ *        Each iteration trains the model with at most 1000 epochs, stopping once the mean 
+ *        squared error changes less than the given threshold (in millionths) between two 
+ *        epochs. The number of epochs performed and the mean squared error are reported as 
+ *        counters, compare with LinRegFixed_Train for the same number of epochs.
+ */
+void LinRegFixed_TrainEarlyStopping(benchmark::State& state)
+{
+    lin_reg::Fixed model{};
+    Matrix1d trainIn{TrainIn};
+    Matrix2d trainOut{TrainOut};
+    lin_reg::TrainingOptions options{};
+    options.epochCount   = 1000U;
+    options.minLossDelta = static_cast<double>(state.range(0)) * 1e-6;
+    lin_reg::TrainingReport report{};
+
+    for (auto _ : state) 
+    { 
+        report = model.train(trainIn, trainOut, options);
+        benchmark::DoNotOptimize(report);
+    }
+    state.counters["epochs"] = static_cast<double>(report.epochCount);
+    state.counters["mse"]    = meanSquaredError(model);
+}
+BENCHMARK(LinRegFixed_TrainEarlyStopping)->Arg(1)->Arg(1000);
+
+/**
+ * @brief Benchmark of closed-form least squares training.
+ * 
+ *        Each iteration trains the model in a single pass over the training data. The mean 
+ *        squared error of the trained model is reported as a counter.
+ */
+void LinRegFixed_TrainLeastSquares(benchmark::State& state)
+{
+    lin_reg::Fixed model{};
+
+    for (auto _ : state) { benchmark::DoNotOptimize(model.trainLeastSquares(TrainIn, TrainOut)); }
+    state.counters["mse"] = meanSquaredError(model);
+}
+BENCHMARK(LinRegFixed_TrainLeastSquares);
+
+/**
+ * @brief Benchmark of loading a stored model from EEPROM.
+ * 
+ *        Each iteration loads and verifies the model stored at boot, which replaces training
+ *        whenever a valid model is stored. The EEPROM is emulated in RAM on the host, 
+ *        on the MCU each byte read takes four additional clock cycles.
+ */
+void LinRegFixed_Load(benchmark::State& state)
+{
+    driver::eeprom::Stub<64U> eeprom{};
+    lin_reg::Fixed model{};
+    model.trainLeastSquares(TrainIn, TrainOut);
+    lin_reg::storage::save(model, eeprom, 0U);
+
+    for (auto _ : state) { benchmark::DoNotOptimize(lin_reg::storage::load(model, eeprom, 0U)); }
+    state.counters["mse"] = meanSquaredError(model);
+}
+BENCHMARK(LinRegFixed_Load);
+} // namespace
+} // namespace ml
+
+#endif /** TESTSUITE */
@@ -0,0 +1,76 @@
+/**
+ * @brief Benchmarks for the piecewise linear regression model.
+ */
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+#include "ml/lin_reg/piecewise.h"
+#include "utils/utils.h"
+
+#ifdef TESTSUITE
+
+namespace ml
+{
+namespace
+{
+/** Max value of a 10-bit ADC. */
+constexpr std::uint16_t AdcMax{1023U};
+
+/** ADC supply voltage in Volts. */
+constexpr double SupplyVoltage{5.0};
+
+/** Knots of the temperature model in Volts. */
+constexpr double Knots[]{0.0, 0.5, 1.0, 1.5, 2.0, 2.5, 3.0, 3.5, 5.0};
+
+/** Temperatures at the knots in degrees Celsius. */
+constexpr double Temperatures[]{-40.0, -22.0, -8.0, 3.0, 13.0, 22.0, 32.0, 43.0, 90.0};
+
+/**
+ * @brief Benchmark of floating-point piecewise linear prediction (reference).
+ * 
+ *        Each iteration converts an ADC value to the input voltage and predicts the 
+ *        temperature with an eight-segment floating-point model.
+ */
+void LinRegPiecewise_PredictFloat(benchmark::State& state)
+{
+    const lin_reg::Piecewise<8U> model{Knots, Temperatures};
+    std::uint16_t adcValue{};
+
+    for (auto _ : state)
+    {
+        const double inputVoltage{adcValue / static_cast<double>(AdcMax) * SupplyVoltage};
+        benchmark::DoNotOptimize(utils::round<std::int16_t>(model.predict(inputVoltage)));
+        adcValue = AdcMax > adcValue ? adcValue + 1U : 0U;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(LinRegPiecewise_PredictFloat);
+
+/**
+ * @brief Benchmark of quantized piecewise linear prediction.
+ * 
+ *        Each iteration predicts the temperature directly from an ADC value with an 
+ *        eight-segment Q16 model. The max quantization error is reported as a counter.
+ */
+void LinRegPiecewise_PredictQuantized(benchmark::State& state)
+{
+    const lin_reg::Piecewise<8U> model{Knots, Temperatures};
+    lin_reg::QuantizedPiecewise<8U> quantized{};
+    double maxError{};
+    quantized.quantize(model, AdcMax, SupplyVoltage, maxError);
+    std::uint16_t adcValue{};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(quantized.predict(adcValue));
+        adcValue = AdcMax > adcValue ? adcValue + 1U : 0U;
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["max_error"] = maxError;
+}
+BENCHMARK(LinRegPiecewise_PredictQuantized);
+} // namespace
+} // namespace ml
+
+#endif /** TESTSUITE */
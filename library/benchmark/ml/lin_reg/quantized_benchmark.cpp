@@ -0,0 +1,75 @@
+/**
+ * @brief Benchmarks for the quantized linear regression model.
+ */
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+#include "ml/lin_reg/fixed.h"
+#include "ml/lin_reg/quantized.h"
+#include "utils/utils.h"
+
+#ifdef TESTSUITE
+
+namespace ml
+{
+namespace
+{
+/** Max value of a 10-bit ADC. */
+constexpr std::uint16_t AdcMax{1023U};
+
+/** ADC supply voltage in Volts. */
+constexpr double SupplyVoltage{5.0};
+
+/** Temperature model parameters, T = 100 * Uin - 50. */
+constexpr lin_reg::Parameters TempModel{100.0, -50.0, true};
+
+/**
+ * @brief Benchmark of floating-point prediction (reference).
+ * 
+ *        Each iteration converts an ADC value to the input voltage and predicts the 
+ *        temperature with the floating-point model, as done by the smart temperature sensor 
+ *        with a floating-point model.
+ */
+void LinReg_PredictFloat(benchmark::State& state)
+{
+    const lin_reg::Fixed model{TempModel};
+    std::uint16_t adcValue{};
+
+    for (auto _ : state)
+    {
+        const double inputVoltage{adcValue / static_cast<double>(AdcMax) * SupplyVoltage};
+        benchmark::DoNotOptimize(utils::round<std::int16_t>(model.predict(inputVoltage)));
+        adcValue = AdcMax > adcValue ? adcValue + 1U : 0U;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(LinReg_PredictFloat);
+
+/**
+ * @brief Benchmark of quantized prediction.
+ * 
+ *        Each iteration predicts the temperature directly from an ADC value with a Q16 model.
+ *        The max quantization error is reported as a counter.
+ */
+void LinReg_PredictQuantized(benchmark::State& state)
+{
+    const lin_reg::Fixed model{TempModel};
+    lin_reg::Quantized<> quantized{};
+    double maxError{};
+    quantized.quantize(model, AdcMax, SupplyVoltage, maxError);
+    std::uint16_t adcValue{};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(quantized.predict(adcValue));
+        adcValue = AdcMax > adcValue ? adcValue + 1U : 0U;
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["max_error"] = maxError;
+}
+BENCHMARK(LinReg_PredictQuantized);
+} // namespace
+} // namespace ml
+
+#endif /** TESTSUITE */
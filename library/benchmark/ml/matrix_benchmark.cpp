@@ -0,0 +1,181 @@
+/**
+ * @brief Benchmarks for the ml::Matrix class and the linear algebra kernels.
+ */
+#include <cstddef>
+
+#include <benchmark/benchmark.h>
+
+#include "ml/matrix.h"
+
+#ifdef TESTSUITE
+
+namespace ml
+{
+namespace
+{
+// -----------------------------------------------------------------------------
+template <typename T, std::size_t Rows, std::size_t Cols>
+void initialize(Matrix<T, Rows, Cols>& matrix) noexcept
+{
+    for (std::size_t i{}; i < matrix.size(); ++i)
+    {
+        matrix.data()[i] = static_cast<T>(i % 7U) - static_cast<T>(3);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void multiplyNaive(const Matrix<double>& a, const Matrix<double>& b, Matrix<double>& out) noexcept
+{
+    // Textbook i-j-k loop order, which walks the columns of b with a stride of b.cols().
+    for (std::size_t i{}; i < a.rows(); ++i)
+    {
+        for (std::size_t j{}; j < b.cols(); ++j)
+        {
+            double sum{};
+            for (std::size_t k{}; k < a.cols(); ++k) { sum += a(i, k) * b(k, j); }
+            out(i, j) = sum;
+        }
+    }
+}
+
+/**
+ * @brief Benchmark of matrix multiplication with naive loop order (reference).
+ * 
+ *        Each iteration multiplies two square matrices of the given size.
+ */
+void Matrix_MultiplyNaive(benchmark::State& state)
+{
+    const std::size_t size{static_cast<std::size_t>(state.range(0))};
+    Matrix<double> a{size, size};
+    Matrix<double> b{size, size};
+    Matrix<double> out{size, size};
+    initialize(a);
+    initialize(b);
+
+    for (auto _ : state)
+    {
+        multiplyNaive(a, b, out);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * size * size * size);
+}
+BENCHMARK(Matrix_MultiplyNaive)->Arg(4)->Arg(16)->Arg(64)->Arg(256);
+
+/**
+ * @brief Benchmark of matrix multiplication.
+ * 
+ *        Each iteration multiplies two square matrices of the given size with the register 
+ *        blocking of ml::multiply(). Items are multiply-adds.
+ */
+void Matrix_Multiply(benchmark::State& state)
+{
+    const std::size_t size{static_cast<std::size_t>(state.range(0))};
+    Matrix<double> a{size, size};
+    Matrix<double> b{size, size};
+    Matrix<double> out{size, size};
+    initialize(a);
+    initialize(b);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(multiply(a, b, out));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * size * size * size);
+}
+BENCHMARK(Matrix_Multiply)->Arg(4)->Arg(16)->Arg(64)->Arg(256);
+
+/**
+ * @brief Benchmark of matrix multiplication with compile-time dimensions.
+ * 
+ *        Each iteration multiplies two square matrices stored in static arrays.
+ */
+template <std::size_t Size>
+void Matrix_MultiplyStatic(benchmark::State& state)
+{
+    Matrix<double, Size, Size> a{};
+    Matrix<double, Size, Size> b{};
+    Matrix<double, Size, Size> out{};
+    initialize(a);
+    initialize(b);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(multiply(a, b, out));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * Size * Size * Size);
+}
+BENCHMARK_TEMPLATE(Matrix_MultiplyStatic, 4U);
+BENCHMARK_TEMPLATE(Matrix_MultiplyStatic, 16U);
+
+/**
+ * @brief Benchmark of matrix-vector multiplication.
+ * 
+ *        Each iteration multiplies a matrix of the given number of rows and 16 columns with
+ *        a vector, as done by a dense layer with 16 inputs.
+ */
+void Matrix_MultiplyVector(benchmark::State& state)
+{
+    constexpr std::size_t inputCount{16U};
+    const std::size_t outputCount{static_cast<std::size_t>(state.range(0))};
+    Matrix<double> weights{outputCount, inputCount};
+    Matrix<double, 1U, inputCount> input{};
+    Matrix<double> output{1U, outputCount};
+    initialize(weights);
+    initialize(input);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(multiply(weights, input.row(0U), output.row(0U)));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * outputCount * inputCount);
+}
+BENCHMARK(Matrix_MultiplyVector)->Arg(4)->Arg(16)->Arg(64);
+
+/**
+ * @brief Benchmark of blocked matrix transposition.
+ * 
+ *        Each iteration transposes a square matrix of the given size.
+ */
+void Matrix_Transpose(benchmark::State& state)
+{
+    const std::size_t size{static_cast<std::size_t>(state.range(0))};
+    Matrix<double> a{size, size};
+    Matrix<double> out{size, size};
+    initialize(a);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(transpose(a, out));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * size * size);
+}
+BENCHMARK(Matrix_Transpose)->Arg(16)->Arg(256)->Arg(1024);
+
+/**
+ * @brief Benchmark of scaled vector addition.
+ * 
+ *        Each iteration adds a scaled row to another row of the given length.
+ */
+void Matrix_Axpy(benchmark::State& state)
+{
+    const std::size_t size{static_cast<std::size_t>(state.range(0))};
+    Matrix<double> matrix{2U, size};
+    initialize(matrix);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(axpy(1e-3, matrix.row(0U), matrix.row(1U)));
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * size);
+}
+BENCHMARK(Matrix_Axpy)->Arg(16)->Arg(256);
+} // namespace
+} // namespace ml
+
+#endif /** TESTSUITE */
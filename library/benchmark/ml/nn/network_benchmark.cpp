@@ -0,0 +1,127 @@
+/**
+ * @brief Benchmarks for the fixed-point dense neural network inference engine.
+ */
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "ml/nn/network.h"
+#include "nn/mlp.h"
+
+#ifdef TESTSUITE
+
+namespace ml
+{
+namespace
+{
+/** Max value of a 10-bit ADC. */
+constexpr std::uint16_t AdcMax{1023U};
+
+/** The number of layers of a 1-8-1 network. */
+constexpr std::uint8_t LayerCount{2U};
+
+/** The number of hidden neurons of a 1-8-1 network. */
+constexpr std::uint8_t HiddenWidth{8U};
+
+// -----------------------------------------------------------------------------
+const host::nn::Mlp& reference()
+{
+    // Train a 1-8-1 network calibrating an NTC thermistor (10 kOhm, B = 3950) in a voltage 
+    // divider with 10 kOhm once, shared by all benchmarks.
+    static const host::nn::Mlp mlp{[]()
+    {
+        host::nn::Mlp result{{HiddenWidth}};
+        std::vector<double> trainIn{};
+        std::vector<double> trainOut{};
+        for (std::uint16_t adcValue{100U}; adcValue <= 920U; adcValue += 8U)
+        {
+            const double resistanceRatio{static_cast<double>(adcValue) / (AdcMax - adcValue)};
+            trainIn.push_back(adcValue);
+            trainOut.push_back(1.0 / (1.0 / 298.15 + std::log(resistanceRatio) / 3950.0) - 
+                               273.15);
+        }
+        result.train(trainIn, trainOut, 2000U, 0.2);
+        return result;
+    }()};
+    return mlp;
+}
+
+/**
+ * @brief Benchmark of floating-point inference (reference).
+ * 
+ *        Each iteration predicts the temperature from an ADC value with the host-side 
+ *        double precision network.
+ */
+void NeuralNetwork_PredictFloat(benchmark::State& state)
+{
+    const host::nn::Mlp& mlp{reference()};
+    std::uint16_t adcValue{};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(mlp.predict(adcValue));
+        adcValue = AdcMax > adcValue ? adcValue + 1U : 0U;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(NeuralNetwork_PredictFloat);
+
+/**
+ * @brief Benchmark of fixed-point inference.
+ * 
+ *        Each iteration predicts the temperature directly from an ADC value with the 
+ *        quantized network. The max deviation from the reference, the bytes of weights and
+ *        biases in program memory and the size of the network in RAM (on the host) are 
+ *        reported as counters.
+ * 
+ * @tparam Weight The weight type.
+ */
+template <typename Weight>
+void NeuralNetwork_Predict(benchmark::State& state)
+{
+    const host::nn::Mlp& mlp{reference()};
+    host::nn::QuantizedMlp quantized{};
+    mlp.quantize(8U * sizeof(Weight), 6U, quantized);
+
+    // Copy the weights to the weight type and create the layer descriptors.
+    std::vector<Weight> weights[LayerCount]{};
+    nn::Dense<Weight> layers[LayerCount]{};
+    double flashBytes{};
+    for (std::uint8_t i{}; i < LayerCount; ++i)
+    {
+        const host::nn::QuantizedLayer& layer{quantized.layers[i]};
+        weights[i].assign(layer.weights.begin(), layer.weights.end());
+        layers[i] = {weights[i].data(), layer.biases.data(), layer.inputCount, 
+                     layer.outputCount, layer.shift, layer.activation};
+        flashBytes += weights[i].size() * sizeof(Weight) + 
+                      layer.biases.size() * sizeof(std::int32_t);
+    }
+    const nn::Network<Weight, LayerCount, HiddenWidth> network{
+        layers, quantized.inputOffset, quantized.inputScale, quantized.outputFracBits};
+
+    double maxError{};
+    for (std::uint16_t adcValue{}; adcValue <= AdcMax; ++adcValue)
+    {
+        const double error{std::fabs(network.predict(adcValue) - mlp.predict(adcValue))};
+        maxError = error > maxError ? error : maxError;
+    }
+    std::uint16_t adcValue{};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(network.predict(adcValue));
+        adcValue = AdcMax > adcValue ? adcValue + 1U : 0U;
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["max_error"]   = maxError;
+    state.counters["flash_bytes"] = flashBytes;
+    state.counters["ram_bytes"]   = sizeof(network);
+}
+BENCHMARK_TEMPLATE(NeuralNetwork_Predict, std::int8_t);
+BENCHMARK_TEMPLATE(NeuralNetwork_Predict, std::int16_t);
+} // namespace
+} // namespace ml
+
+#endif /** TESTSUITE */
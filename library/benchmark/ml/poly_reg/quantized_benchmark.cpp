@@ -0,0 +1,71 @@
+/**
+ * @brief Benchmarks for the quantized polynomial regression model.
+ */
+#include <cstdint>
+
+#include <benchmark/benchmark.h>
+
+#include "ml/poly_reg/fixed.h"
+#include "ml/poly_reg/quantized.h"
+#include "utils/utils.h"
+
+#ifdef TESTSUITE
+
+namespace ml
+{
+namespace
+{
+/** Max value of a 10-bit ADC. */
+constexpr std::uint16_t AdcMax{1023U};
+
+/** ADC supply voltage in Volts. */
+constexpr double SupplyVoltage{5.0};
+
+/**
+ * @brief Benchmark of floating-point polynomial prediction (reference).
+ * 
+ *        Each iteration converts an ADC value to the input voltage and predicts the 
+ *        temperature with a cubic floating-point model.
+ */
+void PolyReg_PredictFloat(benchmark::State& state)
+{
+    const poly_reg::Fixed<3U> model{{-40.0, 30.0, -4.0, 0.5}};
+    std::uint16_t adcValue{};
+
+    for (auto _ : state)
+    {
+        const double inputVoltage{adcValue / static_cast<double>(AdcMax) * SupplyVoltage};
+        benchmark::DoNotOptimize(utils::round<std::int16_t>(model.predict(inputVoltage)));
+        adcValue = AdcMax > adcValue ? adcValue + 1U : 0U;
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(PolyReg_PredictFloat);
+
+/**
+ * @brief Benchmark of quantized polynomial prediction.
+ * 
+ *        Each iteration predicts the temperature directly from an ADC value with a cubic Q16
+ *        model. The max quantization error is reported as a counter.
+ */
+void PolyReg_PredictQuantized(benchmark::State& state)
+{
+    const poly_reg::Fixed<3U> model{{-40.0, 30.0, -4.0, 0.5}};
+    poly_reg::Quantized<3U> quantized{};
+    double maxError{};
+    quantized.quantize(model, AdcMax, SupplyVoltage, maxError);
+    std::uint16_t adcValue{};
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(quantized.predict(adcValue));
+        adcValue = AdcMax > adcValue ? adcValue + 1U : 0U;
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.counters["max_error"] = maxError;
+}
+BENCHMARK(PolyReg_PredictQuantized);
+} // namespace
+} // namespace ml
+
+#endif /** TESTSUITE */
@@ -0,0 +1,131 @@
+/**
+ * @brief Host-side work-stealing thread pool.
+ */
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace host
+{
+namespace concurrency
+{
+/**
+ * @brief Work-stealing thread pool.
+ *
+ *        Each worker thread owns a queue of tasks. Tasks submitted from outside the pool are
+ *        distributed over the queues in turn, while tasks submitted by a worker are put in its
+ *        own queue. Workers run their own tasks in last-in first-out order, which keeps related
+ *        data in cache, and steal the oldest task of another queue when their own queue is 
+ *        empty, so that uneven tasks are balanced over all cores.
+ *
+ *        This class is non-copyable and non-movable.
+ */
+class ThreadPool
+{
+public:
+    /** Task type. */
+    using Task = std::function<void()>;
+
+    /**
+     * @brief Create thread pool.
+     *
+     * @param[in] threadCount The number of worker threads, or 0 to use one thread per 
+     *                        hardware thread (default = 0).
+     */
+    explicit ThreadPool(std::size_t threadCount = 0U);
+
+    /**
+     * @brief Destructor. Waits for all pending tasks to complete before stopping the workers.
+     *        Exceptions thrown by tasks since the last call to wait() are discarded.
+     */
+    ~ThreadPool() noexcept;
+
+    /**
+     * @brief Get the number of worker threads.
+     *
+     * @return The number of worker threads.
+     */
+    std::size_t threadCount() const noexcept;
+
+    /**
+     * @brief Submit task to run on a worker thread.
+     *
+     * @param[in] task The task to run. The first exception thrown by a task is rethrown 
+     *                 by wait().
+     */
+    void submit(Task task);
+
+    /**
+     * @brief Wait until all submitted tasks have completed.
+     *
+     *        Must not be called from a task, since the task itself would never complete.
+     *
+     * @throw The first exception thrown by a task since the last call, once all tasks have 
+     *        completed. Exceptions thrown by other tasks are discarded.
+     */
+    void wait();
+
+    ThreadPool(const ThreadPool&)            = delete; // No copy constructor.
+    ThreadPool(ThreadPool&&)                 = delete; // No move constructor.
+    ThreadPool& operator=(const ThreadPool&) = delete; // No copy assignment.
+    ThreadPool& operator=(ThreadPool&&)      = delete; // No move assignment.
+
+private:
+    /**
+     * @brief Structure of a task queue owned by a worker thread.
+     */
+    struct Queue
+    {
+        /** Pending tasks, the newest at the back. */
+        std::deque<Task> tasks{};
+
+        /** Mutex protecting the tasks. */
+        std::mutex mutex{};
+    };
+
+    void waitForTasks() noexcept;
+    void run(std::size_t index);
+    bool pop(std::size_t index, Task& task);
+    bool steal(std::size_t index, Task& task);
+
+    /** Task queues, one per worker thread. */
+    std::vector<std::unique_ptr<Queue>> myQueues{};
+
+    /** Worker threads. */
+    std::vector<std::thread> myThreads{};
+
+    /** Mutex protecting the sleep and completion conditions. */
+    std::mutex myMutex{};
+
+    /** Condition signaled when tasks are submitted or the pool is stopped. */
+    std::condition_variable myWorkAvailable{};
+
+    /** Condition signaled when all submitted tasks have completed. */
+    std::condition_variable myAllDone{};
+
+    /** The number of tasks submitted but not yet completed. */
+    std::atomic<std::size_t> myPendingCount{0U};
+
+    /** The number of tasks queued but not yet started. */
+    std::atomic<std::size_t> myQueuedCount{0U};
+
+    /** Index of the queue to put the next task submitted from outside the pool in. */
+    std::atomic<std::size_t> myNextQueue{0U};
+
+    /** The first exception thrown by a task since the last wait, protected by myMutex. */
+    std::exception_ptr myException{};
+
+    /** Indicate whether the worker threads shall stop. */
+    bool myStop{false};
+};
+} // namespace concurrency
+} // namespace host
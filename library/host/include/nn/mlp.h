@@ -0,0 +1,212 @@
+/**
+ * @brief Host-side multilayer perceptron for training and quantizing neural networks.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "ml/nn/activation.h"
+
+namespace host
+{
+namespace nn
+{
+/** Activation function. */
+using Activation = ml::nn::Activation;
+
+/**
+ * @brief Structure of a quantized dense layer, see ml::nn::Dense.
+ */
+struct QuantizedLayer
+{
+    /** Weights in row-major order, one row of inputs per output. */
+    std::vector<std::int32_t> weights{};
+
+    /** Biases, one per output. */
+    std::vector<std::int32_t> biases{};
+
+    /** The number of inputs. */
+    std::uint8_t inputCount{};
+
+    /** The number of outputs. */
+    std::uint8_t outputCount{};
+
+    /** Right shift converting the accumulated sums to the output format. */
+    std::uint8_t shift{};
+
+    /** Activation function applied to the outputs. */
+    Activation activation{Activation::Linear};
+};
+
+/**
+ * @brief Structure of a quantized network, see ml::nn::Network.
+ */
+struct QuantizedMlp
+{
+    /** Quantized layers, from input to output. */
+    std::vector<QuantizedLayer> layers{};
+
+    /** ADC value corresponding to input 0. */
+    std::uint16_t inputOffset{};
+
+    /** Input per ADC value in Q24 format. */
+    std::uint16_t inputScale{};
+
+    /** The number of fractional bits of the network output. */
+    std::uint8_t outputFracBits{};
+
+    /** The number of bits of each weight, 8 or 16. */
+    std::uint8_t weightBits{};
+};
+
+/**
+ * @brief Multilayer perceptron with a single input and a single output.
+ *
+ *        The network is trained in double precision with stochastic gradient descent and 
+ *        serves as the floating-point reference of the fixed-point inference engine 
+ *        ml::nn::Network, for instance to replace the linear calibration of a temperature 
+ *        sensor by a 1-8-1 network. Inputs and outputs are normalized to [-1, 1] based on the 
+ *        training data, and the normalization is folded into the quantized network.
+ */
+class Mlp
+{
+public:
+    /**
+     * @brief Create untrained network.
+     *
+     * @param[in] hiddenWidths The number of neurons of each hidden layer, for instance {8}.
+     *                         Each width must be between 1 and 255.
+     * @param[in] hiddenActivation Activation function of the hidden layers 
+     *                             (default = hyperbolic tangent). The output layer is linear.
+     * @param[in] seed Seed of the random weight initialization and shuffling (default = 1).
+     */
+    explicit Mlp(const std::vector<std::size_t>& hiddenWidths, 
+                 Activation hiddenActivation = Activation::Tanh, std::uint32_t seed = 1U);
+
+    /**
+     * @brief Check whether the network is trained.
+     *
+     * @return True if the network is trained, false otherwise.
+     */
+    bool isTrained() const noexcept;
+
+    /**
+     * @brief Get the number of layers, including the output layer.
+     *
+     * @return The number of layers.
+     */
+    std::size_t layerCount() const noexcept;
+
+    /**
+     * @brief Train the network with stochastic gradient descent.
+     *
+     *        The weights are initialized randomly and updated after each training set, 
+     *        which are visited in random order each epoch.
+     *
+     * @param[in] trainIn Training data input values, for instance raw ADC values.
+     * @param[in] trainOut Training data output values, one per input value.
+     * @param[in] epochCount Number of epochs to perform training. Must be greater than 0.
+     * @param[in] learningRate Learning rate to use for updating the weights (default = 0.05).
+     *                         Must be greater than 0.0 and less than or equal to 1.0.
+     *
+     * @return The mean squared error of the final epoch in output units, or a negative 
+     *         number if the parameters or the training data are invalid.
+     */
+    double train(const std::vector<double>& trainIn, const std::vector<double>& trainOut,
+                 std::size_t epochCount, double learningRate = 0.05);
+
+    /**
+     * @brief Predict based on given input.
+     *
+     * @param[in] input The input for which to predict.
+     *
+     * @return The predicted value, or 0 if the network is untrained.
+     */
+    double predict(double input) const;
+
+    /**
+     * @brief Quantize the network for fixed-point inference.
+     *
+     *        Each layer uses the largest number of fractional bits of the weights for which 
+     *        the weights and biases fit, so the precision follows the magnitude of the 
+     *        weights. The output normalization is folded into the output layer.
+     *
+     * @param[in] weightBits The number of bits of each weight, 8 or 16.
+     * @param[in] outputFracBits The number of fractional bits of the network output. 
+     *                           Must be less than 16.
+     * @param[out] quantized Reference to structure for storing the quantized network.
+     *
+     * @return True on success, false if the network isn't trained, if the parameters are 
+     *         invalid or if a layer can't be represented in fixed-point format.
+     */
+    bool quantize(std::uint8_t weightBits, std::uint8_t outputFracBits, 
+                  QuantizedMlp& quantized) const;
+
+private:
+    /**
+     * @brief Structure of a dense layer in double precision.
+     */
+    struct Layer
+    {
+        /** Weights in row-major order, one row of inputs per output. */
+        std::vector<double> weights{};
+
+        /** Biases, one per output. */
+        std::vector<double> biases{};
+
+        /** The number of inputs. */
+        std::size_t inputCount{};
+
+        /** The number of outputs. */
+        std::size_t outputCount{};
+
+        /** Activation function applied to the outputs. */
+        Activation activation{Activation::Linear};
+    };
+
+    void initialize();
+    void forward(double input, std::vector<std::vector<double>>& activations) const;
+    void backward(const std::vector<std::vector<double>>& activations, double target, 
+                  double learningRate);
+
+    /** Layers of the network, from input to output. */
+    std::vector<Layer> myLayers{};
+
+    /** Seed of the random weight initialization and shuffling. */
+    std::uint32_t mySeed{};
+
+    /** Input corresponding to normalized input 0. */
+    double myInputOffset{};
+
+    /** Factor converting inputs to normalized inputs. */
+    double myInputScale{1.0};
+
+    /** Output corresponding to normalized output 0. */
+    double myOutputOffset{};
+
+    /** Factor converting normalized outputs to outputs. */
+    double myOutputScale{1.0};
+
+    /** Indicate whether the network is trained. */
+    bool myTrained{false};
+};
+
+/**
+ * @brief Generate C++ source code defining a quantized network stored in program memory.
+ *
+ *        The generated code defines the weights and biases of each layer with PROGMEM and
+ *        an array of ml::nn::Dense layers along with the input offset, input scale and 
+ *        number of output fractional bits to pass to ml::nn::Network.
+ *
+ * @param[in] network The quantized network.
+ * @param[in] name Prefix of the generated identifiers, for instance "Calibration".
+ *
+ * @return The generated source code.
+ */
+std::string exportSource(const QuantizedMlp& network, const std::string& name);
+
+} // namespace nn
+} // namespace host
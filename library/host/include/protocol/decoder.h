@@ -0,0 +1,142 @@
+/**
+ * @brief Host-side decoder for the binary framed serial protocol.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "driver/serial/protocol.h"
+
+namespace host
+{
+namespace protocol
+{
+/** Decoded protocol message. */
+using Message = driver::serial::Message;
+
+/** Protocol message type. */
+using MessageType = driver::serial::MessageType;
+
+/**
+ * @brief Structure of decoder statistics.
+ */
+struct Statistics
+{
+    /** The number of valid frames received. */
+    std::size_t validFrames{};
+
+    /** The number of corrupt frames dropped (checksum mismatch or invalid encoding). */
+    std::size_t corruptFrames{};
+
+    /** The number of frames dropped due to exceeding the maximum frame size. */
+    std::size_t oversizedFrames{};
+
+    /** The total number of bytes received. */
+    std::size_t receivedBytes{};
+};
+
+/**
+ * @brief Streaming decoder for the binary framed serial protocol.
+ *
+ *        Received bytes are fed to the decoder in chunks of arbitrary size, for instance as
+ *        read from a serial port. Complete frames are decoded as soon as their delimiter has
+ *        been received. Corrupt or truncated frames are dropped and decoding resynchronizes
+ *        on the next delimiter.
+ */
+class Decoder
+{
+public:
+    /**
+     * @brief Constructor.
+     */
+    Decoder() = default;
+
+    /**
+     * @brief Feed received bytes to the decoder.
+     *
+     * @param[in] data Pointer to the received bytes.
+     * @param[in] size The number of received bytes.
+     *
+     * @return The number of messages decoded from the given bytes.
+     */
+    std::size_t feed(const std::uint8_t* data, std::size_t size);
+
+    /**
+     * @brief Feed received bytes to the decoder.
+     *
+     * @param[in] data The received bytes.
+     *
+     * @return The number of messages decoded from the given bytes.
+     */
+    std::size_t feed(const std::vector<std::uint8_t>& data);
+
+    /**
+     * @brief Check whether any decoded messages are pending.
+     *
+     * @return True if at least one decoded message is pending, false otherwise.
+     */
+    bool hasMessage() const noexcept;
+
+    /**
+     * @brief Get the next decoded message.
+     *
+     * @param[out] message Reference to message for storing the next decoded message.
+     *
+     * @return True if a message was pending, false otherwise.
+     */
+    bool next(Message& message);
+
+    /**
+     * @brief Get the decoder statistics.
+     *
+     * @return Reference to the decoder statistics.
+     */
+    const Statistics& statistics() const noexcept;
+
+    /**
+     * @brief Reset the decoder, which drops all pending bytes, messages and statistics.
+     */
+    void reset() noexcept;
+
+private:
+    void handleFrame();
+
+    /** Bytes of the frame currently being received. */
+    std::vector<std::uint8_t> myFrame{};
+
+    /** Decoded messages. */
+    std::deque<Message> myMessages{};
+
+    /** Decoder statistics. */
+    Statistics myStatistics{};
+
+    /** Indicate whether the current frame has exceeded the maximum frame size. */
+    bool myOverflow{false};
+};
+
+/**
+ * @brief Get the name of given message type.
+ *
+ * @param[in] type The message type.
+ *
+ * @return The name of the message type, or "Unknown" for unknown types.
+ */
+std::string typeName(MessageType type);
+
+/**
+ * @brief Format message as human-readable text.
+ *
+ *        Log messages are formatted using the format strings in logging/messages.h.
+ *
+ * @param[in] message The message to format.
+ *
+ * @return The formatted message.
+ */
+std::string format(const Message& message);
+
+} // namespace protocol
+} // namespace host
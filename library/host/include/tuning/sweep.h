@@ -0,0 +1,156 @@
+/**
+ * @brief Host-side hyperparameter sweep with k-fold cross-validation.
+ */
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "concurrency/thread_pool.h"
+
+namespace host
+{
+namespace tuning
+{
+/**
+ * @brief Enumeration of regression model types.
+ */
+enum class ModelType : std::uint8_t
+{
+    GradientDescent, /** Linear model trained with gradient descent, see ml::lin_reg::Fixed. */
+    LeastSquares,    /** Linear model trained with closed-form least squares. */
+    Quadratic,       /** Polynomial model of degree 2, see ml::poly_reg::Fixed. */
+    Cubic,           /** Polynomial model of degree 3. */
+    Piecewise,       /** Piecewise linear model of 4 segments, see ml::lin_reg::Piecewise. */
+    Count,           /** The number of model types. */
+};
+
+/**
+ * @brief Structure of a model configuration.
+ */
+struct Config
+{
+    /** The model type. */
+    ModelType model{ModelType::GradientDescent};
+
+    /** Learning rate, only used for gradient descent. */
+    double learningRate{};
+
+    /** Number of epochs to perform training, only used for gradient descent. */
+    std::size_t epochCount{};
+};
+
+/**
+ * @brief Structure of a cross-validation result.
+ */
+struct Result
+{
+    /** The evaluated configuration. */
+    Config config{};
+
+    /** Mean squared validation error averaged over the folds. */
+    double meanError{};
+
+    /** Standard deviation of the mean squared validation error over the folds. */
+    double errorDeviation{};
+
+    /** Indicate whether training succeeded and produced finite predictions on every fold. */
+    bool valid{false};
+};
+
+/**
+ * @brief Get the name of given model type.
+ *
+ * @param[in] model The model type.
+ *
+ * @return The name of the model type, or "Unknown" for unknown types.
+ */
+std::string modelName(ModelType model);
+
+/**
+ * @brief Create a grid of configurations.
+ *
+ *        Gradient descent is combined with every learning rate and epoch count, while 
+ *        the closed-form models have no hyperparameters and are listed once.
+ *
+ * @param[in] models The model types to include.
+ * @param[in] learningRates The learning rates to combine.
+ * @param[in] epochCounts The epoch counts to combine.
+ *
+ * @return The configurations.
+ */
+std::vector<Config> gridConfigs(const std::vector<ModelType>& models, 
+                                const std::vector<double>& learningRates,
+                                const std::vector<std::size_t>& epochCounts);
+
+/**
+ * @brief Create random gradient descent configurations.
+ *
+ *        Learning rates and epoch counts are drawn log-uniformly from the given ranges, 
+ *        which covers several orders of magnitude evenly.
+ *
+ * @param[in] count The number of configurations.
+ * @param[in] minLearningRate The min learning rate. Must be greater than 0.
+ * @param[in] maxLearningRate The max learning rate. Must be at least the min learning rate.
+ * @param[in] minEpochCount The min epoch count. Must be greater than 0.
+ * @param[in] maxEpochCount The max epoch count. Must be at least the min epoch count.
+ * @param[in] seed Seed of the pseudo-random number generator (default = 1).
+ *
+ * @return The configurations, empty if the ranges are invalid.
+ */
+std::vector<Config> randomConfigs(std::size_t count, double minLearningRate, 
+                                  double maxLearningRate, std::size_t minEpochCount, 
+                                  std::size_t maxEpochCount, std::uint32_t seed = 1U);
+
+/**
+ * @brief Cross-validate a configuration with k folds.
+ *
+ *        Training set i belongs to fold i % foldCount, so sorted training data yields folds 
+ *        spanning the entire input range. For each fold, a model is trained on the other 
+ *        folds and validated on the fold.
+ *
+ * @param[in] config The configuration to evaluate.
+ * @param[in] trainIn Training data input values.
+ * @param[in] trainOut Training data output values, one per input value.
+ * @param[in] foldCount The number of folds. Must be at least 2 and at most the number of 
+ *                      training sets.
+ *
+ * @return The cross-validation result, invalid if the parameters are invalid.
+ */
+Result crossValidate(const Config& config, const std::vector<double>& trainIn,
+                     const std::vector<double>& trainOut, std::size_t foldCount);
+
+/**
+ * @brief Cross-validate configurations in parallel and rank them.
+ *
+ *        Each fold of each configuration is a separate task, so that long and short 
+ *        training runs are balanced over the workers of the pool.
+ *
+ * @param[in] configs The configurations to evaluate.
+ * @param[in] trainIn Training data input values.
+ * @param[in] trainOut Training data output values, one per input value.
+ * @param[in] foldCount The number of folds, see crossValidate().
+ * @param[in] pool The thread pool to run the tasks on.
+ *
+ * @return The results ranked by ascending mean validation error, invalid results last.
+ *
+ * @throw The first exception thrown by a task, such as std::bad_alloc.
+ */
+std::vector<Result> sweep(const std::vector<Config>& configs, const std::vector<double>& trainIn,
+                          const std::vector<double>& trainOut, std::size_t foldCount, 
+                          concurrency::ThreadPool& pool);
+
+/**
+ * @brief Format results as a ranked text table.
+ *
+ * @param[in] results The ranked results.
+ * @param[in] rowCount The max number of rows, or 0 for all results (default = 0).
+ *
+ * @return The formatted table, one line per result after a header line.
+ */
+std::string formatTable(const std::vector<Result>& results, std::size_t rowCount = 0U);
+
+} // namespace tuning
+} // namespace host
@@ -0,0 +1,155 @@
+/**
+ * @brief Implementation details of the host-side work-stealing thread pool.
+ */
+#include <algorithm>
+#include <utility>
+
+#include "concurrency/thread_pool.h"
+
+namespace host
+{
+namespace concurrency
+{
+namespace
+{
+/** Pool owning the current worker thread, null outside of worker threads. */
+thread_local const ThreadPool* currentPool{nullptr};
+
+/** Index of the queue owned by the current worker thread. */
+thread_local std::size_t currentIndex{};
+} // namespace
+
+// -----------------------------------------------------------------------------
+ThreadPool::ThreadPool(const std::size_t threadCount)
+{
+    // Use one thread per hardware thread by default, at least one thread if unknown.
+    const std::size_t count{0U < threadCount ? threadCount 
+                                             : std::max(std::thread::hardware_concurrency(), 1U)};
+    for (std::size_t i{}; i < count; ++i) { myQueues.push_back(std::make_unique<Queue>()); }
+    for (std::size_t i{}; i < count; ++i) { myThreads.emplace_back(&ThreadPool::run, this, i); }
+}
+
+// -----------------------------------------------------------------------------
+ThreadPool::~ThreadPool() noexcept
+{
+    waitForTasks();
+    {
+        std::lock_guard<std::mutex> lock{myMutex};
+        myStop = true;
+    }
+    myWorkAvailable.notify_all();
+    for (auto& thread : myThreads) { thread.join(); }
+}
+
+// -----------------------------------------------------------------------------
+std::size_t ThreadPool::threadCount() const noexcept { return myThreads.size(); }
+
+// -----------------------------------------------------------------------------
+void ThreadPool::submit(Task task)
+{
+    // Put tasks submitted by a worker in its own queue, distribute other tasks in turn.
+    const std::size_t index{this == currentPool ? currentIndex 
+                                                : myNextQueue++ % myQueues.size()};
+    myPendingCount++;
+
+    // Count the task as queued under the mutex before queuing it, so that no sleeping worker 
+    // misses it and the count never drops below the number of queued tasks.
+    {
+        std::lock_guard<std::mutex> lock{myMutex};
+        myQueuedCount++;
+    }
+    {
+        std::lock_guard<std::mutex> lock{myQueues[index]->mutex};
+        myQueues[index]->tasks.push_back(std::move(task));
+    }
+    myWorkAvailable.notify_one();
+}
+
+// -----------------------------------------------------------------------------
+void ThreadPool::wait()
+{
+    waitForTasks();
+
+    // Pass the first exception thrown by a task to the caller, clear it for the next wait.
+    std::exception_ptr exception{};
+    {
+        std::lock_guard<std::mutex> lock{myMutex};
+        std::swap(exception, myException);
+    }
+    if (nullptr != exception) { std::rethrow_exception(exception); }
+}
+
+// -----------------------------------------------------------------------------
+void ThreadPool::waitForTasks() noexcept
+{
+    std::unique_lock<std::mutex> lock{myMutex};
+    myAllDone.wait(lock, [this]() { return 0U == myPendingCount; });
+}
+
+// -----------------------------------------------------------------------------
+void ThreadPool::run(const std::size_t index)
+{
+    currentPool  = this;
+    currentIndex = index;
+
+    while (true)
+    {
+        Task task{};
+
+        // Run the newest own task or the oldest task of another queue.
+        if (pop(index, task) || steal(index, task))
+        {
+            myQueuedCount--;
+            // Store the first exception thrown, so that wait() can pass it to the caller.
+            try { task(); }
+            catch (...)
+            {
+                std::lock_guard<std::mutex> lock{myMutex};
+                if (nullptr == myException) { myException = std::current_exception(); }
+            }
+
+            // Signal completion of the last pending task under the mutex, so that no waiting 
+            // thread misses it.
+            if (0U == --myPendingCount)
+            {
+                std::lock_guard<std::mutex> lock{myMutex};
+                myAllDone.notify_all();
+            }
+            continue;
+        }
+
+        // Sleep until tasks are queued or the pool is stopped.
+        std::unique_lock<std::mutex> lock{myMutex};
+        myWorkAvailable.wait(lock, [this]() { return myStop || (0U < myQueuedCount); });
+        if (myStop && (0U == myQueuedCount)) { return; }
+    }
+}
+
+// -----------------------------------------------------------------------------
+bool ThreadPool::pop(const std::size_t index, Task& task)
+{
+    Queue& queue{*myQueues[index]};
+    std::lock_guard<std::mutex> lock{queue.mutex};
+    if (queue.tasks.empty()) { return false; }
+    task = std::move(queue.tasks.back());
+    queue.tasks.pop_back();
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+bool ThreadPool::steal(const std::size_t index, Task& task)
+{
+    // Visit the other queues starting with the next one, so that thieves spread out.
+    for (std::size_t i{1U}; i < myQueues.size(); ++i)
+    {
+        Queue& queue{*myQueues[(index + i) % myQueues.size()]};
+        std::lock_guard<std::mutex> lock{queue.mutex};
+        if (queue.tasks.empty()) { continue; }
+        task = std::move(queue.tasks.front());
+        queue.tasks.pop_front();
+        return true;
+    }
+    return false;
+}
+} // namespace concurrency
+} // namespace host
@@ -0,0 +1,341 @@
+/**
+ * @brief Implementation details of the host-side multilayer perceptron.
+ */
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <sstream>
+
+#include "nn/mlp.h"
+
+namespace host
+{
+namespace nn
+{
+namespace
+{
+/** Min half span of the normalized inputs, so that the Q24 input scale fits in 16 bits. */
+constexpr double MinInputHalfSpan{256.0};
+
+/** Max number of fractional bits of quantized weights, so that each shift is below 32. */
+constexpr int MaxWeightFracBits{31 - ml::nn::ActivationFracBits};
+
+// -----------------------------------------------------------------------------
+double activate(const Activation activation, const double value)
+{
+    switch (activation)
+    {
+        case Activation::Relu:
+            return std::max(value, 0.0);
+        case Activation::Tanh:
+            return std::tanh(value);
+        default:
+            return value;
+    }
+}
+
+// -----------------------------------------------------------------------------
+double derivative(const Activation activation, const double output)
+{
+    // Compute the derivative from the activated output, which is all backpropagation keeps.
+    switch (activation)
+    {
+        case Activation::Relu:
+            return 0.0 < output ? 1.0 : 0.0;
+        case Activation::Tanh:
+            return 1.0 - output * output;
+        default:
+            return 1.0;
+    }
+}
+
+// -----------------------------------------------------------------------------
+const char* activationName(const Activation activation)
+{
+    switch (activation)
+    {
+        case Activation::Relu:
+            return "Relu";
+        case Activation::Tanh:
+            return "Tanh";
+        default:
+            return "Linear";
+    }
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+Mlp::Mlp(const std::vector<std::size_t>& hiddenWidths, const Activation hiddenActivation, 
+         const std::uint32_t seed)
+    : mySeed{seed}
+{
+    // Chain the hidden layers from the single input to the single linear output.
+    std::size_t inputCount{1U};
+    for (const auto& width : hiddenWidths)
+    {
+        myLayers.push_back(Layer{{}, {}, inputCount, width, hiddenActivation});
+        inputCount = width;
+    }
+    myLayers.push_back(Layer{{}, {}, inputCount, 1U, Activation::Linear});
+    initialize();
+}
+
+// -----------------------------------------------------------------------------
+bool Mlp::isTrained() const noexcept { return myTrained; }
+
+// -----------------------------------------------------------------------------
+std::size_t Mlp::layerCount() const noexcept { return myLayers.size(); }
+
+// -----------------------------------------------------------------------------
+double Mlp::train(const std::vector<double>& trainIn, const std::vector<double>& trainOut,
+                  const std::size_t epochCount, const double learningRate)
+{
+    // Check the parameters, return a negative number if invalid.
+    const std::size_t setCount{std::min(trainIn.size(), trainOut.size())};
+    if ((0U == setCount) || (0U == epochCount) || (0.0 >= learningRate) || 
+        (1.0 < learningRate))
+    {
+        return -1.0;
+    }
+    for (const auto& layer : myLayers)
+    {
+        if ((0U == layer.outputCount) || (UINT8_MAX < layer.outputCount)) { return -1.0; }
+    }
+
+    // Normalize the inputs to [-1, 1] around an integer offset, which the quantized network 
+    // represents exactly, and the outputs to [-1, 1].
+    const auto input{std::minmax_element(trainIn.begin(), trainIn.begin() + setCount)};
+    const auto output{std::minmax_element(trainOut.begin(), trainOut.begin() + setCount)};
+    myInputOffset  = std::round((*input.first + *input.second) / 2.0);
+    myInputScale   = 1.0 / std::max((*input.second - *input.first) / 2.0, MinInputHalfSpan);
+    myOutputOffset = (*output.first + *output.second) / 2.0;
+    myOutputScale  = std::max((*output.second - *output.first) / 2.0, 1.0);
+    initialize();
+
+    std::vector<std::size_t> order(setCount);
+    std::iota(order.begin(), order.end(), 0U);
+    std::mt19937 generator{mySeed};
+    std::vector<std::vector<double>> activations{};
+    double error{};
+
+    // Train the network one set at a time, in random order each epoch.
+    for (std::size_t epoch{}; epoch < epochCount; ++epoch)
+    {
+        std::shuffle(order.begin(), order.end(), generator);
+        error = 0.0;
+
+        for (const auto& set : order)
+        {
+            const double target{(trainOut[set] - myOutputOffset) / myOutputScale};
+            forward((trainIn[set] - myInputOffset) * myInputScale, activations);
+            const double deviation{activations.back()[0U] - target};
+            error += deviation * deviation;
+            backward(activations, target, learningRate);
+        }
+    }
+    myTrained = true;
+
+    // Return the mean squared error of the final epoch in output units.
+    return error / setCount * myOutputScale * myOutputScale;
+}
+
+// -----------------------------------------------------------------------------
+double Mlp::predict(const double input) const
+{
+    if (!myTrained) { return 0.0; }
+    std::vector<std::vector<double>> activations{};
+    forward((input - myInputOffset) * myInputScale, activations);
+    return activations.back()[0U] * myOutputScale + myOutputOffset;
+}
+
+// -----------------------------------------------------------------------------
+bool Mlp::quantize(const std::uint8_t weightBits, const std::uint8_t outputFracBits, 
+                   QuantizedMlp& quantized) const
+{
+    // Check the parameters, return false if invalid.
+    if (!myTrained || ((8U != weightBits) && (16U != weightBits)) || (16U <= outputFracBits)) 
+    { 
+        return false; 
+    }
+
+    // Return false if the input normalization doesn't fit the fixed-point format.
+    const double inputScale{std::round(myInputScale * (1UL << 24U))};
+    if ((0.0 > myInputOffset) || (UINT16_MAX < myInputOffset) || (0.0 >= inputScale) || 
+        (UINT16_MAX < inputScale))
+    {
+        return false;
+    }
+
+    // Sums of 8-bit products are accumulated in 32 bits, so the biases must leave headroom.
+    const double maxWeight{static_cast<double>((1L << (weightBits - 1U)) - 1)};
+    const double maxBias{8U == weightBits ? static_cast<double>(1L << 30U) : INT32_MAX};
+    QuantizedMlp result{};
+    result.inputOffset    = static_cast<std::uint16_t>(myInputOffset);
+    result.inputScale     = static_cast<std::uint16_t>(inputScale);
+    result.outputFracBits = outputFracBits;
+    result.weightBits     = weightBits;
+
+    for (std::size_t i{}; i < myLayers.size(); ++i)
+    {
+        // Fold the output normalization into the output layer, which is linear.
+        const bool isOutput{myLayers.size() - 1U == i};
+        const double scale{isOutput ? myOutputScale : 1.0};
+        const double offset{isOutput ? myOutputOffset : 0.0};
+        const int outputBits{isOutput ? outputFracBits : ml::nn::ActivationFracBits};
+        const Layer& layer{myLayers[i]};
+        double maxAbsWeight{};
+        double maxAbsBias{};
+        for (const auto& weight : layer.weights) 
+        { 
+            maxAbsWeight = std::max(maxAbsWeight, std::fabs(weight * scale)); 
+        }
+        for (const auto& bias : layer.biases) 
+        { 
+            maxAbsBias = std::max(maxAbsBias, std::fabs(bias * scale + offset)); 
+        }
+
+        // Use the most fractional bits for which the weights and biases fit, return false if 
+        // the sums can't be shifted to the output format with any number of fractional bits.
+        const int minFracBits{outputBits - ml::nn::ActivationFracBits};
+        int fracBits{MaxWeightFracBits};
+        while ((minFracBits <= fracBits) && 
+               ((maxWeight < std::round(maxAbsWeight * std::ldexp(1.0, fracBits))) || 
+                (maxBias < std::round(maxAbsBias * 
+                                      std::ldexp(1.0, fracBits + ml::nn::ActivationFracBits)))))
+        {
+            --fracBits;
+        }
+        if (minFracBits > fracBits) { return false; }
+        const int shift{fracBits - minFracBits};
+
+        QuantizedLayer quantizedLayer{{}, {}, static_cast<std::uint8_t>(layer.inputCount), 
+                                      static_cast<std::uint8_t>(layer.outputCount), 
+                                      static_cast<std::uint8_t>(shift), layer.activation};
+        for (const auto& weight : layer.weights)
+        {
+            quantizedLayer.weights.push_back(
+                static_cast<std::int32_t>(std::round(weight * scale * std::ldexp(1.0, fracBits))));
+        }
+        for (const auto& bias : layer.biases)
+        {
+            quantizedLayer.biases.push_back(static_cast<std::int32_t>(std::round(
+                (bias * scale + offset) * std::ldexp(1.0, fracBits + ml::nn::ActivationFracBits))));
+        }
+        result.layers.push_back(quantizedLayer);
+    }
+    quantized = result;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+void Mlp::initialize()
+{
+    std::mt19937 generator{mySeed};
+
+    // Initialize the weights uniformly with variance 2 / (inputs + outputs), the biases to 0.
+    for (auto& layer : myLayers)
+    {
+        const double limit{std::sqrt(6.0 / (layer.inputCount + layer.outputCount))};
+        std::uniform_real_distribution<double> distribution{-limit, limit};
+        layer.weights.resize(layer.inputCount * layer.outputCount);
+        layer.biases.assign(layer.outputCount, 0.0);
+        for (auto& weight : layer.weights) { weight = distribution(generator); }
+    }
+    myTrained = false;
+}
+
+// -----------------------------------------------------------------------------
+void Mlp::forward(const double input, std::vector<std::vector<double>>& activations) const
+{
+    // Store the activations of each layer, starting with the input, for backpropagation.
+    activations.assign(1U, std::vector<double>{input});
+
+    for (const auto& layer : myLayers)
+    {
+        const std::vector<double>& in{activations.back()};
+        std::vector<double> out(layer.outputCount);
+
+        for (std::size_t i{}; i < layer.outputCount; ++i)
+        {
+            double sum{layer.biases[i]};
+            for (std::size_t j{}; j < layer.inputCount; ++j) 
+            { 
+                sum += layer.weights[i * layer.inputCount + j] * in[j]; 
+            }
+            out[i] = activate(layer.activation, sum);
+        }
+        activations.push_back(out);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void Mlp::backward(const std::vector<std::vector<double>>& activations, const double target,
+                   const double learningRate)
+{
+    // Start from the gradient of the squared error with respect to the linear output.
+    std::vector<double> delta{activations.back()[0U] - target};
+
+    for (std::size_t l{myLayers.size()}; 0U < l--;)
+    {
+        Layer& layer{myLayers[l]};
+        const std::vector<double>& in{activations[l]};
+        std::vector<double> previous(layer.inputCount);
+
+        for (std::size_t i{}; i < layer.outputCount; ++i)
+        {
+            const double gradient{delta[i] * derivative(layer.activation, activations[l + 1U][i])};
+
+            // Propagate the gradient to the inputs before updating the weights.
+            for (std::size_t j{}; j < layer.inputCount; ++j)
+            {
+                double& weight{layer.weights[i * layer.inputCount + j]};
+                previous[j] += gradient * weight;
+                weight      -= learningRate * gradient * in[j];
+            }
+            layer.biases[i] -= learningRate * gradient;
+        }
+        delta = previous;
+    }
+}
+
+// -----------------------------------------------------------------------------
+std::string exportSource(const QuantizedMlp& network, const std::string& name)
+{
+    const std::string type{8U == network.weightBits ? "int8_t" : "int16_t"};
+    std::ostringstream source{};
+
+    // Define the weights and biases of each layer in program memory.
+    for (std::size_t i{}; i < network.layers.size(); ++i)
+    {
+        const QuantizedLayer& layer{network.layers[i]};
+        source << "/** Weights of layer " << i << ". */\n"
+               << "constexpr " << type << " " << name << "Weights" << i << "[] PROGMEM{";
+        for (const auto& weight : layer.weights) { source << weight << ", "; }
+        source << "};\n\n/** Biases of layer " << i << ". */\n"
+               << "constexpr int32_t " << name << "Biases" << i << "[] PROGMEM{";
+        for (const auto& bias : layer.biases) { source << bias << "L, "; }
+        source << "};\n\n";
+    }
+
+    // Define the layer descriptors and the parameters of the network.
+    source << "/** Layers of the network. */\n"
+           << "constexpr ml::nn::Dense<" << type << "> " << name << "Layers[]{\n";
+    for (std::size_t i{}; i < network.layers.size(); ++i)
+    {
+        const QuantizedLayer& layer{network.layers[i]};
+        source << "    {" << name << "Weights" << i << ", " << name << "Biases" << i << ", " 
+               << +layer.inputCount << "U, " << +layer.outputCount << "U, " << +layer.shift 
+               << "U, ml::nn::Activation::" << activationName(layer.activation) << "},\n";
+    }
+    source << "};\n\n/** ADC value corresponding to input 0. */\n"
+           << "constexpr uint16_t " << name << "InputOffset{" << network.inputOffset << "U};\n\n"
+           << "/** Input per ADC value in Q24 format. */\n"
+           << "constexpr uint16_t " << name << "InputScale{" << network.inputScale << "U};\n\n"
+           << "/** The number of fractional bits of the network output. */\n"
+           << "constexpr uint8_t " << name << "OutputFracBits{" << +network.outputFracBits 
+           << "U};\n";
+    return source.str();
+}
+} // namespace nn
+} // namespace host
@@ -0,0 +1,202 @@
+/**
+ * @brief Implementation details of the host-side protocol decoder.
+ */
+#include <cstdio>
+#include <cstring>
+#include <sstream>
+
+#include "logging/messages.h"
+#include "protocol/decoder.h"
+#include "utils/codec.h"
+
+namespace host
+{
+namespace protocol
+{
+namespace
+{
+/** Maximum size of an encoded frame in bytes, excluding the delimiter. */
+constexpr std::size_t MaxFrameSize{driver::serial::Protocol::MaxFrameSize - 1U};
+
+// -----------------------------------------------------------------------------
+std::string formatArg(const std::string& spec, const char conversion, const std::int32_t value)
+{
+    char buffer[64U]{};
+
+    // Format the value as a 64-bit integer, unsigned conversions reinterpret the 32-bit value.
+    if ('c' == conversion) { buffer[0U] = static_cast<char>(value); }
+    else if (nullptr != std::strchr("uxXo", conversion))
+    {
+        const unsigned long long arg{static_cast<std::uint32_t>(value)};
+        std::snprintf(buffer, sizeof(buffer), (spec + "ll" + conversion).c_str(), arg);
+    }
+    else { std::snprintf(buffer, sizeof(buffer), (spec + "lld").c_str(), value + 0LL); }
+    return buffer;
+}
+
+// -----------------------------------------------------------------------------
+bool formatLog(const Message& message, std::string& text)
+{
+    // Return false if the message holds no valid id.
+    if ((0U == message.valueCount) || (0 > message.values[0U]) || 
+        (static_cast<std::int32_t>(logging::Id::Count) <= message.values[0U]))
+    {
+        return false;
+    }
+    const char* format{logging::format(static_cast<logging::Id>(message.values[0U]))};
+    std::uint8_t argIndex{1U};
+
+    // Replace each conversion specification with the next argument.
+    for (const char* c{format}; '\0' != *c; ++c)
+    {
+        if ('%' != *c) { text += *c; continue; }
+        if ('%' == c[1U]) { text += *++c; continue; }
+
+        // Collect flags, width and precision, skip length modifiers.
+        std::string spec{"%"};
+        while (('\0' != c[1U]) && (nullptr != std::strchr("-+ #0123456789.", c[1U]))) 
+        { 
+            spec += *++c; 
+        }
+        while (('\0' != c[1U]) && (nullptr != std::strchr("hlLjzt", c[1U]))) { ++c; }
+        if ('\0' == c[1U]) { return false; }
+        const char conversion{*++c};
+
+        // Return false if the message holds too few arguments.
+        if (message.valueCount <= argIndex) { return false; }
+        text += formatArg(spec, conversion, message.values[argIndex++]);
+    }
+
+    // Strip the trailing new line, since messages are printed on separate lines anyway.
+    if (!text.empty() && ('\n' == text.back())) { text.pop_back(); }
+    return message.valueCount == argIndex;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+std::size_t Decoder::feed(const std::uint8_t* data, const std::size_t size)
+{
+    // Check the input parameters, return 0 if invalid.
+    if (nullptr == data) { return 0U; }
+    const std::size_t pendingMessages{myMessages.size()};
+
+    for (std::size_t i{}; i < size; ++i)
+    {
+        const std::uint8_t byte{data[i]};
+        myStatistics.receivedBytes++;
+
+        // Handle the frame on delimiter, otherwise store the byte unless the frame is too large.
+        if (utils::cobs::Delimiter == byte) { handleFrame(); }
+        else if (MaxFrameSize > myFrame.size()) { myFrame.push_back(byte); }
+        else { myOverflow = true; }
+    }
+    // Return the number of decoded messages.
+    return myMessages.size() - pendingMessages;
+}
+
+// -----------------------------------------------------------------------------
+std::size_t Decoder::feed(const std::vector<std::uint8_t>& data)
+{
+    return feed(data.data(), data.size());
+}
+
+// -----------------------------------------------------------------------------
+bool Decoder::hasMessage() const noexcept { return !myMessages.empty(); }
+
+// -----------------------------------------------------------------------------
+bool Decoder::next(Message& message)
+{
+    if (myMessages.empty()) { return false; }
+    message = myMessages.front();
+    myMessages.pop_front();
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+const Statistics& Decoder::statistics() const noexcept { return myStatistics; }
+
+// -----------------------------------------------------------------------------
+void Decoder::reset() noexcept
+{
+    myFrame.clear();
+    myMessages.clear();
+    myStatistics = {};
+    myOverflow   = false;
+}
+
+// -----------------------------------------------------------------------------
+void Decoder::handleFrame()
+{
+    // Ignore empty frames, which occur when the sender flushes with extra delimiters.
+    if (myOverflow) { myStatistics.oversizedFrames++; }
+    else if (!myFrame.empty())
+    {
+        Message message{};
+
+        if (driver::serial::Protocol::decode(myFrame.data(), myFrame.size(), message))
+        {
+            myMessages.push_back(message);
+            myStatistics.validFrames++;
+        }
+        else { myStatistics.corruptFrames++; }
+    }
+    // Start receiving the next frame.
+    myFrame.clear();
+    myOverflow = false;
+}
+
+// -----------------------------------------------------------------------------
+std::string typeName(const MessageType type)
+{
+    switch (type)
+    {
+        case MessageType::Temperature:
+            return "Temperature";
+        case MessageType::ToggleState:
+            return "ToggleState";
+        case MessageType::Log:
+            return "Log";
+        default:
+            return "Unknown";
+    }
+}
+
+// -----------------------------------------------------------------------------
+std::string format(const Message& message)
+{
+    std::ostringstream stream{};
+
+    switch (message.type)
+    {
+        case MessageType::Temperature:
+            if (1U == message.valueCount)
+            {
+                stream << "Temperature: " << message.values[0U] << " Celsius";
+                return stream.str();
+            }
+            break;
+        case MessageType::ToggleState:
+            if (1U == message.valueCount)
+            {
+                stream << "Toggle timer " << (message.values[0U] ? "enabled!" : "disabled!");
+                return stream.str();
+            }
+            break;
+        case MessageType::Log:
+        {
+            std::string text{};
+            if (formatLog(message, text)) { return text; }
+            break;
+        }
+        default:
+            break;
+    }
+
+    // Print unknown or malformed messages as the type followed by the raw values.
+    stream << typeName(message.type) << " (0x" << std::hex
+           << static_cast<unsigned>(message.type) << std::dec << "):";
+    for (std::uint8_t i{}; i < message.valueCount; ++i) { stream << ' ' << message.values[i]; }
+    return stream.str();
+}
+} // namespace protocol
+} // namespace host
@@ -0,0 +1,294 @@
+/**
+ * @brief Implementation details of the host-side hyperparameter sweep.
+ */
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <memory>
+#include <random>
+
+#include "ml/lin_reg/fixed.h"
+#include "ml/lin_reg/piecewise.h"
+#include "ml/poly_reg/fixed.h"
+#include "ml/types.h"
+#include "tuning/sweep.h"
+
+namespace host
+{
+namespace tuning
+{
+namespace
+{
+/** Error of folds that failed, which is never finite. */
+constexpr double InvalidError{std::numeric_limits<double>::quiet_NaN()};
+
+// -----------------------------------------------------------------------------
+std::unique_ptr<ml::lin_reg::Interface> train(const Config& config, const ml::Matrix1d& trainIn,
+                                              const ml::Matrix2d& trainOut)
+{
+    // Train a model of the configured type, return null on failure.
+    switch (config.model)
+    {
+        case ModelType::GradientDescent:
+        {
+            auto model{std::make_unique<ml::lin_reg::Fixed>()};
+            if (!model->train(trainIn, trainOut, config.epochCount, config.learningRate)) 
+            { 
+                return nullptr; 
+            }
+            return model;
+        }
+        case ModelType::LeastSquares:
+        {
+            auto model{std::make_unique<ml::lin_reg::Fixed>()};
+            if (!model->trainLeastSquares(trainIn, trainOut)) { return nullptr; }
+            return model;
+        }
+        case ModelType::Quadratic:
+        {
+            auto model{std::make_unique<ml::poly_reg::Fixed<2U>>()};
+            if (!model->train(trainIn, trainOut)) { return nullptr; }
+            return model;
+        }
+        case ModelType::Cubic:
+        {
+            auto model{std::make_unique<ml::poly_reg::Fixed<3U>>()};
+            if (!model->train(trainIn, trainOut)) { return nullptr; }
+            return model;
+        }
+        case ModelType::Piecewise:
+        {
+            auto model{std::make_unique<ml::lin_reg::Piecewise<4U>>()};
+            if (!model->train(trainIn, trainOut)) { return nullptr; }
+            return model;
+        }
+        default:
+            return nullptr;
+    }
+}
+
+// -----------------------------------------------------------------------------
+double validateFold(const Config& config, const std::vector<double>& trainIn,
+                    const std::vector<double>& trainOut, const std::size_t foldCount, 
+                    const std::size_t fold)
+{
+    // Train on all training sets except the ones of the fold.
+    const std::size_t setCount{std::min(trainIn.size(), trainOut.size())};
+    ml::Matrix1d foldIn{};
+    ml::Matrix2d foldOut{};
+    for (std::size_t i{}; i < setCount; ++i)
+    {
+        if (fold == i % foldCount) { continue; }
+        foldIn.pushBack(trainIn[i]);
+        foldOut.pushBack(trainOut[i]);
+    }
+    const auto model{train(config, foldIn, foldOut)};
+    if (nullptr == model) { return InvalidError; }
+
+    // Compute the mean squared error of the training sets of the fold.
+    double error{};
+    std::size_t count{};
+    for (std::size_t i{fold}; i < setCount; i += foldCount)
+    {
+        const double deviation{model->predict(trainIn[i]) - trainOut[i]};
+        error += deviation * deviation;
+        ++count;
+    }
+    return error / count;
+}
+
+// -----------------------------------------------------------------------------
+Result summarize(const Config& config, const double* errors, const std::size_t foldCount)
+{
+    Result result{config};
+    for (std::size_t i{}; i < foldCount; ++i) { result.meanError += errors[i] / foldCount; }
+    for (std::size_t i{}; i < foldCount; ++i)
+    {
+        const double deviation{errors[i] - result.meanError};
+        result.errorDeviation += deviation * deviation / foldCount;
+    }
+    result.errorDeviation = std::sqrt(result.errorDeviation);
+
+    // The mean is only finite if every fold succeeded with finite predictions.
+    result.valid = std::isfinite(result.meanError);
+    return result;
+}
+
+// -----------------------------------------------------------------------------
+bool isFoldCountValid(const std::vector<double>& trainIn, const std::vector<double>& trainOut,
+                      const std::size_t foldCount) noexcept
+{
+    return (2U <= foldCount) && (foldCount <= std::min(trainIn.size(), trainOut.size()));
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+std::string modelName(const ModelType model)
+{
+    switch (model)
+    {
+        case ModelType::GradientDescent:
+            return "GradientDescent";
+        case ModelType::LeastSquares:
+            return "LeastSquares";
+        case ModelType::Quadratic:
+            return "Quadratic";
+        case ModelType::Cubic:
+            return "Cubic";
+        case ModelType::Piecewise:
+            return "Piecewise";
+        default:
+            return "Unknown";
+    }
+}
+
+// -----------------------------------------------------------------------------
+std::vector<Config> gridConfigs(const std::vector<ModelType>& models, 
+                                const std::vector<double>& learningRates,
+                                const std::vector<std::size_t>& epochCounts)
+{
+    std::vector<Config> configs{};
+
+    for (const auto& model : models)
+    {
+        if (ModelType::GradientDescent != model) 
+        { 
+            configs.push_back({model}); 
+            continue; 
+        }
+
+        for (const auto& learningRate : learningRates)
+        {
+            for (const auto& epochCount : epochCounts) 
+            { 
+                configs.push_back({model, learningRate, epochCount}); 
+            }
+        }
+    }
+    return configs;
+}
+
+// -----------------------------------------------------------------------------
+std::vector<Config> randomConfigs(const std::size_t count, const double minLearningRate, 
+                                  const double maxLearningRate, const std::size_t minEpochCount, 
+                                  const std::size_t maxEpochCount, const std::uint32_t seed)
+{
+    // Check the ranges, return no configurations if invalid.
+    if ((0.0 >= minLearningRate) || (minLearningRate > maxLearningRate) || 
+        (0U == minEpochCount) || (minEpochCount > maxEpochCount))
+    {
+        return {};
+    }
+
+    // Draw the logarithms uniformly, so that each order of magnitude is sampled equally.
+    std::mt19937 generator{seed};
+    std::uniform_real_distribution<double> learningRate{std::log(minLearningRate), 
+                                                        std::log(maxLearningRate)};
+    std::uniform_real_distribution<double> epochCount{std::log(minEpochCount), 
+                                                      std::log(maxEpochCount + 1.0)};
+    std::vector<Config> configs{};
+
+    for (std::size_t i{}; i < count; ++i)
+    {
+        const auto epochs{static_cast<std::size_t>(std::exp(epochCount(generator)))};
+        configs.push_back({ModelType::GradientDescent, std::exp(learningRate(generator)), 
+                           std::min(std::max(epochs, minEpochCount), maxEpochCount)});
+    }
+    return configs;
+}
+
+// -----------------------------------------------------------------------------
+Result crossValidate(const Config& config, const std::vector<double>& trainIn,
+                     const std::vector<double>& trainOut, const std::size_t foldCount)
+{
+    if (!isFoldCountValid(trainIn, trainOut, foldCount)) { return Result{config}; }
+    std::vector<double> errors(foldCount);
+
+    for (std::size_t fold{}; fold < foldCount; ++fold)
+    {
+        errors[fold] = validateFold(config, trainIn, trainOut, foldCount, fold);
+    }
+    return summarize(config, errors.data(), foldCount);
+}
+
+// -----------------------------------------------------------------------------
+std::vector<Result> sweep(const std::vector<Config>& configs, const std::vector<double>& trainIn,
+                          const std::vector<double>& trainOut, const std::size_t foldCount, 
+                          concurrency::ThreadPool& pool)
+{
+    std::vector<Result> results{};
+    if (!isFoldCountValid(trainIn, trainOut, foldCount)) 
+    { 
+        for (const auto& config : configs) { results.push_back(Result{config}); }
+        return results;
+    }
+
+    // Validate each fold of each configuration in a separate task, each task writes a 
+    // separate error, so no synchronization is needed besides waiting for completion.
+    // Folds are invalid until validated, so that unfinished tasks never rank as valid.
+    std::vector<double> errors(configs.size() * foldCount, InvalidError);
+    for (std::size_t i{}; i < configs.size(); ++i)
+    {
+        for (std::size_t fold{}; fold < foldCount; ++fold)
+        {
+            pool.submit([&configs, &trainIn, &trainOut, &errors, foldCount, i, fold]()
+            {
+                errors[i * foldCount + fold] = 
+                    validateFold(configs[i], trainIn, trainOut, foldCount, fold);
+            });
+        }
+    }
+    pool.wait();
+
+    // Rank the results by ascending mean error, invalid results last.
+    for (std::size_t i{}; i < configs.size(); ++i)
+    {
+        results.push_back(summarize(configs[i], &errors[i * foldCount], foldCount));
+    }
+    std::stable_sort(results.begin(), results.end(), [](const Result& a, const Result& b)
+    {
+        return a.valid != b.valid ? a.valid : a.valid && (a.meanError < b.meanError);
+    });
+    return results;
+}
+
+// -----------------------------------------------------------------------------
+std::string formatTable(const std::vector<Result>& results, const std::size_t rowCount)
+{
+    const std::size_t count{0U < rowCount ? std::min(rowCount, results.size()) : results.size()};
+    char line[128U]{};
+    std::snprintf(line, sizeof(line), "%5s  %-16s %13s %8s %12s %12s\n", "Rank", "Model", 
+                  "Learning rate", "Epochs", "Mean MSE", "Std dev");
+    std::string table{line};
+
+    for (std::size_t i{}; i < count; ++i)
+    {
+        const Result& result{results[i]};
+        const bool isIterative{ModelType::GradientDescent == result.config.model};
+        char learningRate[16U]{"-"};
+        char epochCount[16U]{"-"};
+        if (isIterative)
+        {
+            std::snprintf(learningRate, sizeof(learningRate), "%.3g", result.config.learningRate);
+            std::snprintf(epochCount, sizeof(epochCount), "%zu", result.config.epochCount);
+        }
+
+        if (result.valid)
+        {
+            std::snprintf(line, sizeof(line), "%5zu  %-16s %13s %8s %12.5g %12.5g\n", i + 1U, 
+                          modelName(result.config.model).c_str(), learningRate, epochCount, 
+                          result.meanError, result.errorDeviation);
+        }
+        else
+        {
+            std::snprintf(line, sizeof(line), "%5zu  %-16s %13s %8s %12s %12s\n", i + 1U, 
+                          modelName(result.config.model).c_str(), learningRate, epochCount, 
+                          "failed", "-");
+        }
+        table += line;
+    }
+    return table;
+}
+} // namespace tuning
+} // namespace host
@@ -0,0 +1,191 @@
+/**
+ * @brief Command line tool for sweeping regression hyperparameters with cross-validation.
+ * 
+ *        Usage: hyperparameter_sweep [-k folds] [-r count] [-n rows] [-t threads] 
+ *                                    [-s seed] [file]
+ * 
+ *        Training data is read from the given file or from standard input if no file is 
+ *        given, one training set per line as an input value and an output value separated 
+ *        by a comma or white space, for instance "1.25, 75.0". Lines that don't start with
+ *        two numbers, such as a header, are skipped.
+ * 
+ *        By default, gradient descent is evaluated on a grid of learning rates and epoch 
+ *        counts along with the closed-form models. With -r, the given number of random 
+ *        gradient descent configurations is evaluated instead, along with the closed-form 
+ *        models. Each configuration is cross-validated with k folds (default = 5) on a
+ *        work-stealing thread pool using all cores, and the best configurations are 
+ *        printed as a ranked table (default = 20 rows, 0 for all).
+ */
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <vector>
+
+#include "concurrency/thread_pool.h"
+#include "tuning/sweep.h"
+
+namespace
+{
+/**
+ * @brief Structure of command line options.
+ */
+struct Options
+{
+    /** The number of cross-validation folds. */
+    std::size_t foldCount{5U};
+
+    /** The number of random configurations, or 0 for a grid sweep. */
+    std::size_t randomCount{0U};
+
+    /** The max number of table rows, or 0 for all results. */
+    std::size_t rowCount{20U};
+
+    /** The number of worker threads, or 0 for one per hardware thread. */
+    std::size_t threadCount{0U};
+
+    /** Seed of the random configurations. */
+    std::uint32_t seed{1U};
+
+    /** Path of the training data file, or null for standard input. */
+    const char* path{nullptr};
+};
+
+// -----------------------------------------------------------------------------
+bool parseOptions(const int argc, char** argv, Options& options)
+{
+    for (int i{1}; i < argc; ++i)
+    {
+        // Treat the last argument as the file unless it's an option.
+        if ('-' != argv[i][0U])
+        {
+            if (argc - 1 != i) { return false; }
+            options.path = argv[i];
+            continue;
+        }
+
+        // Each option takes a numeric value.
+        if ((argc - 1 == i) || ('\0' == argv[i][1U]) || ('\0' != argv[i][2U])) { return false; }
+        char* end{nullptr};
+        const unsigned long value{std::strtoul(argv[++i], &end, 10)};
+        if ('\0' != *end) { return false; }
+
+        switch (argv[i - 1][1U])
+        {
+            case 'k':
+                options.foldCount = value;
+                break;
+            case 'r':
+                options.randomCount = value;
+                break;
+            case 'n':
+                options.rowCount = value;
+                break;
+            case 't':
+                options.threadCount = value;
+                break;
+            case 's':
+                options.seed = static_cast<std::uint32_t>(value);
+                break;
+            default:
+                return false;
+        }
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+void readTrainingData(std::FILE* file, std::vector<double>& trainIn, 
+                      std::vector<double>& trainOut)
+{
+    char line[256U]{};
+
+    // Read one training set per line, skip lines without two numbers.
+    while (nullptr != std::fgets(line, sizeof(line), file))
+    {
+        for (char* c{line}; '\0' != *c; ++c) 
+        { 
+            if ((',' == *c) || (';' == *c)) { *c = ' '; } 
+        }
+        double input{};
+        double output{};
+        if (2 == std::sscanf(line, "%lf %lf", &input, &output))
+        {
+            trainIn.push_back(input);
+            trainOut.push_back(output);
+        }
+    }
+}
+} // namespace
+
+/**
+ * @brief Sweep hyperparameters on training data from a file or standard input.
+ * 
+ * @param[in] argc The number of command line arguments.
+ * @param[in] argv The command line arguments.
+ * 
+ * @return 0 on success, 1 on failure.
+ */
+int main(int argc, char** argv)
+{
+    using namespace host;
+    Options options{};
+    if (!parseOptions(argc, argv, options))
+    {
+        std::cerr << "Usage: " << argv[0U] << " [-k folds] [-r count] [-n rows] [-t threads] "
+                  << "[-s seed] [file]\n";
+        return 1;
+    }
+
+    // Open the given file, use standard input if no file is given.
+    std::FILE* input{nullptr != options.path ? std::fopen(options.path, "r") : stdin};
+    if (nullptr == input)
+    {
+        std::cerr << "Failed to open " << options.path << "!\n";
+        return 1;
+    }
+    std::vector<double> trainIn{};
+    std::vector<double> trainOut{};
+    readTrainingData(input, trainIn, trainOut);
+    if (stdin != input) { std::fclose(input); }
+
+    if ((2U > options.foldCount) || (trainIn.size() < options.foldCount))
+    {
+        std::cerr << "At least " << options.foldCount << " training sets and 2 folds are " 
+                  << "required, " << trainIn.size() << " training sets read!\n";
+        return 1;
+    }
+
+    // Combine the closed-form models with a grid or random gradient descent configurations.
+    const std::vector<tuning::ModelType> closedForm{
+        tuning::ModelType::LeastSquares, tuning::ModelType::Quadratic, 
+        tuning::ModelType::Cubic, tuning::ModelType::Piecewise};
+    std::vector<tuning::Config> configs{tuning::gridConfigs(closedForm, {}, {})};
+    const std::vector<tuning::Config> gradientDescent{0U < options.randomCount 
+        ? tuning::randomConfigs(options.randomCount, 1.0e-4, 1.0, 1U, 10000U, options.seed)
+        : tuning::gridConfigs({tuning::ModelType::GradientDescent}, 
+                              {1.0e-4, 3.0e-4, 1.0e-3, 3.0e-3, 0.01, 0.03, 0.1, 0.3, 1.0},
+                              {10U, 30U, 100U, 300U, 1000U, 3000U})};
+    configs.insert(configs.end(), gradientDescent.begin(), gradientDescent.end());
+
+    // Cross-validate all configurations in parallel and print the ranked results.
+    concurrency::ThreadPool pool{options.threadCount};
+    const auto start{std::chrono::steady_clock::now()};
+    std::vector<tuning::Result> results{};
+    try { results = tuning::sweep(configs, trainIn, trainOut, options.foldCount, pool); }
+    catch (const std::exception& exception)
+    {
+        std::cerr << "Sweep failed: " << exception.what() << "\n";
+        return 1;
+    }
+    const std::chrono::duration<double> duration{std::chrono::steady_clock::now() - start};
+
+    std::cout << tuning::formatTable(results, options.rowCount);
+    std::cerr << configs.size() << " configurations with " << options.foldCount << " folds on "
+              << trainIn.size() << " training sets evaluated in " << duration.count() 
+              << " s using " << pool.threadCount() << " threads.\n";
+    return 0;
+}
@@ -0,0 +1,97 @@
+/**
+ * @brief Command line tool for decoding binary telemetry received via the serial port.
+ * 
+ *        Usage: telemetry_decoder [file]
+ * 
+ *        Frames are read from the given file, for instance a serial device such as 
+ *        /dev/ttyACM0, or from standard input if no file is given. Serial devices are set to
+ *        raw mode with the baud rate of the firmware, so that the binary data is passed
+ *        through as is. Each decoded message is printed on a separate line.
+ */
+#include <cerrno>
+#include <cstdint>
+#include <iostream>
+
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+
+#include "protocol/decoder.h"
+
+namespace
+{
+/** Baud rate of the serial port, must match the firmware. */
+constexpr speed_t BaudRate{B9600};
+
+// -----------------------------------------------------------------------------
+bool setRawMode(const int fd, termios& settings) noexcept
+{
+    // Store the current settings, so they can be restored on exit.
+    if (0 != tcgetattr(fd, &settings)) { return false; }
+
+    // Disable all input and output processing, such as line buffering, translation of
+    // carriage returns and special characters, then set the baud rate. Block until at least
+    // one byte has been received.
+    termios raw{settings};
+    cfmakeraw(&raw);
+    raw.c_cflag |= CLOCAL | CREAD;
+    raw.c_cc[VMIN]  = 1U;
+    raw.c_cc[VTIME] = 0U;
+    return (0 == cfsetispeed(&raw, BaudRate)) && (0 == cfsetospeed(&raw, BaudRate))
+        && (0 == tcsetattr(fd, TCSANOW, &raw));
+}
+} // namespace
+
+/**
+ * @brief Decode telemetry frames from a file or standard input.
+ * 
+ * @param[in] argc The number of command line arguments.
+ * @param[in] argv The command line arguments.
+ * 
+ * @return 0 on success, 1 on failure.
+ */
+int main(int argc, char** argv)
+{
+    // Open the given file, use standard input if no file is given.
+    const int fd{1 < argc ? open(argv[1U], O_RDONLY | O_NOCTTY) : STDIN_FILENO};
+    if (0 > fd)
+    {
+        std::cerr << "Failed to open " << argv[1U] << "!\n";
+        return 1;
+    }
+
+    // Set serial devices to raw mode, since the default line discipline alters binary data.
+    termios settings{};
+    const bool isSerialDevice{(STDIN_FILENO != fd) && (1 == isatty(fd))};
+    if (isSerialDevice && !setRawMode(fd, settings))
+    {
+        std::cerr << "Failed to configure " << argv[1U] << "!\n";
+        close(fd);
+        return 1;
+    }
+
+    host::protocol::Decoder decoder{};
+    std::uint8_t buffer[256U]{};
+    ssize_t bytesRead{};
+
+    // Decode the received data chunk by chunk, print each decoded message.
+    while ((0 < (bytesRead = read(fd, buffer, sizeof(buffer)))) ||
+           ((0 > bytesRead) && (EINTR == errno)))
+    {
+        if (0 > bytesRead) { continue; }
+        decoder.feed(buffer, static_cast<std::size_t>(bytesRead));
+        host::protocol::Message message{};
+        while (decoder.next(message)) { std::cout << host::protocol::format(message) << "\n"; }
+    }
+
+    // Print the decoder statistics.
+    const auto& statistics{decoder.statistics()};
+    std::cerr << statistics.validFrames << " valid frames, " << statistics.corruptFrames 
+              << " corrupt frames, " << statistics.oversizedFrames << " oversized frames, "
+              << statistics.receivedBytes << " bytes received.\n";
+
+    // Restore the serial device settings.
+    if (isSerialDevice) { tcsetattr(fd, TCSANOW, &settings); }
+    if (STDIN_FILENO != fd) { close(fd); }
+    return 0;
+}
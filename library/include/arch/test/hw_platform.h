@@ -37,6 +37,38 @@ struct Memory
     static RegisterMemory<Size> data;
 };
 
+/** Interrupt service routine. */
+using InterruptHandler = void (*)() noexcept;
+
+/**
+ * @brief Set the interrupt service routine to run when an ADC conversion completes in sleep.
+ * 
+ *        Sleeping in ADC noise reduction mode with the ADC enabled starts a conversion, which 
+ *        completes immediately in the test platform. If the conversion-complete interrupt and 
+ *        global interrupts are enabled, the given routine is run to wake up the CPU.
+ * 
+ * @param[in] handler The interrupt service routine, or nullptr for none.
+ */
+void setAdcInterrupt(InterruptHandler handler) noexcept;
+
+/**
+ * @brief Set the interrupt service routine to run when the EEPROM is ready in sleep.
+ * 
+ *        Sleeping in idle mode completes ongoing EEPROM programming immediately in the test 
+ *        platform. If the EEPROM ready interrupt and global interrupts are enabled, the given 
+ *        routine is run to wake up the CPU.
+ * 
+ * @param[in] handler The interrupt service routine, or nullptr for none.
+ */
+void setEepromInterrupt(InterruptHandler handler) noexcept;
+
+/**
+ * @brief Get the number of times the CPU has entered sleep.
+ * 
+ * @return The number of executed sleep instructions with sleep enabled.
+ */
+std::uint32_t sleepCount() noexcept;
+
 /**
  * @brief Execute assembly command.
  * 
@@ -264,6 +296,7 @@ void delay_us(std::uint16_t us) noexcept;
 
 /** Mapping of AVR register bits and flags. */
 #define I_FLAG 7U
+#define SREG_I I_FLAG
 #define WDP0   0U
 #define WDP1   1U
 #define WDP2   2U
@@ -279,6 +312,16 @@ void delay_us(std::uint16_t us) noexcept;
 #define ADPS1  1U
 #define ADPS2  2U
 #define ADIF   4U
+#define ADIE   3U
+#define ADATE  5U
+#define ADTS0  0U
+#define ADTS1  1U
+#define ADTS2  2U
+
+#define SE     0U
+#define SM0    1U
+#define SM1    2U
+#define SM2    3U
 
 #define CS01   1U
 #define CS11   1U
@@ -298,6 +341,9 @@ void delay_us(std::uint16_t us) noexcept;
 #define EEPE  1U
 #define EEMPE 2U
 #define EERE  0U
+#define EERIE 3U
+#define EEPM0 4U
+#define EEPM1 5U
 
 /** Execute an assembly command. */
 #define asm(cmd) test::executeAssemblyCmd(cmd)
@@ -308,6 +354,18 @@ void delay_us(std::uint16_t us) noexcept;
 /** Generate delay in us. */
 #define _delay_us(us) test::delay_us(us)
 
+/** Place constant data in program memory (no-op, the test platform has a single memory). */
+#define PROGMEM
+
+/** Read a byte from program memory. */
+#define pgm_read_byte(address) (*(address))
+
+/** Read a word from program memory. */
+#define pgm_read_word(address) (*(address))
+
+/** Read a double word from program memory. */
+#define pgm_read_dword(address) (*(address))
+
 /** Implement interrupt service routines as functions. */
 #define ISR(vector) void vector() noexcept
 
@@ -0,0 +1,88 @@
+/**
+ * @brief Implementation details of container::RingBuffer class.
+ *
+ * @note Don't include this header, use <ring_buffer.h> instead!
+ */
+#pragma once
+
+namespace container
+{
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+RingBuffer<T, Capacity>::RingBuffer() noexcept
+    : myData{}
+    , myHead{}
+    , myTail{} {}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+size_t RingBuffer<T, Capacity>::size() const noexcept
+{
+    const Index head{myHead};
+    const Index tail{myTail};
+    return tail >= head ? tail - head : SlotCount - head + tail;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+size_t RingBuffer<T, Capacity>::freeSpace() const noexcept { return Capacity - size(); }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+bool RingBuffer<T, Capacity>::empty() const noexcept { return myHead == myTail; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+bool RingBuffer<T, Capacity>::full() const noexcept { return next(myTail) == myHead; }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+bool RingBuffer<T, Capacity>::push(const T& value) noexcept
+{
+    // Store the value before publishing it by moving the tail.
+    const Index tail{myTail};
+    const Index nextTail{next(tail)};
+    if (nextTail == myHead) { return false; }
+    myData[tail] = value;
+    myTail       = nextTail;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+bool RingBuffer<T, Capacity>::pop(T& value) noexcept
+{
+    // Read the value before releasing the slot by moving the head.
+    const Index head{myHead};
+    if (head == myTail) { return false; }
+    value  = myData[head];
+    myHead = next(head);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+bool RingBuffer<T, Capacity>::peek(T& value, const size_t index) const noexcept
+{
+    if (index >= size()) { return false; }
+    const size_t position{myHead + index};
+    value = myData[SlotCount > position ? position : position - SlotCount];
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+void RingBuffer<T, Capacity>::clear() noexcept
+{
+    myHead = 0U;
+    myTail = 0U;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Capacity>
+typename RingBuffer<T, Capacity>::Index
+    RingBuffer<T, Capacity>::next(const Index index) noexcept
+{
+    return SlotCount - 1U > index ? index + 1U : 0U;
+}
+} // namespace container
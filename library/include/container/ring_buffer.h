@@ -0,0 +1,136 @@
+/**
+ * @brief Implementation of static ring buffers (FIFO queues) of any type.
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace container
+{
+/**
+ * @brief Class for implementation of static ring buffers.
+ *
+ *        The ring buffer is safe to use with a single producer and a single consumer, such
+ *        as an interrupt service routine pushing values and the main loop popping values.
+ *        The indexes are eight bits wide, so that they can be read and written atomically
+ *        on 8-bit MCUs. Hence the capacity is limited to 254 elements.
+ *
+ * @tparam T The element type.
+ * @tparam Capacity The maximum number of elements the ring buffer can hold.
+ *                  Must be greater than 0 and less than 255.
+ */
+template <typename T, size_t Capacity>
+class RingBuffer
+{
+    // Generate a compiler error if the capacity is invalid. One slot is kept free, so the
+    // number of slots must fit in an eight-bit index.
+    static_assert((0U < Capacity) && (UINT8_MAX > Capacity), "Invalid ring buffer capacity!");
+
+public:
+    /**
+     * @brief Create empty ring buffer.
+     */
+    RingBuffer() noexcept;
+
+    /**
+     * @brief Delete ring buffer.
+     */
+    ~RingBuffer() noexcept = default;
+
+    /**
+     * @brief Get the capacity of the ring buffer.
+     *
+     * @return The maximum number of elements the ring buffer can hold.
+     */
+    static constexpr size_t capacity() noexcept { return Capacity; }
+
+    /**
+     * @brief Get the number of elements held by the ring buffer.
+     *
+     * @return The number of elements held by the ring buffer.
+     */
+    size_t size() const noexcept;
+
+    /**
+     * @brief Get the number of elements that can be pushed before the ring buffer is full.
+     *
+     * @return The number of free slots of the ring buffer.
+     */
+    size_t freeSpace() const noexcept;
+
+    /**
+     * @brief Check whether the ring buffer is empty.
+     *
+     * @return True if the ring buffer is empty, false otherwise.
+     */
+    bool empty() const noexcept;
+
+    /**
+     * @brief Check whether the ring buffer is full.
+     *
+     * @return True if the ring buffer is full, false otherwise.
+     */
+    bool full() const noexcept;
+
+    /**
+     * @brief Push value to the back of the ring buffer.
+     *
+     * @param[in] value The value to push.
+     *
+     * @return True if the value was pushed, false if the ring buffer is full.
+     */
+    bool push(const T& value) noexcept;
+
+    /**
+     * @brief Pop value from the front of the ring buffer.
+     *
+     * @param[out] value Reference to variable for storing the popped value.
+     *
+     * @return True if a value was popped, false if the ring buffer is empty.
+     */
+    bool pop(T& value) noexcept;
+
+    /**
+     * @brief Get value at given position from the front of the ring buffer without popping it.
+     *
+     * @param[out] value Reference to variable for storing the value.
+     * @param[in] index Position of the value, where 0 is the front (default = 0).
+     *
+     * @return True if the value exists, false otherwise.
+     */
+    bool peek(T& value, size_t index = 0U) const noexcept;
+
+    /**
+     * @brief Clear the content of the ring buffer.
+     *
+     *        Must not be called while a producer or consumer is active.
+     */
+    void clear() noexcept;
+
+    RingBuffer(const RingBuffer&)            = delete; // No copy constructor.
+    RingBuffer(RingBuffer&&)                 = delete; // No move constructor.
+    RingBuffer& operator=(const RingBuffer&) = delete; // No copy assignment.
+    RingBuffer& operator=(RingBuffer&&)      = delete; // No move assignment.
+
+private:
+    /** Index type, eight bits wide to be accessed atomically. */
+    using Index = uint8_t;
+
+    /** The number of slots, one slot is kept free to distinguish full from empty. */
+    static constexpr size_t SlotCount{Capacity + 1U};
+
+    static Index next(Index index) noexcept;
+
+    /** Statically-sized data field. */
+    T myData[SlotCount];
+
+    /** Index of the front element (written by the consumer only). */
+    volatile Index myHead;
+
+    /** Index of the next free slot (written by the producer only). */
+    volatile Index myTail;
+};
+} // namespace container
+
+#include "impl/ring_buffer_impl.h"
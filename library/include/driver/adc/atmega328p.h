@@ -30,15 +30,18 @@ public:
      */
     static Interface& getInstance() noexcept;
 
+    /** Maximum number of extra bits added by oversampling (14-bit effective resolution). */
+    static constexpr uint8_t MaxOversampling{4U};
+
     /**
-     * @brief Get the resolution of the ADC.
+     * @brief Get the resolution of the ADC, including extra bits added by oversampling.
      * 
      * @return The resolution of the ADC in bits.
      */
     uint8_t resolution() const noexcept override;
 
     /**
-     * @brief Get the maximal input value of the ADC.
+     * @brief Get the maximal input value of the ADC, including extra bits added by oversampling.
      * 
      * @return The maximum digital value of the ADC.
      */
@@ -51,9 +54,19 @@ public:
      */
     double supplyVoltage() const noexcept override;
 
+    /**
+     * @brief Get the supply voltage of the ADC.
+     * 
+     * @return The supply voltage of the ADC in millivolts.
+     */
+    uint16_t supplyVoltage_mV() const noexcept override;
+
     /**
      * @brief Read input from given channel.
      * 
+     *        When oversampling, 4^n conversions are performed per read, i.e. a read blocks for 
+     *        up to 256 conversions (about 27 ms) with 4 extra bits.
+     * 
      * @param[in] channel Channel from which to read.
      * 
      * @return The digital value corresponding to the input of the specified channel.
@@ -78,6 +91,26 @@ public:
      */
     double inputVoltage(uint8_t channel) const noexcept override;
 
+    /**
+     * @brief Read input voltage from given channel with integer arithmetic only.
+     * 
+     * @param[in] channel Channel from which to read.
+     * 
+     * @return The input voltage in millivolts, rounded to the nearest integer.
+     */
+    uint16_t inputVoltage_mV(uint8_t channel) const noexcept override;
+
+    /**
+     * @brief Read input from given channel scaled to given full-scale value with integer 
+     *        arithmetic only.
+     * 
+     * @param[in] channel Channel from which to read.
+     * @param[in] fullScale The value corresponding to the maximum digital value of the ADC.
+     * 
+     * @return The scaled input, rounded to the nearest integer.
+     */
+    uint16_t readScaled(uint8_t channel, uint16_t fullScale) const noexcept override;
+
     /**
      * @brief Check whether the ADC is initialized.
      * 
@@ -108,6 +141,177 @@ public:
      */
     bool isChannelValid(uint8_t channel) const noexcept override;
 
+    /**
+     * @brief Set the read mode used for blocking reads.
+     * 
+     *        In noise reduction mode, the CPU sleeps in ADC noise reduction mode during each 
+     *        conversion and is woken up by the conversion-complete interrupt. This reduces 
+     *        the noise induced by the CPU and the active CPU time per conversion. Global 
+     *        interrupts are enabled while sleeping, since the CPU can't wake up otherwise. 
+     *        The previous interrupt state is restored once the conversion is complete.
+     * 
+     * @param[in] mode The read mode to use.
+     * 
+     * @return True if the read mode was set, false if the read mode is invalid.
+     */
+    bool setReadMode(ReadMode mode) noexcept override;
+
+    /**
+     * @brief Get the read mode used for blocking reads.
+     * 
+     * @return The read mode in use.
+     */
+    ReadMode readMode() const noexcept override;
+
+    /**
+     * @brief Set oversampling to increase the effective resolution of the ADC.
+     * 
+     *        Each result is the sum of 4^n conversions decimated by n bits. In sampling and 
+     *        scanning mode, the conversions are accumulated by the conversion-complete 
+     *        interrupt, so the effective sample rate is divided by 4^n. When scanning, the 
+     *        first oversampled result after each multiplexer switch is discarded.
+     *        Must not be called while sampling or scanning.
+     * 
+     * @param[in] extraBits The number of extra bits n [0, MaxOversampling].
+     * 
+     * @return True if oversampling was set, false if the number of extra bits is too high
+     *         or if sampling, scanning or a single conversion is active.
+     */
+    bool setOversampling(uint8_t extraBits) noexcept override;
+
+    /**
+     * @brief Get the number of extra bits added by oversampling.
+     * 
+     * @return The number of extra bits (0 = no oversampling).
+     */
+    uint8_t oversampling() const noexcept override;
+
+    /**
+     * @brief Normalize given channel, i.e. convert port number [C0:C5] to channel [A0:A5].
+     * 
+     * @param[in] channel The channel to normalize. Must be valid.
+     * 
+     * @return The normalized channel.
+     */
+    uint8_t normalizeChannel(uint8_t channel) const noexcept override;
+
+    /**
+     * @brief Start a single conversion of given channel without blocking.
+     * 
+     *        The result is stored by the conversion-complete interrupt and fetched via 
+     *        readConversion(). When oversampling, the interrupt starts the next conversion 
+     *        until 4^n conversions have been accumulated, so the CPU is only occupied for a 
+     *        few microseconds per conversion instead of blocking for 104 us.
+     * 
+     *        Blocking reads are unavailable during the conversion, in which case read() 
+     *        returns 0.
+     * 
+     *        The global interrupt state is left unchanged, so this can be called from an 
+     *        interrupt service routine. Global interrupts must be enabled for the result to 
+     *        be stored.
+     * 
+     * @param[in] channel Channel to convert.
+     * 
+     * @return True if the conversion was started, false if the ADC is disabled, the channel 
+     *         is invalid or if sampling or another conversion is ongoing.
+     */
+    bool startConversion(uint8_t channel) noexcept override;
+
+    /**
+     * @brief Check whether a conversion started via startConversion() is ongoing.
+     * 
+     * @return True if the conversion is ongoing, false otherwise.
+     */
+    bool isConverting() const noexcept override;
+
+    /**
+     * @brief Read the result of a conversion started via startConversion() without blocking.
+     * 
+     *        Each result can only be read once.
+     * 
+     * @param[out] value Reference to variable for storing the result.
+     * 
+     * @return True if a result was read, false if no completed conversion is pending.
+     */
+    bool readConversion(uint16_t& value) noexcept override;
+
+    /**
+     * @brief Start continuous sampling of given channel.
+     * 
+     *        Conversions are started automatically by the given trigger source. Each result is 
+     *        stored in a sample buffer by the conversion-complete interrupt, from which the 
+     *        samples can be consumed without blocking via readSample(). Samples are dropped if 
+     *        the buffer is full.
+     * 
+     *        In free running mode, a conversion is completed every 104 us. The Timer 0 
+     *        overflow trigger starts a conversion every 128 us, but requires Timer 0 to be 
+     *        running, i.e. the first timer::Atmega328p instance must be started. Otherwise 
+     *        its interrupt doesn't clear the overflow flag, so no further conversions are 
+     *        triggered. The compare match and Timer 1 triggers of the hardware aren't 
+     *        supported, since the timer driver doesn't clear the corresponding flags.
+     * 
+     *        The global interrupt state is left unchanged. Global interrupts must be enabled 
+     *        for samples to be stored.
+     * 
+     * @param[in] channel Channel to sample.
+     * @param[in] trigger Trigger source for starting conversions (default = free running).
+     * 
+     * @return True if sampling was started, false if the ADC is disabled, the channel or the 
+     *         trigger is invalid or if a single conversion is ongoing.
+     */
+    bool startSampling(uint8_t channel, Trigger trigger = Trigger::FreeRunning) noexcept override;
+
+    /**
+     * @brief Start scanning the channels of given sequencer.
+     * 
+     *        Conversions are started automatically by the given trigger source. The 
+     *        conversion-complete interrupt passes each result to the sequencer and switches 
+     *        the multiplexer to the next channel, see Sequencer. Scanning is stopped via 
+     *        stopSampling(). The global interrupt state is left unchanged.
+     * 
+     * @param[in] sequencer The sequencer holding the channels to scan. Must outlive the scan.
+     * @param[in] trigger Trigger source for starting conversions (default = free running).
+     * 
+     * @return True if scanning was started, false if the ADC is disabled, the sequencer 
+     *         holds no channels, the trigger is invalid or if a single conversion is ongoing.
+     */
+    bool startScan(Sequencer& sequencer, Trigger trigger = Trigger::FreeRunning) noexcept override;
+
+    /**
+     * @brief Stop continuous sampling or scanning. Samples in the sample buffer are kept.
+     */
+    void stopSampling() noexcept override;
+
+    /**
+     * @brief Check whether continuous sampling or scanning is active.
+     * 
+     * @return True if continuous sampling or scanning is active, false otherwise.
+     */
+    bool isSampling() const noexcept override;
+
+    /**
+     * @brief Read the oldest sample from the sample buffer without blocking.
+     * 
+     * @param[out] sample Reference to variable for storing the sample.
+     * 
+     * @return True if a sample was read, false if the sample buffer is empty.
+     */
+    bool readSample(uint16_t& sample) noexcept override;
+
+    /**
+     * @brief Get the number of samples waiting in the sample buffer.
+     * 
+     * @return The number of pending samples.
+     */
+    uint16_t pendingSamples() const noexcept override;
+
+    /**
+     * @brief Get the number of samples dropped due to a full sample buffer.
+     * 
+     * @return The number of dropped samples since sampling was started.
+     */
+    uint16_t droppedSamples() const noexcept override;
+
     Atmega328p(const Atmega328p&)            = delete; // No copy constructor.
     Atmega328p(Atmega328p&&)                 = delete; // No move constructor.
     Atmega328p& operator=(const Atmega328p&) = delete; // No copy assignment.
@@ -116,9 +320,13 @@ public:
 private:
     Atmega328p() noexcept;
     ~Atmega328p() noexcept override = default;
+    void startAutoTrigger(uint8_t channel, Trigger trigger) noexcept;
 
     /** Indicate whether the ADC is enabled. */
     bool myEnabled;
+
+    /** Read mode used for blocking reads. */
+    ReadMode myReadMode;
 };
 
 /**
@@ -10,6 +10,59 @@ namespace driver
 {
 namespace adc
 {
+/** Multi-channel scan sequencer. */
+class Sequencer;
+
+/**
+ * @brief Enumeration of auto trigger sources for continuous sampling.
+ */
+enum class Trigger : uint8_t
+{
+    FreeRunning,    // Start a new conversion as soon as the previous one is complete.
+    Timer0Overflow, // Start a conversion on Timer 0 overflow.
+    Count,          // Number of supported trigger sources.
+};
+
+/**
+ * @brief Enumeration of read modes for blocking reads.
+ */
+enum class ReadMode : uint8_t
+{
+    Polling,        // Busy-wait for the conversion to complete.
+    NoiseReduction, // Sleep in ADC noise reduction mode until the conversion is complete.
+    Count,          // Number of supported read modes.
+};
+
+/**
+ * @brief Scale given ADC value to given full-scale value with integer arithmetic only.
+ * 
+ *        The maximum value of an n-bit ADC is 2^n - 1. The division by the maximum value is
+ *        therefore estimated with shifts and corrected with a single subtraction, which 
+ *        avoids costly 32-bit divisions on 8-bit MCUs.
+ * 
+ * @param[in] value The ADC value [0, 2^n - 1].
+ * @param[in] fullScale The value corresponding to the maximum ADC value. The product of 
+ *                      the value and the full-scale value must be less than 2^31.
+ * @param[in] resolution The ADC resolution n in bits [8, 16].
+ * 
+ * @return The scaled value value * fullScale / (2^n - 1), rounded to the nearest integer.
+ */
+constexpr uint16_t scale(const uint16_t value, const uint16_t fullScale, 
+                         const uint8_t resolution) noexcept
+{
+    const uint32_t maxValue{(static_cast<uint32_t>(1U) << resolution) - 1U};
+    const uint32_t product{static_cast<uint32_t>(value) * fullScale + maxValue / 2U};
+
+    // Estimate product / (2^n - 1) = product / 2^n * (1 + 2^-n + 2^-2n + ...) from below.
+    // The third term is always 0 for 16 bits, where shifting by 2n would be undefined.
+    const uint32_t thirdTerm{32U > 2U * resolution ? product >> (2U * resolution) : 0U};
+    uint32_t quotient{(product + (product >> resolution) + thirdTerm) >> resolution};
+
+    // Correct the estimate, which is at most one too low.
+    if (product - quotient * maxValue >= maxValue) { ++quotient; }
+    return static_cast<uint16_t>(quotient);
+}
+
 /**
  * @brief ADC (A/D converter) interface.
  */
@@ -42,6 +95,13 @@ public:
      */
     virtual double supplyVoltage() const noexcept = 0;
 
+    /**
+     * @brief Get the supply voltage of the ADC.
+     * 
+     * @return The supply voltage of the ADC in millivolts.
+     */
+    virtual uint16_t supplyVoltage_mV() const noexcept = 0;
+
     /**
      * @brief Read input from given channel.
      * 
@@ -69,6 +129,29 @@ public:
      */
     virtual double inputVoltage(uint8_t channel) const noexcept = 0;
 
+    /**
+     * @brief Read input voltage from given channel with integer arithmetic only.
+     * 
+     * @param[in] channel Channel from which to read.
+     * 
+     * @return The input voltage in millivolts, rounded to the nearest integer.
+     */
+    virtual uint16_t inputVoltage_mV(uint8_t channel) const noexcept = 0;
+
+    /**
+     * @brief Read input from given channel scaled to given full-scale value with integer 
+     *        arithmetic only.
+     * 
+     *        Use this variant for fixed-point conversions, for instance a full-scale value of
+     *        50000 yields the input voltage in units of 0.1 mV.
+     * 
+     * @param[in] channel Channel from which to read.
+     * @param[in] fullScale The value corresponding to the maximum digital value of the ADC.
+     * 
+     * @return The scaled input, rounded to the nearest integer.
+     */
+    virtual uint16_t readScaled(uint8_t channel, uint16_t fullScale) const noexcept = 0;
+
     /**
      * @brief Check whether the ADC is initialized.
      * 
@@ -90,6 +173,43 @@ public:
      */
     virtual void setEnabled(bool enable) noexcept = 0;
 
+    /**
+     * @brief Set the read mode used for blocking reads.
+     * 
+     * @param[in] mode The read mode to use.
+     * 
+     * @return True if the read mode was set, false if the read mode is invalid.
+     */
+    virtual bool setReadMode(ReadMode mode) noexcept = 0;
+
+    /**
+     * @brief Get the read mode used for blocking reads.
+     * 
+     * @return The read mode in use.
+     */
+    virtual ReadMode readMode() const noexcept = 0;
+
+    /**
+     * @brief Set oversampling to increase the effective resolution of the ADC.
+     * 
+     *        Each result is the sum of 4^n conversions decimated by n bits, which adds n bits 
+     *        of resolution. resolution() and maxValue() report the effective resolution.
+     *        Must not be called while sampling or scanning.
+     * 
+     * @param[in] extraBits The number of extra bits n (0 = no oversampling).
+     * 
+     * @return True if oversampling was set, false if the number of extra bits isn't supported
+     *         or if sampling or scanning is active.
+     */
+    virtual bool setOversampling(uint8_t extraBits) noexcept = 0;
+
+    /**
+     * @brief Get the number of extra bits added by oversampling.
+     * 
+     * @return The number of extra bits (0 = no oversampling).
+     */
+    virtual uint8_t oversampling() const noexcept = 0;
+
     /**
      * @brief Check whether the given channel is valid.
      * 
@@ -98,6 +218,118 @@ public:
      * @return True if the channel is valid, false otherwise.
      */
     virtual bool isChannelValid(uint8_t channel) const noexcept = 0;
+
+    /**
+     * @brief Normalize given channel, i.e. convert pin or port number to multiplexer channel.
+     * 
+     * @param[in] channel The channel to normalize. Must be valid.
+     * 
+     * @return The normalized channel.
+     */
+    virtual uint8_t normalizeChannel(uint8_t channel) const noexcept = 0;
+
+    /**
+     * @brief Start a single conversion of given channel without blocking.
+     * 
+     *        The result is stored by the conversion-complete interrupt and fetched via 
+     *        readConversion(). When oversampling, all 4^n conversions are performed by the 
+     *        interrupt before the result is stored.
+     * 
+     * @param[in] channel Channel to convert.
+     * 
+     * @return True if the conversion was started, false if the ADC is disabled, the channel 
+     *         is invalid or if sampling or another conversion is ongoing.
+     */
+    virtual bool startConversion(uint8_t channel) noexcept = 0;
+
+    /**
+     * @brief Check whether a conversion started via startConversion() is ongoing.
+     * 
+     * @return True if the conversion is ongoing, false otherwise.
+     */
+    virtual bool isConverting() const noexcept = 0;
+
+    /**
+     * @brief Read the result of a conversion started via startConversion() without blocking.
+     * 
+     *        Each result can only be read once.
+     * 
+     * @param[out] value Reference to variable for storing the result.
+     * 
+     * @return True if a result was read, false if no completed conversion is pending.
+     */
+    virtual bool readConversion(uint16_t& value) noexcept = 0;
+
+    /**
+     * @brief Start continuous sampling of given channel.
+     * 
+     *        Conversions are started automatically by the given trigger source. Each result is 
+     *        stored in a sample buffer by the conversion-complete interrupt, from which the 
+     *        samples can be consumed without blocking via readSample(). Samples are dropped if 
+     *        the buffer is full.
+     * 
+     *        Blocking reads are unavailable while sampling, in which case read() returns 0.
+     * 
+     * @param[in] channel Channel to sample.
+     * @param[in] trigger Trigger source for starting conversions (default = free running).
+     * 
+     * @return True if sampling was started, false if the ADC is disabled or if the channel
+     *         or the trigger is invalid.
+     */
+    virtual bool startSampling(uint8_t channel, 
+                               Trigger trigger = Trigger::FreeRunning) noexcept = 0;
+
+    /**
+     * @brief Start scanning the channels of given sequencer.
+     * 
+     *        Conversions are started automatically by the given trigger source. The 
+     *        conversion-complete interrupt passes each result to the sequencer, which selects 
+     *        the next channel and publishes a snapshot once all channels have been converted.
+     *        Scanning is stopped via stopSampling().
+     * 
+     * @param[in] sequencer The sequencer holding the channels to scan. Must outlive the scan.
+     * @param[in] trigger Trigger source for starting conversions (default = free running).
+     * 
+     * @return True if scanning was started, false if the ADC is disabled, the sequencer 
+     *         holds no channels or if the trigger is invalid.
+     */
+    virtual bool startScan(Sequencer& sequencer, 
+                           Trigger trigger = Trigger::FreeRunning) noexcept = 0;
+
+    /**
+     * @brief Stop continuous sampling or scanning. Samples in the sample buffer are kept.
+     */
+    virtual void stopSampling() noexcept = 0;
+
+    /**
+     * @brief Check whether continuous sampling or scanning is active.
+     * 
+     * @return True if continuous sampling or scanning is active, false otherwise.
+     */
+    virtual bool isSampling() const noexcept = 0;
+
+    /**
+     * @brief Read the oldest sample from the sample buffer without blocking.
+     * 
+     * @param[out] sample Reference to variable for storing the sample.
+     * 
+     * @return True if a sample was read, false if the sample buffer is empty.
+     */
+    virtual bool readSample(uint16_t& sample) noexcept = 0;
+
+    /**
+     * @brief Get the number of samples waiting in the sample buffer.
+     * 
+     * @return The number of pending samples.
+     */
+    virtual uint16_t pendingSamples() const noexcept = 0;
+
+    /**
+     * @brief Get the number of samples dropped due to a full sample buffer.
+     * 
+     * @return The number of dropped samples since sampling was started.
+     */
+    virtual uint16_t droppedSamples() const noexcept = 0;
 };
 } // namespace adc
 } // namespace driver
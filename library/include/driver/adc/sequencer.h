@@ -0,0 +1,142 @@
+/**
+ * @brief Multi-channel ADC scan sequencer.
+ */
+#pragma once
+
+#include <stdint.h>
+
+namespace driver
+{
+namespace adc
+{
+/** ADC (A/D converter) interface. */
+class Interface;
+
+/**
+ * @brief Multi-channel ADC scan sequencer.
+ * 
+ *        The sequencer holds a list of channels, which are converted one after another by 
+ *        the conversion-complete interrupt of the ADC, see Interface::startScan. After each 
+ *        multiplexer switch, the first conversion is discarded, since it was started before 
+ *        the new channel was selected. Once all channels have been converted, the results are 
+ *        published as a coherent snapshot, which can be read at any time from the main loop.
+ * 
+ *        This class is non-copyable and non-movable.
+ */
+class Sequencer
+{
+public:
+    /** Maximum number of channels per scan. */
+    static constexpr uint8_t MaxChannelCount{8U};
+
+    /**
+     * @brief Structure of a snapshot holding the results of a complete scan.
+     */
+    struct Snapshot
+    {
+        /** Conversion results, in the order of the channel list. */
+        uint16_t values[MaxChannelCount];
+
+        /** The number of channels. */
+        uint8_t channelCount;
+
+        /** Sequence number of the scan, incremented for every complete scan. */
+        uint16_t sequence;
+    };
+
+    /**
+     * @brief Constructor.
+     * 
+     * @param[in] adc The ADC used for validating and normalizing channels.
+     */
+    explicit Sequencer(const Interface& adc) noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~Sequencer() noexcept = default;
+
+    /**
+     * @brief Set the channels to scan. 
+     * 
+     *        Must not be called while scanning. Pin and port numbers are accepted, the channels
+     *        are normalized by the ADC. Published snapshots are discarded.
+     * 
+     * @param[in] channels The channels to scan.
+     * @param[in] channelCount The number of channels.
+     * 
+     * @return True if the channels were set, false if any channel is invalid or if the 
+     *         number of channels is invalid.
+     */
+    bool setChannels(const uint8_t* channels, uint8_t channelCount) noexcept;
+
+    /**
+     * @brief Get the number of channels to scan.
+     * 
+     * @return The number of channels.
+     */
+    uint8_t channelCount() const noexcept;
+
+    /**
+     * @brief Get the normalized channel to convert next.
+     * 
+     * @return The channel to convert next.
+     */
+    uint8_t currentChannel() const noexcept;
+
+    /**
+     * @brief Handle a completed conversion. Called by the conversion-complete interrupt.
+     * 
+     * @param[in] value The conversion result.
+     * 
+     * @return True if the multiplexer must be switched to currentChannel(), false otherwise.
+     */
+    bool handleConversion(uint16_t value) noexcept;
+
+    /**
+     * @brief Get the latest published snapshot.
+     * 
+     * @param[out] snapshot Reference to snapshot for storing the published results.
+     * 
+     * @return True if a complete scan has been published, false otherwise.
+     */
+    bool snapshot(Snapshot& snapshot) const noexcept;
+
+    /**
+     * @brief Restart the scan from the first channel and discard published snapshots.
+     */
+    void reset() noexcept;
+
+    Sequencer()                            = delete; // No default constructor.
+    Sequencer(const Sequencer&)            = delete; // No copy constructor.
+    Sequencer(Sequencer&&)                 = delete; // No move constructor.
+    Sequencer& operator=(const Sequencer&) = delete; // No copy assignment.
+    Sequencer& operator=(Sequencer&&)      = delete; // No move assignment.
+
+private:
+    /** The ADC used for validating and normalizing channels. */
+    const Interface& myAdc;
+
+    /** Normalized channels to scan. */
+    uint8_t myChannels[MaxChannelCount];
+
+    /** Results of the ongoing scan. */
+    uint16_t myResults[MaxChannelCount];
+
+    /** Published results of the latest complete scan. */
+    uint16_t myPublished[MaxChannelCount];
+
+    /** Sequence number of the latest complete scan. */
+    volatile uint16_t mySequence;
+
+    /** The number of channels to scan. */
+    uint8_t myChannelCount;
+
+    /** Index of the channel to convert next. */
+    volatile uint8_t myIndex;
+
+    /** Indicate whether the next conversion shall be discarded after a multiplexer switch. */
+    volatile bool myDiscard;
+};
+} // namespace adc
+} // namespace driver
@@ -6,7 +6,10 @@
 #include <math.h>
 #include <stdint.h>
 
+#include "container/ring_buffer.h"
 #include "driver/adc/interface.h"
+#include "driver/adc/sequencer.h"
+#include "utils/utils.h"
 
 namespace driver 
 {
@@ -20,6 +23,9 @@ namespace adc
 class Stub final : public Interface
 {
 public:
+    /** Size of the simulated sample buffer. */
+    static constexpr size_t SampleBufferSize{32U};
+
     /**
      * @brief Create a new ADC stub.
      * 
@@ -28,12 +34,23 @@ public:
      */
     explicit Stub(const uint8_t resolution = 10U, const double supplyVoltage = 5.0) noexcept
         : mySupplyVoltage{supplyVoltage}
+        , mySupplyVoltage_mV{utils::round<uint16_t>(supplyVoltage * 1000.0)}
         , myMaxVal{static_cast<uint16_t>(pow(2U, resolution) - 1U)}
         , myAdcVal{}
         , myResolution{resolution}
         , myInitialized{true}
         , myEnabled{true}
         , myChannelValid{true}
+        , mySamples{}
+        , myDroppedSamples{}
+        , mySampling{false}
+        , myConverting{false}
+        , myConversionReady{false}
+        , myConversionResult{}
+        , myScan{nullptr}
+        , myChannel{}
+        , myOversampling{}
+        , myReadMode{ReadMode::Polling}
     {}
 
     /**
@@ -46,14 +63,17 @@ public:
      * 
      * @return The resolution of the ADC in bits.
      */
-    uint8_t resolution() const noexcept override { return myResolution; }
+    uint8_t resolution() const noexcept override { return myResolution + myOversampling; }
 
     /**
      * @brief Get the maximal input value of the ADC.
      * 
      * @return The maximum digital value of the ADC.
      */
-    uint16_t maxValue() const noexcept override { return myMaxVal; }
+    uint16_t maxValue() const noexcept override 
+    { 
+        return static_cast<uint16_t>(((myMaxVal + 1UL) << myOversampling) - 1U); 
+    }
 
     /**
      * @brief Get the supply voltage of the ADC.
@@ -62,6 +82,13 @@ public:
      */
     double supplyVoltage() const noexcept override { return mySupplyVoltage; }
 
+    /**
+     * @brief Get the supply voltage of the ADC.
+     * 
+     * @return The supply voltage of the ADC in millivolts.
+     */
+    uint16_t supplyVoltage_mV() const noexcept override { return mySupplyVoltage_mV; }
+
     /**
      * @brief Read input from given channel.
      * 
@@ -72,7 +99,7 @@ public:
     uint16_t read(const uint8_t channel) const noexcept override 
     { 
         (void) (channel);
-        return myEnabled ? myAdcVal : 0U; 
+        return myEnabled && !mySampling && !myConverting ? myAdcVal : 0U; 
     }
 
     /**
@@ -85,7 +112,7 @@ public:
     double dutyCycle(const uint8_t channel) const noexcept override 
     { 
         // Enforce floating-point division.
-        return read(channel) / static_cast<double>(myMaxVal);
+        return read(channel) / static_cast<double>(maxValue());
     }
 
     /**
@@ -100,6 +127,32 @@ public:
         return dutyCycle(channel) * mySupplyVoltage;
     }
 
+    /**
+     * @brief Read input voltage from given channel with integer arithmetic only.
+     * 
+     * @param[in] channel Channel from which to read.
+     * 
+     * @return The input voltage in millivolts, rounded to the nearest integer.
+     */
+    uint16_t inputVoltage_mV(const uint8_t channel) const noexcept override
+    {
+        return readScaled(channel, mySupplyVoltage_mV);
+    }
+
+    /**
+     * @brief Read input from given channel scaled to given full-scale value with integer 
+     *        arithmetic only.
+     * 
+     * @param[in] channel Channel from which to read.
+     * @param[in] fullScale The value corresponding to the maximum digital value of the ADC.
+     * 
+     * @return The scaled input, rounded to the nearest integer.
+     */
+    uint16_t readScaled(const uint8_t channel, const uint16_t fullScale) const noexcept override
+    {
+        return scale(read(channel), fullScale, resolution());
+    }
+
     /**
      * @brief Check whether the ADC is initialized.
      * 
@@ -141,6 +194,235 @@ public:
      */
     void setChannelValidity(const bool valid) noexcept { myChannelValid = valid; }
 
+    /**
+     * @brief Set the read mode used for blocking reads. The stub reads the same way in 
+     *        all modes.
+     * 
+     * @param[in] mode The read mode to use.
+     * 
+     * @return True if the read mode was set, false if the read mode is invalid.
+     */
+    bool setReadMode(const ReadMode mode) noexcept override
+    {
+        // Check the input parameter, return false if invalid.
+        if (ReadMode::Count <= mode) { return false; }
+        myReadMode = mode;
+        return true;
+    }
+
+    /**
+     * @brief Get the read mode used for blocking reads.
+     * 
+     * @return The read mode in use.
+     */
+    ReadMode readMode() const noexcept override { return myReadMode; }
+
+    /**
+     * @brief Set oversampling to increase the effective resolution of the ADC.
+     * 
+     *        The stub only adjusts the reported resolution, the ADC value is set directly 
+     *        via setValue().
+     * 
+     * @param[in] extraBits The number of extra bits, the effective resolution can't 
+     *                      exceed 16 bits.
+     * 
+     * @return True if oversampling was set, false if the number of extra bits is too high 
+     *         or if sampling is active.
+     */
+    bool setOversampling(const uint8_t extraBits) noexcept override
+    {
+        // Check the input parameter, return false if invalid or if sampling is active.
+        if ((16U < myResolution + extraBits) || mySampling) { return false; }
+        myOversampling = extraBits;
+        return true;
+    }
+
+    /**
+     * @brief Get the number of extra bits added by oversampling.
+     * 
+     * @return The number of extra bits (0 = no oversampling).
+     */
+    uint8_t oversampling() const noexcept override { return myOversampling; }
+
+    /**
+     * @brief Normalize given channel. The stub keeps the channel as is.
+     * 
+     * @param[in] channel The channel to normalize.
+     * 
+     * @return The normalized channel.
+     */
+    uint8_t normalizeChannel(const uint8_t channel) const noexcept override { return channel; }
+
+    /**
+     * @brief Start a single conversion of given channel without blocking.
+     * 
+     *        The conversion is completed by calling convert().
+     * 
+     * @param[in] channel Channel to convert.
+     * 
+     * @return True if the conversion was started, false if the ADC is disabled, the channel 
+     *         is invalid or if sampling or another conversion is ongoing.
+     */
+    bool startConversion(const uint8_t channel) noexcept override
+    {
+        // Check the input parameter, return false if invalid or if the ADC is busy or disabled.
+        if (!myEnabled || !isChannelValid(channel) || mySampling || myConverting) 
+        { 
+            return false; 
+        }
+        myChannel         = channel;
+        myConversionReady = false;
+        myConverting      = true;
+        return true;
+    }
+
+    /**
+     * @brief Check whether a conversion started via startConversion() is ongoing.
+     * 
+     * @return True if the conversion is ongoing, false otherwise.
+     */
+    bool isConverting() const noexcept override { return myConverting; }
+
+    /**
+     * @brief Read the result of a conversion started via startConversion() without blocking.
+     * 
+     * @param[out] value Reference to variable for storing the result.
+     * 
+     * @return True if a result was read, false if no completed conversion is pending.
+     */
+    bool readConversion(uint16_t& value) noexcept override
+    {
+        if (!myConversionReady) { return false; }
+        value             = myConversionResult;
+        myConversionReady = false;
+        return true;
+    }
+
+    /**
+     * @brief Start continuous sampling of given channel.
+     * 
+     *        Conversions are simulated by calling convert().
+     * 
+     * @param[in] channel Channel to sample.
+     * @param[in] trigger Trigger source for starting conversions (default = free running).
+     * 
+     * @return True if sampling was started, false if the ADC is disabled or if the channel
+     *         or the trigger is invalid.
+     */
+    bool startSampling(const uint8_t channel, 
+                       const Trigger trigger = Trigger::FreeRunning) noexcept override
+    {
+        // Check the input parameters, return false if invalid or if the ADC is disabled.
+        if (!myEnabled || !isChannelValid(channel) || (Trigger::Count <= trigger) || 
+            myConverting) 
+        { 
+            return false; 
+        }
+        mySamples.clear();
+        myDroppedSamples = 0U;
+        mySampling       = true;
+        return true;
+    }
+
+    /**
+     * @brief Start scanning the channels of given sequencer.
+     * 
+     *        Conversions are simulated by calling convert().
+     * 
+     * @param[in] sequencer The sequencer holding the channels to scan.
+     * @param[in] trigger Trigger source for starting conversions (default = free running).
+     * 
+     * @return True if scanning was started, false if the ADC is disabled, the sequencer 
+     *         holds no channels or if the trigger is invalid.
+     */
+    bool startScan(Sequencer& sequencer, 
+                   const Trigger trigger = Trigger::FreeRunning) noexcept override
+    {
+        // Check the input parameters, return false if invalid or if the ADC is disabled.
+        if (!myEnabled || (0U == sequencer.channelCount()) || (Trigger::Count <= trigger) || 
+            myConverting) 
+        { 
+            return false; 
+        }
+        sequencer.reset();
+        myScan     = &sequencer;
+        myChannel  = sequencer.currentChannel();
+        mySampling = true;
+        return true;
+    }
+
+    /**
+     * @brief Stop continuous sampling or scanning. Samples in the sample buffer are kept.
+     */
+    void stopSampling() noexcept override 
+    { 
+        mySampling = false; 
+        myScan     = nullptr;
+    }
+
+    /**
+     * @brief Check whether continuous sampling or scanning is active.
+     * 
+     * @return True if continuous sampling or scanning is active, false otherwise.
+     */
+    bool isSampling() const noexcept override { return mySampling; }
+
+    /**
+     * @brief Read the oldest sample from the sample buffer without blocking.
+     * 
+     * @param[out] sample Reference to variable for storing the sample.
+     * 
+     * @return True if a sample was read, false if the sample buffer is empty.
+     */
+    bool readSample(uint16_t& sample) noexcept override { return mySamples.pop(sample); }
+
+    /**
+     * @brief Get the number of samples waiting in the sample buffer.
+     * 
+     * @return The number of pending samples.
+     */
+    uint16_t pendingSamples() const noexcept override 
+    { 
+        return static_cast<uint16_t>(mySamples.size()); 
+    }
+
+    /**
+     * @brief Get the number of samples dropped due to a full sample buffer.
+     * 
+     * @return The number of dropped samples since sampling was started.
+     */
+    uint16_t droppedSamples() const noexcept override { return myDroppedSamples; }
+
+    /**
+     * @brief Simulate a completed conversion.
+     * 
+     *        The current ADC value is stored as the result of an ongoing single conversion. 
+     *        Otherwise, it is stored in the sample buffer, or passed to the sequencer when 
+     *        scanning. 
+     * 
+     * @return True if the value was stored or passed to the sequencer, false if the ADC is 
+     *         idle or if the buffer is full.
+     */
+    bool convert() noexcept
+    {
+        if (myConverting)
+        {
+            myConversionResult = myAdcVal;
+            myConversionReady  = true;
+            myConverting       = false;
+            return true;
+        }
+        if (!mySampling) { return false; }
+        if (nullptr != myScan)
+        {
+            if (myScan->handleConversion(myAdcVal)) { myChannel = myScan->currentChannel(); }
+            return true;
+        }
+        if (mySamples.push(myAdcVal)) { return true; }
+        myDroppedSamples++;
+        return false;
+    }
+
     /**
      * @brief Set the ADC value (virtual input).
      * 
@@ -149,9 +431,16 @@ public:
     void setValue(const uint16_t value) noexcept
     {
         // Set the ADC value if valid.
-        if (myMaxVal >= value) { myAdcVal = value; }
+        if (maxValue() >= value) { myAdcVal = value; }
     }
 
+    /**
+     * @brief Get the channel selected by the simulated multiplexer.
+     * 
+     * @return The selected channel.
+     */
+    uint8_t selectedChannel() const noexcept { return myChannel; }
+
     /**
      * @brief Set initialization status of the ADC.
      * 
@@ -168,6 +457,9 @@ private:
     /** Supply voltage. */
     const double mySupplyVoltage;
 
+    /** Supply voltage in millivolts. */
+    const uint16_t mySupplyVoltage_mV;
+
     /** ADC max value. */
     const uint16_t myMaxVal;
 
@@ -185,6 +477,36 @@ private:
 
     /** Channel validity (all channels). */
     bool myChannelValid;
+
+    /** Simulated sample buffer. */
+    container::RingBuffer<uint16_t, SampleBufferSize> mySamples;
+
+    /** The number of samples dropped due to a full sample buffer. */
+    uint16_t myDroppedSamples;
+
+    /** Indicate whether continuous sampling or scanning is active. */
+    bool mySampling;
+
+    /** Indicate whether a single conversion is ongoing. */
+    bool myConverting;
+
+    /** Indicate whether the result of a single conversion is pending. */
+    bool myConversionReady;
+
+    /** Result of the last single conversion. */
+    uint16_t myConversionResult;
+
+    /** Sequencer of the ongoing scan, or nullptr if not scanning. */
+    Sequencer* myScan;
+
+    /** Channel selected by the simulated multiplexer. */
+    uint8_t myChannel;
+
+    /** The number of extra bits added by oversampling. */
+    uint8_t myOversampling;
+
+    /** Read mode used for blocking reads. */
+    ReadMode myReadMode;
 };
 } // namespace adc
 } // namespace driver
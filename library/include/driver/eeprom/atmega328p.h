@@ -55,6 +55,41 @@ public:
      */
     void setEnabled(bool enable) noexcept override;
 
+    /**
+     * @brief Write bytes to given address in EEPROM without waiting for the programming.
+     * 
+     *        The bytes are queued and programmed one at a time by the EEPROM ready interrupt,
+     *        so the caller isn't blocked for 3.4 ms per byte. Only changed bytes are 
+     *        programmed, see write(). Reads of pending addresses return the queued data.
+     * 
+     * @param[in] address The destination address.
+     * @param[in] data The bytes to write.
+     * @param[in] size The number of bytes to write.
+     * @param[in] callback Callback invoked from the EEPROM ready interrupt once all bytes 
+     *                     are written (default = none).
+     * 
+     * @return True if the bytes were queued, false if the address is invalid, the EEPROM 
+     *         stream isn't enabled or if the write queue can't hold all bytes.
+     */
+    bool writeAsync(uint16_t address, const uint8_t* data, uint8_t size, 
+                    WriteCallback callback = nullptr) noexcept override;
+
+    /**
+     * @brief Check whether asynchronous writes are pending.
+     * 
+     * @return True if bytes are queued or being programmed, false otherwise.
+     */
+    bool isWritePending() const noexcept override;
+
+    /**
+     * @brief Wait until all pending asynchronous writes are complete.
+     * 
+     *        The CPU sleeps in idle mode until woken up by the EEPROM ready interrupt. If 
+     *        global interrupts are disabled, for instance in an interrupt service routine, 
+     *        the bytes are programmed by polling instead and interrupts stay disabled.
+     */
+    void flush() noexcept override;
+
     Atmega328p(const Atmega328p&)            = delete; // No copy constructor.
     Atmega328p(Atmega328p&&)                 = delete; // No move constructor.
     Atmega328p& operator=(const Atmega328p&) = delete; // No copy assignment.
@@ -66,6 +101,7 @@ private:
     bool isAddressValid(uint16_t address, uint8_t dataSize) const noexcept override;
     void writeByte(uint16_t address, uint8_t data) noexcept override;
     uint8_t readByte(uint16_t address) const noexcept override;
+    void programByte(uint16_t address, uint8_t data, ProgramMode mode) noexcept override;
 
     /** Indicate whether the EEPROM stream is enabled. */
     bool myEnabled;
@@ -11,6 +11,22 @@ namespace driver
 {
 namespace eeprom
 {
+/**
+ * @brief Enumeration of EEPROM programming modes.
+ */
+enum class ProgramMode : uint8_t
+{ 
+    EraseWrite, // Erase the byte and write the new value in one atomic operation (3.4 ms).
+    EraseOnly,  // Erase the byte to 0xFF only (1.8 ms).
+    WriteOnly,  // Write the new value only, which can only clear bits of the byte (1.8 ms).
+    Count,      // Number of supported programming modes.
+};
+
+/**
+ * @brief Callback invoked when an asynchronous write is complete.
+ */
+using WriteCallback = void (*)() noexcept;
+
 /**
  * @brief EEPROM (Electrically Erasable Programmable ROM) stream interface.
  */
@@ -54,6 +70,9 @@ public:
      * @brief Write data to given address in EEPROM. If more than one byte is to be written, 
      *        the other bytes are written to the consecutive addresses until all bytes are stored.
      * 
+     *        Each byte is read first and only programmed if its value differs, which saves
+     *        the programming time and the wear of the EEPROM cell.
+     * 
      * @tparam T The data type of the data to write. Must be unsigned.
      *
      * @param[in] address The destination address.
@@ -64,6 +83,56 @@ public:
     template <typename T = uint8_t>
     bool write(uint16_t address, const T& data) noexcept;
 
+    /**
+     * @brief Write data to given address in EEPROM, see write() above.
+     * 
+     *        Bytes changing to 0xFF are erased only, and bytes only clearing bits of the 
+     *        stored value are written only, which halves the programming time if the 
+     *        EEPROM supports split programming modes.
+     * 
+     * @tparam T The data type of the data to write. Must be unsigned.
+     *
+     * @param[in] address The destination address.
+     * @param[in] data The data to write to the destination address.
+     * @param[out] programmedCount The number of bytes actually programmed, 0 if the stored 
+     *                             data already matched or on failure.
+     *
+     * @return True upon successful write, false otherwise.
+     */
+    template <typename T = uint8_t>
+    bool write(uint16_t address, const T& data, uint8_t& programmedCount) noexcept;
+
+    /**
+     * @brief Write bytes to given address in EEPROM without waiting for the programming.
+     * 
+     *        The bytes are copied, so the data may be reused right away. Only changed bytes 
+     *        are programmed, see write(). Reads of pending addresses return the queued data. 
+     *        The default implementation writes the bytes before returning.
+     * 
+     * @param[in] address The destination address.
+     * @param[in] data The bytes to write.
+     * @param[in] size The number of bytes to write.
+     * @param[in] callback Callback invoked once all bytes are written (default = none).
+     *                     May be invoked from an interrupt service routine.
+     * 
+     * @return True if the bytes were queued, false if the address is invalid, the EEPROM 
+     *         stream isn't enabled or if the write queue is full.
+     */
+    virtual bool writeAsync(uint16_t address, const uint8_t* data, uint8_t size, 
+                            WriteCallback callback = nullptr) noexcept;
+
+    /**
+     * @brief Check whether asynchronous writes are pending.
+     * 
+     * @return True if bytes are queued or being programmed, false otherwise.
+     */
+    virtual bool isWritePending() const noexcept;
+
+    /**
+     * @brief Wait until all pending asynchronous writes are complete.
+     */
+    virtual void flush() noexcept;
+
     /**
      * @brief Read data from given address in EEPROM. If more than one byte is to be read,
      *        the consecutive addresses are read until all bytes are read.
@@ -82,23 +151,83 @@ private:
     virtual bool isAddressValid(uint16_t address, uint8_t dataSize) const noexcept = 0;
     virtual void writeByte(uint16_t address, uint8_t data) noexcept = 0;
     virtual uint8_t readByte(uint16_t address) const noexcept = 0;
+    virtual void programByte(uint16_t address, uint8_t data, ProgramMode mode) noexcept;
 };
 
+/**
+ * @brief Get the fastest programming mode for changing a stored EEPROM byte.
+ * 
+ * @param[in] storedData The byte currently stored in EEPROM.
+ * @param[in] data The byte to store.
+ * 
+ * @return The programming mode to use.
+ */
+inline ProgramMode programMode(const uint8_t storedData, const uint8_t data) noexcept
+{
+    // Erase only if all bits are to be set, write only if no bits are to be set.
+    if (0xFFU == data) { return ProgramMode::EraseOnly; }
+    return data == (storedData & data) ? ProgramMode::WriteOnly : ProgramMode::EraseWrite;
+}
+
+// -----------------------------------------------------------------------------
+inline bool Interface::writeAsync(const uint16_t address, const uint8_t* data, 
+                                  const uint8_t size, const WriteCallback callback) noexcept
+{
+    // Return false if the data is invalid, the address is invalid or if the stream is disabled.
+    if ((nullptr == data) || (0U == size) || !isAddressValid(address, size) || !isEnabled())
+    {
+        return false;
+    }
+
+    // Write the bytes right away by default, then signal completion.
+    for (uint8_t i{}; i < size; ++i) { write(address + i, data[i]); }
+    if (nullptr != callback) { callback(); }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+inline bool Interface::isWritePending() const noexcept { return false; }
+
+// -----------------------------------------------------------------------------
+inline void Interface::flush() noexcept {}
+
+// -----------------------------------------------------------------------------
+inline void Interface::programByte(const uint16_t address, const uint8_t data, 
+                                  const ProgramMode) noexcept
+{
+    // Perform a regular write by default, which stores the data in any mode.
+    writeByte(address, data);
+}
+
 // -----------------------------------------------------------------------------
 template <typename T>
 bool Interface::write(const uint16_t address, const T& data) noexcept
+{
+    uint8_t programmedCount{};
+    return write(address, data, programmedCount);
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool Interface::write(const uint16_t address, const T& data, uint8_t& programmedCount) noexcept
 {
     // Generate a compiler error if the given type isn't of unsigned type.
     static_assert(type_traits::is_unsigned<T>::value, 
         "EEPROM write only supported for unsigned data types!");
 
     // Return false is the given address in invalid or if the EEPROM stream isn't enabled.
+    programmedCount = 0U;
     if (!isAddressValid(address, sizeof(T)) || !isEnabled()) { return false; }
     
-    // Write each byte to EEPROM, one at a time.
+    // Write each byte to EEPROM, one at a time, skip bytes already holding the new value.
     for (uint8_t i{}; i < sizeof(T); ++i)
     {
-        writeByte(address + i, static_cast<uint8_t>(data >> (8U * i)));
+        const uint8_t value{static_cast<uint8_t>(data >> (8U * i))};
+        const uint8_t storedValue{readByte(address + i)};
+        if (value == storedValue) { continue; }
+
+        programByte(address + i, value, programMode(storedValue, value));
+        ++programmedCount;
     }
     // Return true to indicate success.
     return true;
@@ -119,7 +248,7 @@ bool Interface::read(const uint16_t address, T& data) const noexcept
     // Read each byte from EEPROM, one at a type.
     for (uint8_t i{}; i < sizeof(T); ++i) 
     { 
-        data |= static_cast<T>(readByte(address + i) << (8U * i));
+        data |= static_cast<T>(static_cast<T>(readByte(address + i)) << (8U * i));
     }
     // Return true to indicate success.
     return true;
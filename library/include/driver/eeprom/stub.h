@@ -102,6 +102,38 @@ public:
         return myEnabled && (MemSize > address) ? myMemory[address] : 0U;
     }
 
+    /**
+     * @brief Program byte in EEPROM with given programming mode.
+     * 
+     *        The modes are emulated as on the MCU, so erasing sets all bits and writing only 
+     *        clears bits.
+     * 
+     * @param[in] address Destination address.
+     * @param[in] data Data to program.
+     * @param[in] mode The programming mode to use.
+     */
+    void programByte(const uint16_t address, const uint8_t data, 
+                     const ProgramMode mode) noexcept override
+    {
+        if (!myEnabled || (MemSize <= address)) { return; }
+        if (ProgramMode::EraseOnly == mode) { myMemory[address] = 0xFFU; }
+        else if (ProgramMode::WriteOnly == mode) { myMemory[address] &= data; }
+        else { myMemory[address] = data; }
+        ++myProgramCounts[static_cast<uint8_t>(mode)];
+    }
+
+    /**
+     * @brief Get the number of bytes programmed with given programming mode.
+     * 
+     * @param[in] mode The programming mode.
+     * 
+     * @return The number of bytes programmed with the mode since creation.
+     */
+    uint32_t programCount(const ProgramMode mode) const noexcept
+    {
+        return ProgramMode::Count > mode ? myProgramCounts[static_cast<uint8_t>(mode)] : 0U;
+    }
+
     Stub(const Stub&)            = delete; // No copy constructor.
     Stub(Stub&&)                 = delete; // No move constructor.
     Stub& operator=(const Stub&) = delete; // No copy assignment.
@@ -111,6 +143,9 @@ private:
     /** EEPROM memory. */
     uint8_t myMemory[MemSize]{};
 
+    /** The number of bytes programmed per programming mode. */
+    uint32_t myProgramCounts[static_cast<uint8_t>(ProgramMode::Count)]{};
+
     /** Indicate whether the EEPROM stream is enabled. */
     bool myEnabled;
 };
@@ -55,6 +55,13 @@ public:
      */
     void setEnabled(bool enable) noexcept override;
     
+    /**
+     * @brief Check whether received data is available to read.
+     * 
+     * @return True if at least one byte can be read immediately, otherwise false.
+     */
+    bool isDataAvailable() const noexcept override;
+
     /**
      * @brief Read data from the serial port.
      * 
@@ -66,6 +73,16 @@ public:
      */
     int16_t read(uint8_t* buffer, uint16_t size, uint16_t timeout_ms) const noexcept override;
 
+    /**
+     * @brief Write raw data to the serial port.
+     * 
+     * @param[in] data Pointer to the data to write.
+     * @param[in] size The size of the data in bytes.
+     * 
+     * @return The number of written bytes, or -1 on error.
+     */
+    int16_t write(const uint8_t* data, uint16_t size) const noexcept override;
+
     Atmega328p(const Atmega328p&)                      = delete; // No copy constructor.
     Atmega328p(Atmega328p&& other) noexcept            = delete; // No move constructor.
     Atmega328p& operator=(const Atmega328p&)           = delete; // No copy assignment.
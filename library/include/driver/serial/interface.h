@@ -49,6 +49,16 @@ public:
      */
     virtual void setEnabled(bool enable) noexcept = 0;
 
+    /**
+     * @brief Check whether received data is available to read.
+     * 
+     *        Use this to poll the serial port without blocking, since read() waits for at 
+     *        least a millisecond if no data has been received.
+     * 
+     * @return True if at least one byte can be read immediately, otherwise false.
+     */
+    virtual bool isDataAvailable() const noexcept = 0;
+
     /**
      * @brief Read data from the serial port.
      * 
@@ -60,6 +70,19 @@ public:
      */
     virtual int16_t read(uint8_t* buffer, uint16_t size, uint16_t timeout_ms) const noexcept = 0;
 
+    /**
+     * @brief Write raw data to the serial port.
+     * 
+     *        In contrast to printf, the data is transmitted as is, i.e. zero bytes are 
+     *        transmitted and new lines aren't combined with carriage returns.
+     * 
+     * @param[in] data Pointer to the data to write.
+     * @param[in] size The size of the data in bytes.
+     * 
+     * @return The number of written bytes, or -1 on error.
+     */
+    virtual int16_t write(const uint8_t* data, uint16_t size) const noexcept = 0;
+
     /**
      * @brief Print formatted string to the serial port.
      * 
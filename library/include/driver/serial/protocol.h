@@ -0,0 +1,157 @@
+/**
+ * @brief Binary framed protocol for compact serial telemetry.
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "utils/codec.h"
+
+namespace driver
+{
+namespace serial
+{
+/** Serial driver interface. */
+class Interface;
+
+/**
+ * @brief Enumeration of message types.
+ */
+enum class MessageType : uint8_t
+{
+    Temperature = 0x01U, // Temperature in degrees Celsius.
+    ToggleState = 0x02U, // Toggle timer state (0 = disabled, 1 = enabled).
+    Log         = 0x03U, // Deferred log message (id and arguments), see logging::Deferred.
+};
+
+/**
+ * @brief Structure of a decoded protocol message.
+ */
+struct Message
+{
+    /** Maximum number of values per message. */
+    static constexpr uint8_t MaxValueCount{8U};
+
+    /** Message type. */
+    MessageType type;
+
+    /** The number of values held by the message. */
+    uint8_t valueCount;
+
+    /** Message values. */
+    int32_t values[MaxValueCount];
+};
+
+/**
+ * @brief Binary framed protocol for compact serial telemetry.
+ *
+ *        Each message is transmitted as a frame with the following layout:
+ *
+ *            [type (1 byte)][values (zigzag varints, 1-5 bytes each)][CRC16 (2 bytes, LSB first)]
+ *
+ *        The frame is COBS encoded and terminated by a zero byte. Since zero bytes never occur
+ *        within an encoded frame, a receiver can always resynchronize on the next delimiter
+ *        after dropped or corrupted bytes. As an example, a temperature of 25 degrees Celsius
+ *        is transmitted in six bytes, compared to 25 bytes for the corresponding text message.
+ *
+ *        This class is non-copyable and non-movable.
+ */
+class Protocol
+{
+public:
+    /** Maximum size of a raw (unencoded) frame in bytes. */
+    static constexpr size_t MaxRawFrameSize{1U + Message::MaxValueCount * utils::varint::MaxSize
+                                            + sizeof(uint16_t)};
+
+    /** Maximum size of an encoded frame in bytes, including the frame delimiter. */
+    static constexpr size_t MaxFrameSize{utils::cobs::maxEncodedSize(MaxRawFrameSize) + 1U};
+
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] serial Serial device to transmit and receive frames with.
+     */
+    explicit Protocol(Interface& serial) noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~Protocol() noexcept = default;
+
+    /**
+     * @brief Send message.
+     *
+     * @param[in] type The message type.
+     * @param[in] values Pointer to the message values.
+     * @param[in] valueCount The number of message values. Must not exceed the max value count.
+     *
+     * @return True if the message was sent, false otherwise.
+     */
+    bool send(MessageType type, const int32_t* values, uint8_t valueCount) const noexcept;
+
+    /**
+     * @brief Send temperature message.
+     *
+     * @param[in] temperature The temperature in degrees Celsius.
+     *
+     * @return True if the message was sent, false otherwise.
+     */
+    bool sendTemperature(int16_t temperature) const noexcept;
+
+    /**
+     * @brief Send toggle state message.
+     *
+     * @param[in] enabled True if the toggle timer is enabled, false otherwise.
+     *
+     * @return True if the message was sent, false otherwise.
+     */
+    bool sendToggleState(bool enabled) const noexcept;
+
+    /**
+     * @brief Receive message.
+     *
+     *        Received bytes are discarded until a valid frame has been received. Corrupted
+     *        frames are dropped and the reception is resynchronized on the next delimiter.
+     *
+     * @param[out] message Reference to message for storing the received message.
+     * @param[in] timeout_ms Timeout per received byte. Pass 0 to wait indefinitely.
+     *
+     * @return True if a valid message was received, false otherwise.
+     */
+    bool receive(Message& message, uint16_t timeout_ms) const noexcept;
+
+    /**
+     * @brief Encode message to a frame.
+     *
+     * @param[in] message The message to encode.
+     * @param[out] frame Pointer to the destination buffer.
+     * @param[in] frameSize The size of the destination buffer in bytes.
+     *
+     * @return The size of the frame in bytes, including the delimiter, or 0 on failure.
+     */
+    static size_t encode(const Message& message, uint8_t* frame, size_t frameSize) noexcept;
+
+    /**
+     * @brief Decode frame to a message.
+     *
+     * @param[in] frame Pointer to the encoded frame, excluding the delimiter.
+     * @param[in] size The size of the frame in bytes.
+     * @param[out] message Reference to message for storing the decoded message.
+     *
+     * @return True if the frame was decoded, false if the frame is corrupt.
+     */
+    static bool decode(const uint8_t* frame, size_t size, Message& message) noexcept;
+
+    Protocol()                           = delete; // No default constructor.
+    Protocol(const Protocol&)            = delete; // No copy constructor.
+    Protocol(Protocol&&)                 = delete; // No move constructor.
+    Protocol& operator=(const Protocol&) = delete; // No copy assignment.
+    Protocol& operator=(Protocol&&)      = delete; // No move assignment.
+
+private:
+    /** Serial device to transmit and receive frames with. */
+    Interface& mySerial;
+};
+} // namespace serial
+} // namespace driver
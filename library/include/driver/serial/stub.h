@@ -29,7 +29,9 @@ public:
      */
     explicit Stub(const uint32_t baudRate_bps = 9600U) noexcept
         : myReadBuffer{}
+        , myWriteBuffer{}
         , myBaudRate_bps{baudRate_bps}
+        , myReadIndex{}
         , myEnabled{true}
     {}
 
@@ -65,6 +67,16 @@ public:
      * @param[in] enable Indicate whether to enable the device.
      */
     void setEnabled(const bool enable) noexcept override { myEnabled = enable; }
+
+    /**
+     * @brief Check whether simulated received data is available to read.
+     * 
+     * @return True if the simulated read buffer contains unread bytes, otherwise false.
+     */
+    bool isDataAvailable() const noexcept override 
+    { 
+        return myReadBuffer.size() > myReadIndex; 
+    }
     
     /**
      * @brief Read data from the serial port.
@@ -85,16 +97,40 @@ public:
         if ((nullptr == buffer) || (size == 0U)) { return -1; }
 
         // Determine the number of bytes to read.
-        const uint16_t storedBytes{static_cast<uint16_t>(myReadBuffer.size())};
+        const uint16_t storedBytes{static_cast<uint16_t>(myReadBuffer.size() - myReadIndex)};
         const uint16_t bytesToRead{size < storedBytes ? size : storedBytes};
 
         // Copy contents from the simulated read buffer to given read buffer.
-        for (uint16_t i{}; i < bytesToRead; ++i) { buffer[i] = myReadBuffer[i]; }
+        // Consume the bytes read, just like a real receiver.
+        for (uint16_t i{}; i < bytesToRead; ++i) { buffer[i] = myReadBuffer[myReadIndex++]; }
 
         // Return the number of bytes read.
         return static_cast<int16_t>(bytesToRead);
     }
 
+    /**
+     * @brief Write raw data to the serial port.
+     * 
+     *        The data is stored in a simulated write buffer.
+     * 
+     * @param[in] data Pointer to the data to write.
+     * @param[in] size The size of the data in bytes.
+     * 
+     * @return The number of written bytes, or -1 on error.
+     */
+    int16_t write(const uint8_t* data, const uint16_t size) const noexcept override
+    {
+        // Check the input parameters, return -1 if invalid.
+        if ((nullptr == data) || (size == 0U)) { return -1; }
+
+        // Return 0 if serial transmission isn't enabled.
+        if (!myEnabled) { return 0; }
+
+        // Store the data in the simulated write buffer.
+        for (uint16_t i{}; i < size; ++i) { myWriteBuffer.pushBack(data[i]); }
+        return static_cast<int16_t>(size);
+    }
+
     /**
      * @brief Print the given string in the serial terminal.
      * 
@@ -112,7 +148,11 @@ public:
     /**
      * @brief Clear the simulated read buffer.
      */
-    void clearReadBuffer() noexcept { myReadBuffer.clear(); } 
+    void clearReadBuffer() noexcept 
+    { 
+        myReadBuffer.clear(); 
+        myReadIndex = 0U;
+    } 
 
     /**
      * @brief Simulate received data by populating the read buffer.
@@ -127,9 +167,22 @@ public:
 
         // Copy content to the simulated read buffer.
         myReadBuffer.resize(size);
+        myReadIndex = 0U;
         for (uint16_t i{}; i < size; ++i) { myReadBuffer[i] = buffer[i]; }
     }
 
+    /**
+     * @brief Get the simulated write buffer.
+     * 
+     * @return Reference to the simulated write buffer, containing all raw data written.
+     */
+    const container::Vector<uint8_t>& writeBuffer() const noexcept { return myWriteBuffer; }
+
+    /**
+     * @brief Clear the simulated write buffer.
+     */
+    void clearWriteBuffer() noexcept { myWriteBuffer.clear(); }
+
     Stub(const Stub&)            = delete; // No copy constructor.
     Stub(Stub&&)                 = delete; // No move constructor.
     Stub& operator=(const Stub&) = delete; // No copy assignment.
@@ -139,9 +192,15 @@ private:
     /** Simulated read buffer. */
     container::Vector<uint8_t> myReadBuffer;
 
+    /** Simulated write buffer. */
+    mutable container::Vector<uint8_t> myWriteBuffer;
+
     /** Baud rate in bps (bits per second). */
     const uint32_t myBaudRate_bps;
 
+    /** Index of the next byte to read from the simulated read buffer. */
+    mutable uint16_t myReadIndex;
+
     /** Indicate whether serial transmission is enabled. */
     bool myEnabled;
 };
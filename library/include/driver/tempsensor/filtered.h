@@ -0,0 +1,111 @@
+/**
+ * @brief Filtered temperature sensor implementation.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "driver/tempsensor/interface.h"
+#include "utils/type_traits.h"
+
+namespace driver
+{
+namespace tempsensor
+{
+/**
+ * @brief Filtered temperature sensor implementation.
+ * 
+ *        Passes each reading of another temperature sensor through a filter, such as a
+ *        filter::Chain of moving average, median and EMA filters, to suppress noise. The 
+ *        filter is resolved at compile time and held by value, so no heap memory is used.
+ * 
+ *        This class is non-copyable and non-movable.
+ * 
+ * @tparam Filter The filter type, which must provide update(int16_t) and reset().
+ */
+template <typename Filter>
+class Filtered final : public Interface
+{
+    // Generate a compiler error if the filter sample type doesn't match the temperature type.
+    static_assert(type_traits::is_same<typename Filter::Value, int16_t>::value, 
+                  "The filter must operate on 16-bit signed temperatures!");
+
+public:
+    /**
+     * @brief Constructor.
+     * 
+     * @param[in] sensor The temperature sensor to filter, which must outlive this instance.
+     */
+    explicit Filtered(Interface& sensor) noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~Filtered() noexcept override = default;
+
+    /**
+     * @brief Check if the temperature sensor is initialized.
+     * 
+     * @return True if the temperature sensor is initialized, false otherwise.
+     */
+    bool isInitialized() const noexcept override;
+
+    /**
+     * @brief Read the temperature sensor and update the filter.
+     *
+     * @return The filtered temperature in degrees Celsius, or 0 if the sensor isn't initialized.
+     */
+    int16_t read() const noexcept override;
+
+    /**
+     * @brief Start a non-blocking read of the temperature sensor.
+     *
+     * @param[in] callback Callback to invoke from poll() with the filtered temperature when 
+     *                     the reading is complete (default = none).
+     *
+     * @return True if the read was started, false otherwise.
+     */
+    bool startRead(ReadCallback callback = nullptr) noexcept override;
+
+    /**
+     * @brief Check whether a non-blocking read is ongoing.
+     *
+     * @return True if a read has been started but not yet fetched via poll(), false otherwise.
+     */
+    bool isReading() const noexcept override;
+
+    /**
+     * @brief Poll a non-blocking read started via startRead() and update the filter.
+     *
+     * @param[out] temperature Reference to variable for storing the filtered temperature in 
+     *                         degrees Celsius.
+     *
+     * @return True if the reading was complete and the temperature was stored, false otherwise.
+     */
+    bool poll(int16_t& temperature) noexcept override;
+
+    /**
+     * @brief Clear the filter state, for instance after the sensor has been idle for long.
+     */
+    void reset() noexcept;
+
+    Filtered()                           = delete; // No default constructor.
+    Filtered(const Filtered&)            = delete; // No copy constructor.
+    Filtered(Filtered&&)                 = delete; // No move constructor.
+    Filtered& operator=(const Filtered&) = delete; // No copy assignment.
+    Filtered& operator=(Filtered&&)      = delete; // No move assignment.
+
+private:
+    /** The temperature sensor to filter. */
+    Interface& mySensor;
+
+    /** Filter state, updated on each read. */
+    mutable Filter myFilter;
+
+    /** Callback to invoke when a non-blocking read is complete. */
+    ReadCallback myCallback;
+};
+} // namespace tempsensor
+} // namespace driver
+
+#include "impl/filtered_impl.h"
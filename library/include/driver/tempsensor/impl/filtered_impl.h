@@ -0,0 +1,61 @@
+/**
+ * @brief Implementation details of tempsensor::Filtered class.
+ *
+ * @note Don't include this header, use <filtered.h> instead!
+ */
+#pragma once
+
+namespace driver
+{
+namespace tempsensor
+{
+// -----------------------------------------------------------------------------
+template <typename Filter>
+Filtered<Filter>::Filtered(Interface& sensor) noexcept
+    : mySensor{sensor}
+    , myFilter{}
+    , myCallback{nullptr} {}
+
+// -----------------------------------------------------------------------------
+template <typename Filter>
+bool Filtered<Filter>::isInitialized() const noexcept { return mySensor.isInitialized(); }
+
+// -----------------------------------------------------------------------------
+template <typename Filter>
+int16_t Filtered<Filter>::read() const noexcept
+{
+    // Don't feed the filter with invalid readings.
+    return mySensor.isInitialized() ? myFilter.update(mySensor.read()) : 0;
+}
+
+// -----------------------------------------------------------------------------
+template <typename Filter>
+bool Filtered<Filter>::startRead(const ReadCallback callback) noexcept
+{
+    // Notify the callback once the reading has been filtered, not the raw reading.
+    if (!mySensor.startRead()) { return false; }
+    myCallback = callback;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename Filter>
+bool Filtered<Filter>::isReading() const noexcept { return mySensor.isReading(); }
+
+// -----------------------------------------------------------------------------
+template <typename Filter>
+bool Filtered<Filter>::poll(int16_t& temperature) noexcept
+{
+    // Pass the completed reading through the filter, then notify the callback (if any).
+    int16_t rawTemperature{};
+    if (!mySensor.poll(rawTemperature)) { return false; }
+    temperature = myFilter.update(rawTemperature);
+    if (nullptr != myCallback) { myCallback(temperature); }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename Filter>
+void Filtered<Filter>::reset() noexcept { myFilter.reset(); }
+} // namespace tempsensor
+} // namespace driver
@@ -0,0 +1,106 @@
+/**
+ * @brief Implementation details of the TMP36 lookup table.
+ *
+ * @note Don't include this header, use <tmp36_table.h> instead!
+ */
+#pragma once
+
+namespace driver
+{
+namespace tempsensor
+{
+namespace tmp36
+{
+namespace detail
+{
+// -----------------------------------------------------------------------------
+template <uint8_t Resolution, uint8_t FractionBits, uint16_t SupplyVoltage_mV>
+constexpr int32_t temperature(const uint16_t adcValue) noexcept
+{
+    // Temperature = input voltage / (10 mV per degree) - 50 degrees, scaled by 2^FractionBits.
+    constexpr int32_t scale{static_cast<int32_t>(1) << FractionBits};
+    constexpr int32_t denominator{((static_cast<int32_t>(1) << Resolution) - 1) * 10};
+    const int32_t numerator{static_cast<int32_t>(adcValue) * SupplyVoltage_mV * scale};
+    return (numerator + denominator / 2) / denominator - 50 * scale;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t Resolution, uint8_t FractionBits, int16_t MinTemp, uint16_t SupplyVoltage_mV>
+constexpr uint16_t minAdcValue() noexcept
+{
+    // The temperature increases with the ADC value, find the last value at the lower limit.
+    constexpr int32_t minTemp{MinTemp * (static_cast<int32_t>(1) << FractionBits)};
+    constexpr uint16_t maxValue{(1U << Resolution) - 1U};
+    uint16_t adcValue{};
+    while ((maxValue > adcValue) && 
+           (minTemp >= temperature<Resolution, FractionBits, SupplyVoltage_mV>(adcValue + 1U)))
+    {
+        ++adcValue;
+    }
+    return adcValue;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t Resolution, uint8_t FractionBits, int16_t MaxTemp, uint16_t SupplyVoltage_mV>
+constexpr uint16_t maxAdcValue() noexcept
+{
+    // The temperature increases with the ADC value, find the first value at the upper limit.
+    constexpr int32_t maxTemp{MaxTemp * (static_cast<int32_t>(1) << FractionBits)};
+    uint16_t adcValue{(1U << Resolution) - 1U};
+    while ((0U < adcValue) && 
+           (maxTemp <= temperature<Resolution, FractionBits, SupplyVoltage_mV>(adcValue - 1U)))
+    {
+        --adcValue;
+    }
+    return adcValue;
+}
+} // namespace detail
+
+// -----------------------------------------------------------------------------
+template <uint8_t Resolution, uint8_t FractionBits, int16_t MinTemp, int16_t MaxTemp, 
+          uint16_t SupplyVoltage_mV>
+constexpr LookupTable<Resolution, FractionBits, MinTemp, MaxTemp, SupplyVoltage_mV>
+    LookupTable<Resolution, FractionBits, MinTemp, MaxTemp, SupplyVoltage_mV>::generate() noexcept
+{
+    LookupTable table{};
+    for (uint16_t i{}; i < Size; ++i) 
+    { 
+        table.values[i] = temperature(static_cast<uint16_t>(MinAdcValue + i)); 
+    }
+    return table;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t Resolution, uint8_t FractionBits, int16_t MinTemp, int16_t MaxTemp, 
+          uint16_t SupplyVoltage_mV>
+constexpr int16_t LookupTable<Resolution, FractionBits, MinTemp, MaxTemp, 
+                              SupplyVoltage_mV>::temperature(const uint16_t adcValue) noexcept
+{
+    constexpr int32_t scale{static_cast<int32_t>(1) << FractionBits};
+    const int32_t temp{detail::temperature<Resolution, FractionBits, SupplyVoltage_mV>(adcValue)};
+
+    // Clamp the temperature to the configured range.
+    if (MinTemp * scale > temp) { return static_cast<int16_t>(MinTemp * scale); }
+    if (MaxTemp * scale < temp) { return static_cast<int16_t>(MaxTemp * scale); }
+    return static_cast<int16_t>(temp);
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t Resolution, uint8_t FractionBits, int16_t MinTemp, int16_t MaxTemp, 
+          uint16_t SupplyVoltage_mV>
+int16_t LookupTable<Resolution, FractionBits, MinTemp, MaxTemp, 
+                    SupplyVoltage_mV>::read(const uint16_t adcValue) const noexcept
+{
+    // Clamp the ADC value to the table, values outside have the same temperature as the ends.
+    const uint16_t clamped{MinAdcValue > adcValue ? MinAdcValue 
+                           : (MaxAdcValue < adcValue ? MaxAdcValue : adcValue)};
+    const uint16_t index{static_cast<uint16_t>(clamped - MinAdcValue)};
+    const int16_t temp{static_cast<int16_t>(pgm_read_word(&values[index]))};
+
+    // Round to whole degrees, away from zero on ties.
+    constexpr int16_t half{FractionBits ? (1 << FractionBits) / 2 : 0};
+    return (0 <= temp ? temp + half : temp - half) / (1 << FractionBits);
+}
+} // namespace tmp36
+} // namespace tempsensor
+} // namespace driver
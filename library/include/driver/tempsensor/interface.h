@@ -9,6 +9,13 @@ namespace driver
 {
 namespace tempsensor
 {
+/**
+ * @brief Callback invoked when a non-blocking read is complete.
+ *
+ * @param[in] temperature The temperature in degrees Celsius.
+ */
+using ReadCallback = void (*)(int16_t temperature) noexcept;
+
 /**
  * @brief Temperature sensor interface.
  */
@@ -33,6 +40,40 @@ public:
      * @return The temperature in degrees Celsius.
      */
     virtual int16_t read() const noexcept = 0;
+
+    /**
+     * @brief Start a non-blocking read of the temperature sensor.
+     * 
+     *        The reading is completed in the background, for instance by the interrupt-driven 
+     *        ADC, and fetched via poll(), which is typically called from the main loop. 
+     *        This function may be called from interrupt context.
+     *
+     * @param[in] callback Callback to invoke from poll() when the reading is complete 
+     *                     (default = none).
+     *
+     * @return True if the read was started, false if the temperature sensor isn't initialized
+     *         or if a read is already ongoing.
+     */
+    virtual bool startRead(ReadCallback callback = nullptr) noexcept = 0;
+
+    /**
+     * @brief Check whether a non-blocking read is ongoing.
+     *
+     * @return True if a read has been started but not yet fetched via poll(), false otherwise.
+     */
+    virtual bool isReading() const noexcept = 0;
+
+    /**
+     * @brief Poll a non-blocking read started via startRead().
+     * 
+     *        The read callback is invoked before returning if the reading is complete.
+     *
+     * @param[out] temperature Reference to variable for storing the temperature in degrees 
+     *                         Celsius.
+     *
+     * @return True if the reading was complete and the temperature was stored, false otherwise.
+     */
+    virtual bool poll(int16_t& temperature) noexcept = 0;
 };
 } // namespace tempsensor
 } // namespace driver
@@ -9,8 +9,14 @@
 
 namespace ml
 {
+namespace lin_reg 
+{ 
 /** Linear regression interface. */
-namespace lin_reg { class Interface; }
+class Interface; 
+
+/** Quantized linear regression interface. */
+class QuantizedInterface;
+} // namespace lin_reg
 } // namespace ml
 
 namespace driver
@@ -36,6 +42,20 @@ public:
      */
     explicit Smart(uint8_t pin, adc::Interface& adc, ml::lin_reg::Interface& linReg) noexcept;
 
+    /**
+     * @brief Constructor.
+     * 
+     *        The quantized model predicts the temperature directly from the raw ADC value 
+     *        with integer arithmetic, so no floating-point math is performed per reading.
+     * 
+     * @param[in] pin Pin the temperature sensor is connected to.
+     * @param[in] adc A/D converter for reading the input voltage from the sensor.
+     * @param[in] linReg Quantized linear regression model to predict the temperature based on
+     *                   the ADC value, see ml::lin_reg::Quantized::quantize().
+     */
+    explicit Smart(uint8_t pin, adc::Interface& adc, 
+                   const ml::lin_reg::QuantizedInterface& linReg) noexcept;
+
     /**
      * @brief Destructor.
      */
@@ -55,6 +75,40 @@ public:
      */
     int16_t read() const noexcept override;
 
+    /**
+     * @brief Start a non-blocking read of the temperature sensor.
+     * 
+     *        The input voltage is converted by the interrupt-driven ADC, see 
+     *        adc::Interface::startConversion(). This function may be called from interrupt 
+     *        context.
+     *
+     * @param[in] callback Callback to invoke from poll() when the reading is complete 
+     *                     (default = none).
+     *
+     * @return True if the read was started, false if the temperature sensor isn't initialized
+     *         or if the ADC is busy.
+     */
+    bool startRead(ReadCallback callback = nullptr) noexcept override;
+
+    /**
+     * @brief Check whether a non-blocking read is ongoing.
+     *
+     * @return True if a read has been started but not yet fetched via poll(), false otherwise.
+     */
+    bool isReading() const noexcept override;
+
+    /**
+     * @brief Poll a non-blocking read started via startRead().
+     * 
+     *        The read callback is invoked before returning if the reading is complete.
+     *
+     * @param[out] temperature Reference to variable for storing the temperature in degrees 
+     *                         Celsius.
+     *
+     * @return True if the reading was complete and the temperature was stored, false otherwise.
+     */
+    bool poll(int16_t& temperature) noexcept override;
+
     Smart()                        = delete; // No default constructor.
     Smart(const Smart&)            = delete; // No copy constructor.
     Smart(Smart&&)                 = delete; // No move constructor.
@@ -62,14 +116,25 @@ public:
     Smart& operator=(Smart&&)      = delete; // No move assignment.
 
 private:
+    int16_t toTemperature(uint16_t adcValue) const noexcept;
+
     /** A/D converter to read the input voltage from the sensor. */
     adc::Interface& myAdc;
 
     /** Linear regression model to predict the temperature based on the input voltage. */
-    ml::lin_reg::Interface& myLinReg;
+    ml::lin_reg::Interface* myLinReg;
+
+    /** Quantized linear regression model to predict the temperature based on the ADC value. */
+    const ml::lin_reg::QuantizedInterface* myQuantizedLinReg;
+
+    /** Callback to invoke when a non-blocking read is complete. */
+    ReadCallback myCallback;
 
     /** Analog pin the temperature sensor is connected to. */
     const uint8_t myPin;
+
+    /** Indicate whether a non-blocking read is ongoing. */
+    volatile bool myReading;
 };
 } // namespace tempsensor
 } // namespace driver
@@ -24,7 +24,9 @@ public:
      */
     Stub() noexcept
         : myTemp{0}
+        , myCallback{nullptr}
         , myInitialized{true}
+        , myReading{false}
     {}
     
     /**
@@ -46,6 +48,48 @@ public:
      */
     int16_t read() const noexcept override { return myTemp; }
 
+    /**
+     * @brief Start a non-blocking read of the temperature sensor.
+     * 
+     *        The simulated reading completes on the next call to poll().
+     *
+     * @param[in] callback Callback to invoke from poll() when the reading is complete 
+     *                     (default = none).
+     *
+     * @return True if the read was started, false if the temperature sensor isn't initialized
+     *         or if a read is already ongoing.
+     */
+    bool startRead(const ReadCallback callback = nullptr) noexcept override
+    {
+        if (!myInitialized || myReading) { return false; }
+        myCallback = callback;
+        myReading  = true;
+        return true;
+    }
+
+    /**
+     * @brief Check whether a non-blocking read is ongoing.
+     *
+     * @return True if a read has been started but not yet fetched via poll(), false otherwise.
+     */
+    bool isReading() const noexcept override { return myReading; }
+
+    /**
+     * @brief Poll a non-blocking read started via startRead().
+     *
+     * @param[out] temperature Reference to variable for storing the simulated temperature.
+     *
+     * @return True if a read was ongoing and the temperature was stored, false otherwise.
+     */
+    bool poll(int16_t& temperature) noexcept override
+    {
+        if (!myReading) { return false; }
+        myReading   = false;
+        temperature = myTemp;
+        if (nullptr != myCallback) { myCallback(temperature); }
+        return true;
+    }
+
     /**
      * @brief Set initialization status.
      * 
@@ -83,8 +127,14 @@ private:
     /** Simulated temperature. */
     int16_t myTemp;
 
+    /** Callback to invoke when a non-blocking read is complete. */
+    ReadCallback myCallback;
+
     /** Temperature sensor initialization state (true = initialized) */
     bool myInitialized;
+
+    /** Indicate whether a non-blocking read is ongoing. */
+    bool myReading;
 };
 } // namespace tempsensor
 } // namespace driver
\ No newline at end of file
@@ -6,6 +6,7 @@
 #include <stdint.h>
 
 #include "driver/tempsensor/interface.h"
+#include "driver/tempsensor/tmp36_table.h"
 
 namespace driver
 {
@@ -17,11 +18,18 @@ namespace tempsensor
 /**
  * @brief TMP36 temperature sensor implementation.
  * 
+ *        Temperatures are looked up in a table stored in program memory if the ADC matches 
+ *        the resolution and supply voltage of the table, otherwise they are computed with 
+ *        integer arithmetic.
+ * 
  *        This class is non-copyable and non-movable.
  */
 class Tmp36 final : public Interface
 {
 public:
+    /** Lookup table, adjust the parameters to configure resolution and range. */
+    using Table = tmp36::LookupTable<10U>;
+
     /**
      * @brief Constructor.
      * 
@@ -49,6 +57,40 @@ public:
      */
     int16_t read() const noexcept override;
 
+    /**
+     * @brief Start a non-blocking read of the temperature sensor.
+     * 
+     *        The input voltage is converted by the interrupt-driven ADC, see 
+     *        adc::Interface::startConversion(). This function may be called from interrupt 
+     *        context.
+     *
+     * @param[in] callback Callback to invoke from poll() when the reading is complete 
+     *                     (default = none).
+     *
+     * @return True if the read was started, false if the temperature sensor isn't initialized
+     *         or if the ADC is busy.
+     */
+    bool startRead(ReadCallback callback = nullptr) noexcept override;
+
+    /**
+     * @brief Check whether a non-blocking read is ongoing.
+     *
+     * @return True if a read has been started but not yet fetched via poll(), false otherwise.
+     */
+    bool isReading() const noexcept override;
+
+    /**
+     * @brief Poll a non-blocking read started via startRead().
+     * 
+     *        The read callback is invoked before returning if the reading is complete.
+     *
+     * @param[out] temperature Reference to variable for storing the temperature in degrees 
+     *                         Celsius.
+     *
+     * @return True if the reading was complete and the temperature was stored, false otherwise.
+     */
+    bool poll(int16_t& temperature) noexcept override;
+
     Tmp36()                        = delete; // No default constructor.
     Tmp36(const Tmp36&)            = delete; // No copy constructor.
     Tmp36(Tmp36&&)                 = delete; // No move constructor.
@@ -56,11 +98,19 @@ public:
     Tmp36& operator=(Tmp36&&)      = delete; // No move assignment.
 
 private:
+    int16_t toTemperature(uint16_t adcValue) const noexcept;
+
     /** A/D converter to read the input voltage from the sensor. */
     adc::Interface& myAdc;
 
+    /** Callback to invoke when a non-blocking read is complete. */
+    ReadCallback myCallback;
+
     /** Analog pin the temperature sensor is connected to. */
     const uint8_t myPin;
+
+    /** Indicate whether a non-blocking read is ongoing. */
+    volatile bool myReading;
 };
 } // namespace tempsensor
 } // namespace driver
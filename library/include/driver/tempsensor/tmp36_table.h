@@ -0,0 +1,141 @@
+/**
+ * @brief Compile-time lookup table mapping ADC values to TMP36 temperatures.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "arch/avr/hw_platform.h"
+
+namespace driver
+{
+namespace tempsensor
+{
+namespace tmp36
+{
+namespace detail
+{
+/**
+ * @brief Convert given ADC value to temperature without clamping.
+ * 
+ * @tparam Resolution The ADC resolution in bits.
+ * @tparam FractionBits The number of fraction bits of the temperature.
+ * @tparam SupplyVoltage_mV The ADC supply voltage in millivolts.
+ * 
+ * @param[in] adcValue The ADC value to convert.
+ * 
+ * @return The temperature with FractionBits fraction bits, rounded to the nearest value.
+ */
+template <uint8_t Resolution, uint8_t FractionBits, uint16_t SupplyVoltage_mV>
+constexpr int32_t temperature(uint16_t adcValue) noexcept;
+
+/**
+ * @brief Get the highest ADC value whose temperature is clamped to the lower limit.
+ * 
+ * @tparam Resolution The ADC resolution in bits.
+ * @tparam FractionBits The number of fraction bits of the temperature.
+ * @tparam MinTemp The lowest temperature in degrees Celsius.
+ * @tparam SupplyVoltage_mV The ADC supply voltage in millivolts.
+ * 
+ * @return The ADC value, or 0 if no ADC value is below the lower limit.
+ */
+template <uint8_t Resolution, uint8_t FractionBits, int16_t MinTemp, uint16_t SupplyVoltage_mV>
+constexpr uint16_t minAdcValue() noexcept;
+
+/**
+ * @brief Get the lowest ADC value whose temperature is clamped to the upper limit.
+ * 
+ * @tparam Resolution The ADC resolution in bits.
+ * @tparam FractionBits The number of fraction bits of the temperature.
+ * @tparam MaxTemp The highest temperature in degrees Celsius.
+ * @tparam SupplyVoltage_mV The ADC supply voltage in millivolts.
+ * 
+ * @return The ADC value, or the highest ADC value if none is above the upper limit.
+ */
+template <uint8_t Resolution, uint8_t FractionBits, int16_t MaxTemp, uint16_t SupplyVoltage_mV>
+constexpr uint16_t maxAdcValue() noexcept;
+} // namespace detail
+
+/**
+ * @brief Lookup table mapping ADC values directly to temperature.
+ * 
+ *        The table is generated at compile time and is intended to be stored in program 
+ *        memory (PROGMEM), so that a temperature read only requires a single table lookup. 
+ *        The TMP36 outputs 10 mV per degree Celsius with an offset of 500 mV.
+ * 
+ *        Only the ADC values within the temperature range are stored, since all values 
+ *        below or above map to the same clamped temperature. Hence a narrower range results 
+ *        in a smaller table.
+ * 
+ * @tparam Resolution The ADC resolution in bits.
+ * @tparam FractionBits The number of fraction bits of the stored temperatures 
+ *                      (0 = whole degrees).
+ * @tparam MinTemp The lowest temperature in degrees Celsius, lower temperatures are clamped.
+ * @tparam MaxTemp The highest temperature in degrees Celsius, higher temperatures are clamped.
+ * @tparam SupplyVoltage_mV The ADC supply voltage in millivolts.
+ */
+template <uint8_t Resolution = 10U, uint8_t FractionBits = 0U, int16_t MinTemp = -50, 
+          int16_t MaxTemp = 450, uint16_t SupplyVoltage_mV = 5000U>
+struct LookupTable
+{
+    // Generate compiler errors if the parameters are invalid.
+    static_assert((8U <= Resolution) && (12U >= Resolution), "Invalid table resolution!");
+    static_assert(MinTemp < MaxTemp, "Invalid temperature range!");
+    static_assert((INT16_MIN <= MinTemp * (1L << FractionBits)) && 
+                  (INT16_MAX >= MaxTemp * (1L << FractionBits)), 
+                  "The temperature range can't be represented!");
+    static_assert(INT32_MAX / (1L << FractionBits) / SupplyVoltage_mV >= (1L << Resolution),
+                  "Too many fraction bits for the table resolution!");
+
+    /** The lowest ADC value stored, lower values have the same temperature. */
+    static constexpr uint16_t MinAdcValue{
+        detail::minAdcValue<Resolution, FractionBits, MinTemp, SupplyVoltage_mV>()};
+
+    /** The highest ADC value stored, higher values have the same temperature. */
+    static constexpr uint16_t MaxAdcValue{
+        detail::maxAdcValue<Resolution, FractionBits, MaxTemp, SupplyVoltage_mV>()};
+
+    /** The number of entries, one per ADC value within the temperature range. */
+    static constexpr uint16_t Size{MaxAdcValue - MinAdcValue + 1U};
+
+    /** The ADC resolution in bits. */
+    static constexpr uint8_t AdcResolution{Resolution};
+
+    /** The ADC supply voltage in millivolts. */
+    static constexpr uint16_t AdcSupplyVoltage_mV{SupplyVoltage_mV};
+
+    /** Temperatures with FractionBits fraction bits, indexed by ADC value - MinAdcValue. */
+    int16_t values[Size];
+
+    /**
+     * @brief Generate the lookup table.
+     * 
+     * @return The generated lookup table.
+     */
+    static constexpr LookupTable generate() noexcept;
+
+    /**
+     * @brief Convert given ADC value to temperature without lookup.
+     * 
+     * @param[in] adcValue The ADC value to convert.
+     * 
+     * @return The temperature with FractionBits fraction bits, rounded to the nearest value.
+     */
+    static constexpr int16_t temperature(uint16_t adcValue) noexcept;
+
+    /**
+     * @brief Look up the temperature of given ADC value in program memory.
+     * 
+     *        Must only be called on tables stored in program memory.
+     * 
+     * @param[in] adcValue The ADC value. Values outside the table are clamped.
+     * 
+     * @return The temperature in whole degrees Celsius, rounded to the nearest integer.
+     */
+    int16_t read(uint16_t adcValue) const noexcept;
+};
+} // namespace tmp36
+} // namespace tempsensor
+} // namespace driver
+
+#include "impl/tmp36_table_impl.h"
@@ -67,6 +67,19 @@ public:
      */
     uint32_t timeout_ms() const noexcept override;
 
+    /**
+     * @brief Get the time the timer has been running since it was created.
+     * 
+     *        Unlike the timeout counter, this time isn't reset on timeout or restart, which 
+     *        makes a continuously running timer usable as a clock. The resolution is 128 us 
+     *        and the time wraps around after about 71 minutes.
+     * 
+     * @note The timer must be initialized.
+     * 
+     * @return The elapsed time in microseconds.
+     */
+    uint32_t elapsed_us() const noexcept;
+
     /**
      * @brief Set timeout of the timer.
      * 
@@ -0,0 +1,111 @@
+/**
+ * @brief Compile-time filter chain.
+ */
+#pragma once
+
+#include "utils/type_traits.h"
+
+namespace filter
+{
+/**
+ * @brief Chain of filters resolved at compile time.
+ *
+ *        Each sample is passed through the filters in the given order, where the output of
+ *        each filter is the input of the next. The chain is expanded recursively at compile
+ *        time, so each update is a sequence of direct calls the compiler can inline. All
+ *        filters must provide the following members:
+ *            - Value: The sample type.
+ *            - Value update(Value sample): Add a sample and return the filtered value.
+ *            - void reset(): Clear the filter state.
+ *
+ * @tparam Filters The filters to chain, which must have the same sample type.
+ */
+template <typename... Filters>
+class Chain;
+
+/**
+ * @brief Empty filter chain, which passes samples through unchanged.
+ */
+template <>
+class Chain<>
+{
+public:
+    /**
+     * @brief Pass a sample through the chain.
+     *
+     * @tparam T The sample type.
+     *
+     * @param[in] sample The sample.
+     *
+     * @return The sample unchanged.
+     */
+    template <typename T>
+    static constexpr T update(const T sample) noexcept { return sample; }
+
+    /**
+     * @brief Reset the chain, which holds no state.
+     */
+    static constexpr void reset() noexcept {}
+};
+
+/**
+ * @brief Filter chain holding at least one filter.
+ *
+ * @tparam First The first filter of the chain.
+ * @tparam Rest The remaining filters of the chain.
+ */
+template <typename First, typename... Rest>
+class Chain<First, Rest...>
+{
+    // Generate a compiler error if the sample types don't match.
+    static_assert((type_traits::is_same<typename First::Value, typename Rest::Value>::value 
+                   && ...), "The filters must have the same sample type!");
+
+public:
+    /** Sample type. */
+    using Value = typename First::Value;
+
+    /**
+     * @brief Create empty filter chain.
+     */
+    Chain() noexcept = default;
+
+    /**
+     * @brief Delete filter chain.
+     */
+    ~Chain() noexcept = default;
+
+    /**
+     * @brief Pass a sample through all filters of the chain.
+     *
+     * @param[in] sample The sample to add.
+     *
+     * @return The output of the last filter.
+     */
+    Value update(const Value sample) noexcept { return myRest.update(myFirst.update(sample)); }
+
+    /**
+     * @brief Clear the state of all filters of the chain.
+     */
+    void reset() noexcept
+    {
+        myFirst.reset();
+        myRest.reset();
+    }
+
+    Chain(const Chain&)            = delete; // No copy constructor.
+    Chain(Chain&&)                 = delete; // No move constructor.
+    Chain& operator=(const Chain&) = delete; // No copy assignment.
+    Chain& operator=(Chain&&)      = delete; // No move assignment.
+
+private:
+    /** Chain holding the remaining filters. */
+    using Next = Chain<Rest...>;
+
+    /** The first filter. */
+    First myFirst;
+
+    /** The remaining filters. */
+    Next myRest;
+};
+} // namespace filter
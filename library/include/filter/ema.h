@@ -0,0 +1,77 @@
+/**
+ * @brief Exponential moving average filter.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "utils/type_traits.h"
+
+namespace filter
+{
+/**
+ * @brief Exponential moving average filter.
+ *
+ *        The smoothing factor is a power of two, alpha = 1 / 2^Shift, so that each update only 
+ *        requires an addition, a subtraction and a shift. The average is held with Shift extra 
+ *        fraction bits to avoid the bias of truncating the average every update. The first 
+ *        sample initializes the average, so the filter doesn't settle from zero.
+ *
+ * @tparam T The sample type. Must be an integral type of at most 16 bits.
+ * @tparam Shift The smoothing shift, where higher values give a smoother but slower response.
+ *               Must be between 1 and 8.
+ */
+template <typename T, uint8_t Shift>
+class Ema
+{
+    // Generate compiler errors if the parameters are invalid.
+    static_assert(type_traits::is_integral<T>::value && (2U >= sizeof(T)), 
+                  "EMA filters only support integral types of at most 16 bits!");
+    static_assert((0U < Shift) && (8U >= Shift), "Invalid smoothing shift!");
+
+public:
+    /** Sample type. */
+    using Value = T;
+
+    /**
+     * @brief Create empty EMA filter.
+     */
+    Ema() noexcept;
+
+    /**
+     * @brief Delete EMA filter.
+     */
+    ~Ema() noexcept = default;
+
+    /**
+     * @brief Add a new sample to the filter.
+     *
+     * @param[in] sample The sample to add.
+     *
+     * @return The updated average, rounded to the nearest integer.
+     */
+    T update(T sample) noexcept;
+
+    /**
+     * @brief Clear the average held by the filter.
+     */
+    void reset() noexcept;
+
+    Ema(const Ema&)            = delete; // No copy constructor.
+    Ema(Ema&&)                 = delete; // No move constructor.
+    Ema& operator=(const Ema&) = delete; // No copy assignment.
+    Ema& operator=(Ema&&)      = delete; // No move assignment.
+
+private:
+    /** Scale factor of the average, 2^Shift. */
+    static constexpr int32_t Scale{static_cast<int32_t>(1) << Shift};
+
+    /** The average scaled by 2^Shift. */
+    int32_t myAverage;
+
+    /** Indicate whether the average has been initialized by a sample. */
+    bool myInitialized;
+};
+} // namespace filter
+
+#include "impl/ema_impl.h"
@@ -0,0 +1,42 @@
+/**
+ * @brief Implementation details of filter::Ema class.
+ *
+ * @note Don't include this header, use <ema.h> instead!
+ */
+#pragma once
+
+#include "filter/impl/rounding.h"
+
+namespace filter
+{
+// -----------------------------------------------------------------------------
+template <typename T, uint8_t Shift>
+Ema<T, Shift>::Ema() noexcept
+    : myAverage{}
+    , myInitialized{false} {}
+
+// -----------------------------------------------------------------------------
+template <typename T, uint8_t Shift>
+T Ema<T, Shift>::update(const T sample) noexcept
+{
+    // Initialize the average with the first sample.
+    if (!myInitialized)
+    {
+        myAverage     = static_cast<int32_t>(sample) * Scale;
+        myInitialized = true;
+        return sample;
+    }
+
+    // Move the average towards the sample by alpha = 1 / 2^Shift of the difference.
+    myAverage += static_cast<int32_t>(sample) - detail::divideRounded(myAverage, Scale);
+    return static_cast<T>(detail::divideRounded(myAverage, Scale));
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, uint8_t Shift>
+void Ema<T, Shift>::reset() noexcept
+{
+    myAverage     = 0;
+    myInitialized = false;
+}
+} // namespace filter
@@ -0,0 +1,61 @@
+/**
+ * @brief Implementation details of filter::Median class.
+ *
+ * @note Don't include this header, use <median.h> instead!
+ */
+#pragma once
+
+namespace filter
+{
+// -----------------------------------------------------------------------------
+template <typename T, size_t WindowSize>
+Median<T, WindowSize>::Median() noexcept
+    : mySamples{}
+    , mySorted{}
+    , myIndex{}
+    , myCount{} {}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t WindowSize>
+T Median<T, WindowSize>::update(const T sample) noexcept
+{
+    // Remove the oldest sample from the sorted ring once the window is filled.
+    if (WindowSize == myCount) { remove(mySamples[myIndex]); }
+
+    // Store the new sample in both orders.
+    mySamples[myIndex] = sample;
+    myIndex = WindowSize - 1U > myIndex ? myIndex + 1U : 0U;
+    insert(sample);
+    return mySorted[myCount / 2U];
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t WindowSize>
+void Median<T, WindowSize>::reset() noexcept
+{
+    myIndex = 0U;
+    myCount = 0U;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t WindowSize>
+void Median<T, WindowSize>::remove(const T sample) noexcept
+{
+    // Find the sample, then close the gap by shifting the greater samples down.
+    uint8_t i{};
+    while ((myCount - 1U > i) && (mySorted[i] != sample)) { ++i; }
+    for (; i + 1U < myCount; ++i) { mySorted[i] = mySorted[i + 1U]; }
+    --myCount;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t WindowSize>
+void Median<T, WindowSize>::insert(const T sample) noexcept
+{
+    // Shift the greater samples up, then store the sample in the gap.
+    uint8_t i{myCount};
+    for (; (0U < i) && (mySorted[i - 1U] > sample); --i) { mySorted[i] = mySorted[i - 1U]; }
+    mySorted[i] = sample;
+    ++myCount;
+}
+} // namespace filter
@@ -0,0 +1,45 @@
+/**
+ * @brief Implementation details of filter::MovingAverage class.
+ *
+ * @note Don't include this header, use <moving_average.h> instead!
+ */
+#pragma once
+
+#include "filter/impl/rounding.h"
+
+namespace filter
+{
+// -----------------------------------------------------------------------------
+template <typename T, size_t WindowSize>
+MovingAverage<T, WindowSize>::MovingAverage() noexcept
+    : mySamples{}
+    , mySum{}
+    , myIndex{}
+    , myCount{} {}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t WindowSize>
+T MovingAverage<T, WindowSize>::update(const T sample) noexcept
+{
+    // Replace the oldest sample once the window is filled.
+    if (WindowSize == myCount) { mySum -= mySamples[myIndex]; }
+    else { ++myCount; }
+
+    mySamples[myIndex] = sample;
+    mySum += sample;
+    myIndex = WindowSize - 1U > myIndex ? myIndex + 1U : 0U;
+
+    // Divide by the window size once filled, which is a constant the compiler can optimize.
+    const int32_t count{WindowSize == myCount ? static_cast<int32_t>(WindowSize) : myCount};
+    return static_cast<T>(detail::divideRounded(mySum, count));
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t WindowSize>
+void MovingAverage<T, WindowSize>::reset() noexcept
+{
+    mySum   = 0;
+    myIndex = 0U;
+    myCount = 0U;
+}
+} // namespace filter
@@ -0,0 +1,27 @@
+/**
+ * @brief Rounding helpers shared by the filters.
+ *
+ * @note Don't include this header, use the filter headers instead!
+ */
+#pragma once
+
+#include <stdint.h>
+
+namespace filter
+{
+namespace detail
+{
+/**
+ * @brief Divide with rounding to the nearest integer, away from zero on ties.
+ *
+ * @param[in] dividend The dividend.
+ * @param[in] divisor The divisor. Must be greater than 0.
+ *
+ * @return The rounded quotient.
+ */
+constexpr int32_t divideRounded(const int32_t dividend, const int32_t divisor) noexcept
+{
+    return (0 <= dividend ? dividend + divisor / 2 : dividend - divisor / 2) / divisor;
+}
+} // namespace detail
+} // namespace filter
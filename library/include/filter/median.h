@@ -0,0 +1,85 @@
+/**
+ * @brief Median filter.
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "utils/type_traits.h"
+
+namespace filter
+{
+/**
+ * @brief Median filter for small windows.
+ *
+ *        The filter keeps the latest samples both in insertion order and in a sorted ring. 
+ *        Each update removes the oldest sample from the sorted ring and inserts the new sample
+ *        at its sorted position, which requires O(WindowSize) operations instead of sorting the
+ *        whole window. Median filters suppress single outliers, such as spikes from noise.
+ *
+ * @tparam T The sample type. Must be integral.
+ * @tparam WindowSize The number of samples in the window. Must be odd and at most 15.
+ */
+template <typename T, size_t WindowSize>
+class Median
+{
+    // Generate compiler errors if the parameters are invalid.
+    static_assert(type_traits::is_integral<T>::value, 
+                  "Median filters only support integral types!");
+    static_assert((1U == WindowSize % 2U) && (15U >= WindowSize), 
+                  "The window size must be odd and at most 15!");
+
+public:
+    /** Sample type. */
+    using Value = T;
+
+    /**
+     * @brief Create empty median filter.
+     */
+    Median() noexcept;
+
+    /**
+     * @brief Delete median filter.
+     */
+    ~Median() noexcept = default;
+
+    /**
+     * @brief Add a new sample to the filter.
+     *
+     * @param[in] sample The sample to add.
+     *
+     * @return The median of the samples in the window. Until the window is filled, the upper
+     *         median of the samples received so far is returned.
+     */
+    T update(T sample) noexcept;
+
+    /**
+     * @brief Clear all samples held by the filter.
+     */
+    void reset() noexcept;
+
+    Median(const Median&)            = delete; // No copy constructor.
+    Median(Median&&)                 = delete; // No move constructor.
+    Median& operator=(const Median&) = delete; // No copy assignment.
+    Median& operator=(Median&&)      = delete; // No move assignment.
+
+private:
+    void remove(T sample) noexcept;
+    void insert(T sample) noexcept;
+
+    /** Samples in insertion order, starting at myIndex when full. */
+    T mySamples[WindowSize];
+
+    /** Samples in ascending order. */
+    T mySorted[WindowSize];
+
+    /** Index of the oldest sample, which is replaced next. */
+    uint8_t myIndex;
+
+    /** The number of samples in the window. */
+    uint8_t myCount;
+};
+} // namespace filter
+
+#include "impl/median_impl.h"
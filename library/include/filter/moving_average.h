@@ -0,0 +1,79 @@
+/**
+ * @brief Moving average filter.
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "utils/type_traits.h"
+
+namespace filter
+{
+/**
+ * @brief Moving average filter with incremental O(1) updates.
+ *
+ *        The filter keeps the latest samples in a static ring and a running sum, so that each 
+ *        update only subtracts the oldest sample and adds the new one. Until the window is 
+ *        filled, the average of the samples received so far is returned.
+ *
+ * @tparam T The sample type. Must be an integral type of at most 16 bits.
+ * @tparam WindowSize The number of samples to average. Must be between 1 and 255.
+ */
+template <typename T, size_t WindowSize>
+class MovingAverage
+{
+    // Generate compiler errors if the parameters are invalid.
+    static_assert(type_traits::is_integral<T>::value && (2U >= sizeof(T)), 
+                  "Moving average filters only support integral types of at most 16 bits!");
+    static_assert((0U < WindowSize) && (UINT8_MAX >= WindowSize), "Invalid window size!");
+
+public:
+    /** Sample type. */
+    using Value = T;
+
+    /**
+     * @brief Create empty moving average filter.
+     */
+    MovingAverage() noexcept;
+
+    /**
+     * @brief Delete moving average filter.
+     */
+    ~MovingAverage() noexcept = default;
+
+    /**
+     * @brief Add a new sample to the filter.
+     *
+     * @param[in] sample The sample to add.
+     *
+     * @return The average of the samples in the window, rounded to the nearest integer.
+     */
+    T update(T sample) noexcept;
+
+    /**
+     * @brief Clear all samples held by the filter.
+     */
+    void reset() noexcept;
+
+    MovingAverage(const MovingAverage&)            = delete; // No copy constructor.
+    MovingAverage(MovingAverage&&)                 = delete; // No move constructor.
+    MovingAverage& operator=(const MovingAverage&) = delete; // No copy assignment.
+    MovingAverage& operator=(MovingAverage&&)      = delete; // No move assignment.
+
+private:
+    /** Samples in the window, in insertion order starting at myIndex when full. */
+    T mySamples[WindowSize];
+
+    /** Sum of the samples in the window. */
+    int32_t mySum;
+
+    /** Index of the oldest sample, which is replaced next. */
+    uint8_t myIndex;
+
+    /** The number of samples in the window. */
+    uint8_t myCount;
+};
+} // namespace filter
+
+#include "impl/moving_average_impl.h"
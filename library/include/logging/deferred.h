@@ -0,0 +1,126 @@
+/**
+ * @brief Deferred logging, where messages are formatted on the host rather than the device.
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "container/ring_buffer.h"
+#include "driver/serial/protocol.h"
+#include "logging/messages.h"
+#include "utils/type_traits.h"
+
+namespace logging
+{
+/**
+ * @brief Deferred logger in the style of defmt.
+ * 
+ *        Rather than formatting a string on the device, each log statement only stores the 
+ *        message id and the raw arguments as zigzag encoded varints in a ring buffer:
+ * 
+ *            [record size (1 byte)][id (varint)][arguments (varints, 1-5 bytes each)]
+ * 
+ *        The records are drained to the serial port in the background by calling flush(), 
+ *        typically from the main loop. Each record is transmitted as a protocol frame of type
+ *        driver::serial::MessageType::Log, holding the id followed by the arguments. The host 
+ *        formats the message using the table in logging/messages.h, see host::protocol::format.
+ * 
+ *        Log statements may be issued from interrupt service routines. Records are dropped 
+ *        if the ring buffer is full; the number of dropped records is available via 
+ *        droppedRecords().
+ * 
+ *        This class is non-copyable and non-movable.
+ */
+class Deferred
+{
+public:
+    /** Size of the record buffer in bytes. */
+    static constexpr size_t BufferSize{128U};
+
+    /** Maximum number of arguments per log statement. */
+    static constexpr uint8_t MaxArgCount{driver::serial::Message::MaxValueCount - 1U};
+
+    /**
+     * @brief Constructor.
+     * 
+     * @param[in] protocol Protocol used for transmitting the records.
+     */
+    explicit Deferred(const driver::serial::Protocol& protocol) noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~Deferred() noexcept = default;
+
+    /**
+     * @brief Store a log record for deferred transmission.
+     * 
+     * @tparam Args The argument types, which must be integral types of at most 32 bits.
+     * 
+     * @param[in] id The log message id.
+     * @param[in] args The arguments of the log message.
+     * 
+     * @return True if the record was stored, false if the id is invalid or the buffer is full.
+     */
+    template <typename... Args>
+    bool log(Id id, const Args&... args) noexcept;
+
+    /**
+     * @brief Transmit stored records via the serial port.
+     * 
+     * @param[in] maxRecords The maximum number of records to transmit (default = all).
+     * 
+     * @return The number of transmitted records.
+     */
+    uint16_t flush(uint16_t maxRecords = UINT16_MAX) noexcept;
+
+    /**
+     * @brief Get the number of bytes waiting to be transmitted.
+     * 
+     * @return The number of pending bytes in the record buffer.
+     */
+    size_t pendingBytes() const noexcept;
+
+    /**
+     * @brief Get the number of records dropped due to a full buffer.
+     * 
+     * @return The number of dropped records.
+     */
+    uint16_t droppedRecords() const noexcept;
+
+    Deferred()                           = delete; // No default constructor.
+    Deferred(const Deferred&)            = delete; // No copy constructor.
+    Deferred(Deferred&&)                 = delete; // No move constructor.
+    Deferred& operator=(const Deferred&) = delete; // No copy assignment.
+    Deferred& operator=(Deferred&&)      = delete; // No move assignment.
+
+private:
+    bool store(Id id, const int32_t* args, uint8_t argCount) noexcept;
+
+    /** Protocol used for transmitting the records. */
+    const driver::serial::Protocol& myProtocol;
+
+    /** Ring buffer holding encoded records. */
+    container::RingBuffer<uint8_t, BufferSize> myBuffer;
+
+    /** The number of records dropped due to a full buffer. */
+    volatile uint16_t myDroppedRecords;
+};
+
+// -----------------------------------------------------------------------------
+template <typename... Args>
+bool Deferred::log(const Id id, const Args&... args) noexcept
+{
+    // Generate compiler errors for unsupported arguments.
+    static_assert(MaxArgCount >= sizeof...(Args), "Too many log arguments!");
+    static_assert((true && ... && type_traits::is_integral<Args>::value), 
+                  "Log arguments must be integral types!");
+    static_assert((true && ... && (sizeof(int32_t) >= sizeof(Args))), 
+                  "Log arguments must be at most 32 bits wide!");
+
+    // Store the arguments as 32-bit values, unsigned values are reinterpreted on the host.
+    const int32_t values[sizeof...(Args) + 1U]{static_cast<int32_t>(args)...};
+    return store(id, values, sizeof...(Args));
+}
+} // namespace logging
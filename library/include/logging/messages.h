@@ -0,0 +1,65 @@
+/**
+ * @brief Table of deferred log messages.
+ */
+#pragma once
+
+#include <inttypes.h>
+#include <stdint.h>
+
+/**
+ * @brief Table of log messages, listed as X(id, format string).
+ * 
+ *        Each message is assigned an id in order of appearance. The device only transmits the id
+ *        and the raw arguments of a message, while the host formats the message using the same 
+ *        table. New messages must therefore be appended at the end of the table to keep the ids
+ *        of existing messages stable.
+ * 
+ *        The format strings use printf conversions for integer arguments only. Use the PRI 
+ *        macros for 32-bit arguments, since the width of int differs between the MCU and the host.
+ */
+#define LOGGING_MESSAGES(X)                                                                 \
+    X(SystemRunning,  "Running the system!\n")                                              \
+    X(InitFailed,     "Failed to run the system: initialization failed!\n")                 \
+    X(ToggleEnabled,  "Toggle timer enabled!\n")                                            \
+    X(ToggleDisabled, "Toggle timer disabled!\n")                                           \
+    X(Temperature,    "Temperature: %d Celsius\n")                                          \
+    X(CommandUnknown, "Unknown command!\n")                                                 \
+    X(CommandInvalid, "Invalid command arguments!\n")                                       \
+    X(CommandTooLong, "Command too long!\n")                                                \
+    X(ToggleTimeout,  "Toggle timeout: %" PRIu32 " ms\n")                                   \
+    X(TempPeriod,     "Temperature period: %" PRIu32 " ms\n")                               \
+    X(EepromValue,    "EEPROM[%u]: 0x%02x\n")                                               \
+    X(CommandStats,   "Command %u: %u calls, last %" PRIu32 " us, max %" PRIu32 " us\n")
+
+namespace logging
+{
+/**
+ * @brief Enumeration of log message ids.
+ */
+enum class Id : uint16_t
+{
+#define LOGGING_ID(id, format) id,
+    LOGGING_MESSAGES(LOGGING_ID)
+#undef LOGGING_ID
+    Count, // Number of log messages.
+};
+
+/**
+ * @brief Get the format string of given log message.
+ * 
+ * @param[in] id The log message id.
+ * 
+ * @return The format string of the log message, or nullptr if the id is invalid.
+ */
+constexpr const char* format(const Id id) noexcept
+{
+    switch (id)
+    {
+#define LOGGING_FORMAT(id, format) case Id::id: return format;
+        LOGGING_MESSAGES(LOGGING_FORMAT)
+#undef LOGGING_FORMAT
+        default:
+            return nullptr;
+    }
+}
+} // namespace logging
@@ -0,0 +1,245 @@
+/**
+ * @brief Zero-copy serial command interpreter.
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "driver/serial/interface.h"
+
+namespace logic
+{
+namespace command
+{
+/**
+ * @brief Clock used for measuring command latency.
+ *
+ * @return The current time in microseconds.
+ */
+using Clock = uint32_t (*)() noexcept;
+
+/**
+ * @brief Enumeration of command status codes.
+ */
+enum class Status : uint8_t
+{
+    Ok,          // The command was handled successfully.
+    Empty,       // The command line was empty.
+    Unknown,     // The command is unknown.
+    InvalidArgs, // The command arguments are invalid.
+    Overflow,    // The command line was too long.
+    Count,       // Number of status codes.
+};
+
+/**
+ * @brief Structure of command arguments.
+ *
+ *        The arguments point directly into the receive buffer of the interpreter and are only
+ *        valid during the execution of the command.
+ */
+struct Args
+{
+    /** Maximum number of arguments per command. */
+    static constexpr uint8_t MaxCount{4U};
+
+    /** Null-terminated arguments. */
+    const char* values[MaxCount];
+
+    /** The number of arguments. */
+    uint8_t count;
+
+    /**
+     * @brief Parse argument as an unsigned decimal integer.
+     *
+     * @param[in] index Index of the argument.
+     * @param[out] value Reference to variable for storing the parsed value.
+     *
+     * @return True if the argument exists and is a valid integer, false otherwise.
+     */
+    bool toUint(uint8_t index, uint32_t& value) const noexcept;
+};
+
+/**
+ * @brief Structure of a command table entry.
+ *
+ * @tparam Context The type of the context passed to the command handlers.
+ */
+template <typename Context>
+struct Entry
+{
+    /** Command name. */
+    const char* name;
+
+    /** Command handler. */
+    Status (*handler)(Context& context, const Args& args) noexcept;
+};
+
+/**
+ * @brief Structure of command statistics.
+ */
+struct Statistics
+{
+    /** The number of times the command was executed. */
+    uint16_t callCount;
+
+    /** Handling latency of the last execution in microseconds. */
+    uint32_t lastLatency_us;
+
+    /** Maximum handling latency in microseconds. */
+    uint32_t maxLatency_us;
+};
+
+/**
+ * @brief Split a command line into whitespace-separated tokens in place.
+ *
+ *        Each whitespace character following a token is replaced by a null character, so
+ *        that the tokens point directly into the given line without copying.
+ *
+ * @param[in, out] line The null-terminated command line to tokenize.
+ * @param[out] tokens Array for storing pointers to the tokens.
+ * @param[in] maxTokens The maximum number of tokens to store.
+ *
+ * @return The number of tokens, or maxTokens + 1 if the line holds too many tokens.
+ */
+uint8_t tokenize(char* line, const char** tokens, uint8_t maxTokens) noexcept;
+
+/**
+ * @brief Check whether the names of the given command table are unique.
+ *
+ * @tparam Context The type of the context passed to the command handlers.
+ * @tparam CommandCount The number of commands.
+ *
+ * @param[in] table The command table.
+ *
+ * @return True if all command names are unique and valid, false otherwise.
+ */
+template <typename Context, size_t CommandCount>
+constexpr bool isUnique(const Entry<Context> (&table)[CommandCount]) noexcept;
+
+/**
+ * @brief Zero-copy serial command interpreter.
+ *
+ *        Received bytes are stored in a static line buffer until a new line is received.
+ *        The line is then tokenized in place and the first token is looked up in a command
+ *        table, which is typically a constant array placed in read-only memory. The remaining
+ *        tokens are passed to the handler as arguments. No data is copied and no heap memory
+ *        is used.
+ *
+ *        The handling latency of each command is measured if a clock is provided.
+ *
+ *        This class is non-copyable and non-movable.
+ *
+ * @tparam Context The type of the context passed to the command handlers.
+ * @tparam CommandCount The number of commands.
+ * @tparam LineSize The size of the line buffer in bytes, including the null terminator.
+ */
+template <typename Context, size_t CommandCount, size_t LineSize = 32U>
+class Interpreter
+{
+    // Generate compiler errors if the parameters are invalid.
+    static_assert(0U < CommandCount, "The command table cannot be empty!");
+    static_assert((1U < LineSize) && (UINT8_MAX >= LineSize), "Invalid line buffer size!");
+
+public:
+    /** Command table type. */
+    using Table = Entry<Context>[CommandCount];
+
+    /**
+     * @brief Constructor.
+     *
+     * @param[in] table The command table, which must outlive the interpreter.
+     * @param[in] clock Clock for measuring command latency (default = none).
+     */
+    explicit Interpreter(const Table& table, Clock clock = nullptr) noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~Interpreter() noexcept = default;
+
+    /**
+     * @brief Get the number of commands.
+     *
+     * @return The number of commands in the command table.
+     */
+    static constexpr size_t commandCount() noexcept { return CommandCount; }
+
+    /**
+     * @brief Get the name of given command.
+     *
+     * @param[in] index Index of the command in the command table.
+     *
+     * @return The name of the command, or nullptr if the index is invalid.
+     */
+    const char* name(uint8_t index) const noexcept;
+
+    /**
+     * @brief Get the statistics of given command.
+     *
+     * @param[in] index Index of the command in the command table.
+     *
+     * @return Pointer to the command statistics, or nullptr if the index is invalid.
+     */
+    const Statistics* statistics(uint8_t index) const noexcept;
+
+    /**
+     * @brief Set the clock used for measuring command latency.
+     *
+     * @param[in] clock The new clock, or nullptr to disable latency measurement.
+     */
+    void setClock(Clock clock) noexcept;
+
+    /**
+     * @brief Execute a command line.
+     *
+     * @param[in] context The context to pass to the command handler.
+     * @param[in, out] line The null-terminated command line, which is tokenized in place.
+     *
+     * @return The status of the command.
+     */
+    Status execute(Context& context, char* line) noexcept;
+
+    /**
+     * @brief Read received bytes and execute the command once a complete line is received.
+     *
+     *        Lines are terminated by a new line or carriage return. Empty lines are ignored.
+     *
+     * @param[in] serial Serial device to read from.
+     * @param[in] context The context to pass to the command handler.
+     * @param[out] status Reference to variable for storing the status of executed command.
+     *
+     * @return True if a command line was executed, false otherwise.
+     */
+    bool poll(const driver::serial::Interface& serial, Context& context,
+              Status& status) noexcept;
+
+    Interpreter()                              = delete; // No default constructor.
+    Interpreter(const Interpreter&)            = delete; // No copy constructor.
+    Interpreter(Interpreter&&)                 = delete; // No move constructor.
+    Interpreter& operator=(const Interpreter&) = delete; // No copy assignment.
+    Interpreter& operator=(Interpreter&&)      = delete; // No move assignment.
+
+private:
+    /** Command table. */
+    const Table& myTable;
+
+    /** Statistics of each command. */
+    Statistics myStatistics[CommandCount];
+
+    /** Line buffer holding received bytes. */
+    char myLine[LineSize];
+
+    /** Clock for measuring command latency. */
+    Clock myClock;
+
+    /** The number of bytes held by the line buffer. */
+    uint8_t myLength;
+
+    /** Indicate whether the current line has exceeded the line buffer. */
+    bool myOverflow;
+};
+} // namespace command
+} // namespace logic
+
+#include "impl/command_impl.h"
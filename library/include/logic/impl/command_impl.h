@@ -0,0 +1,145 @@
+/**
+ * @brief Implementation details of the serial command interpreter.
+ *
+ * @note Don't include this header, use <command.h> instead!
+ */
+#pragma once
+
+namespace logic
+{
+namespace command
+{
+namespace detail
+{
+// -----------------------------------------------------------------------------
+constexpr bool isEqual(const char* lhs, const char* rhs) noexcept
+{
+    // Compare the strings character by character.
+    while (('\0' != *lhs) && (*lhs == *rhs))
+    {
+        ++lhs;
+        ++rhs;
+    }
+    return *lhs == *rhs;
+}
+} // namespace detail
+
+// -----------------------------------------------------------------------------
+template <typename Context, size_t CommandCount>
+constexpr bool isUnique(const Entry<Context> (&table)[CommandCount]) noexcept
+{
+    for (size_t i{}; i < CommandCount; ++i)
+    {
+        // Return false if the entry is incomplete or if the name has already been used.
+        if ((nullptr == table[i].name) || ('\0' == *table[i].name) || 
+            (nullptr == table[i].handler)) 
+        { 
+            return false; 
+        }
+        for (size_t j{}; j < i; ++j)
+        {
+            if (detail::isEqual(table[i].name, table[j].name)) { return false; }
+        }
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename Context, size_t CommandCount, size_t LineSize>
+Interpreter<Context, CommandCount, LineSize>::Interpreter(const Table& table, 
+                                                          const Clock clock) noexcept
+    : myTable{table}
+    , myStatistics{}
+    , myLine{}
+    , myClock{clock}
+    , myLength{}
+    , myOverflow{false}
+{}
+
+// -----------------------------------------------------------------------------
+template <typename Context, size_t CommandCount, size_t LineSize>
+const char* Interpreter<Context, CommandCount, LineSize>::name(const uint8_t index) const noexcept
+{
+    return CommandCount > index ? myTable[index].name : nullptr;
+}
+
+// -----------------------------------------------------------------------------
+template <typename Context, size_t CommandCount, size_t LineSize>
+const Statistics* 
+    Interpreter<Context, CommandCount, LineSize>::statistics(const uint8_t index) const noexcept
+{
+    return CommandCount > index ? &myStatistics[index] : nullptr;
+}
+
+// -----------------------------------------------------------------------------
+template <typename Context, size_t CommandCount, size_t LineSize>
+void Interpreter<Context, CommandCount, LineSize>::setClock(const Clock clock) noexcept 
+{ 
+    myClock = clock; 
+}
+
+// -----------------------------------------------------------------------------
+template <typename Context, size_t CommandCount, size_t LineSize>
+Status Interpreter<Context, CommandCount, LineSize>::execute(Context& context, 
+                                                             char* line) noexcept
+{
+    // Split the line into the command name followed by the arguments.
+    const char* tokens[Args::MaxCount + 1U]{};
+    const uint8_t tokenCount{tokenize(line, tokens, Args::MaxCount + 1U)};
+    if (0U == tokenCount) { return Status::Empty; }
+    if (Args::MaxCount + 1U < tokenCount) { return Status::InvalidArgs; }
+
+    Args args{{}, static_cast<uint8_t>(tokenCount - 1U)};
+    for (uint8_t i{}; i < args.count; ++i) { args.values[i] = tokens[i + 1U]; }
+
+    // Look up the command, execute the handler and update the statistics.
+    for (uint8_t i{}; i < CommandCount; ++i)
+    {
+        if (!detail::isEqual(tokens[0U], myTable[i].name)) { continue; }
+
+        const uint32_t start{nullptr != myClock ? myClock() : 0U};
+        const Status status{myTable[i].handler(context, args)};
+        const uint32_t latency_us{nullptr != myClock ? myClock() - start : 0U};
+
+        Statistics& statistics{myStatistics[i]};
+        if (UINT16_MAX > statistics.callCount) { statistics.callCount++; }
+        statistics.lastLatency_us = latency_us;
+        if (latency_us > statistics.maxLatency_us) { statistics.maxLatency_us = latency_us; }
+        return status;
+    }
+    // Return unknown status if no matching command was found.
+    return Status::Unknown;
+}
+
+// -----------------------------------------------------------------------------
+template <typename Context, size_t CommandCount, size_t LineSize>
+bool Interpreter<Context, CommandCount, LineSize>::poll(const driver::serial::Interface& serial,
+                                                        Context& context, 
+                                                        Status& status) noexcept
+{
+    uint8_t byte{};
+
+    // Read the received bytes one at a time directly into the line buffer. Only read when a
+    // byte is available, so that polling an idle serial port doesn't block.
+    while (serial.isDataAvailable() && (1 == serial.read(&byte, 1U, 1U)))
+    {
+        const char character{static_cast<char>(byte)};
+
+        if (('\n' == character) || ('\r' == character))
+        {
+            // Ignore empty lines, such as the second half of a "\r\n" line ending.
+            if (!myOverflow && (0U == myLength)) { continue; }
+            myLine[myLength] = '\0';
+            status           = myOverflow ? Status::Overflow : execute(context, myLine);
+            myLength         = 0U;
+            myOverflow       = false;
+            return true;
+        }
+        // Store the received byte, drop the line if it's too long.
+        else if (LineSize - 1U > myLength) { myLine[myLength++] = character; }
+        else { myOverflow = true; }
+    }
+    return false;
+}
+} // namespace command
+} // namespace logic
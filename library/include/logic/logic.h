@@ -3,6 +3,12 @@
  */
 #pragma once
 
+#include <stdint.h>
+
+#include "driver/serial/interface.h"
+#include "driver/serial/protocol.h"
+#include "logging/deferred.h"
+#include "logic/command.h"
 #include "logic/interface.h"
 
 namespace driver
@@ -32,6 +38,17 @@ namespace watchdog { class Interface; }
 
 namespace logic
 {
+/**
+ * @brief Enumeration of serial output formats.
+ */
+enum class OutputFormat : uint8_t
+{
+    Text,     // Human-readable text messages.
+    Binary,   // Compact binary frames, see driver::serial::Protocol.
+    Deferred, // Text messages as deferred log records, see logging::Deferred.
+    Count,    // Number of supported output formats.
+};
+
 /**
  * @brief Generic logic for an MCU with configurable hardware devices.
  * 
@@ -45,7 +62,15 @@ namespace logic
  *            - A watchdog timer to restart the program if it gets stuck somewhere.
  *            - An EEPROM stream to store the LED state. On startup, this value is read; if the
  *              last stored state before power down was "on," the LED will automatically blink.
- *            - A temperature sensor to read the surrounding temperature.
+ *            - A temperature sensor to read the surrounding temperature. Temperature reads
+ *              are started from interrupt context without blocking, then the readings are
+ *              printed from the main loop.
+ * 
+ *        The following commands can be sent via the serial port, terminated by a new line:
+ *            - toggle [timeout_ms]: Set (or print) the toggle timer timeout.
+ *            - temp [period_ms]: Set (or print) the temperature timer period.
+ *            - eeprom <address> [count]: Read up to 16 bytes from EEPROM.
+ *            - stats: Print the number of calls and handling latency of each command.
  * 
  *        This class is non-copyable and non-movable.
  */
@@ -99,7 +124,8 @@ public:
     /**
      * @brief Handle button event.
      * 
-     *        Toggle the timer whenever the toggle button is pressed. 
+     *        Toggle the timer whenever the toggle button is pressed, the new toggle state is
+     *        printed from the main loop. 
      *        Predict the temperature and restart the temperature timer whenever the temperature 
      *        button is pressed.
      * 
@@ -126,10 +152,58 @@ public:
     /**
      * @brief Handle temperature timer timeout.
      * 
-     *        Read the surrounding temperature.
+     *        Start a non-blocking read of the surrounding temperature, which is printed from 
+     *        the main loop once complete.
      */
     void handleTempTimerTimeout() noexcept override;
 
+    /**
+     * @brief Get the serial output format.
+     * 
+     * @return The serial output format.
+     */
+    OutputFormat outputFormat() const noexcept;
+
+    /**
+     * @brief Set the serial output format.
+     * 
+     *        Use binary output to transmit temperature and state messages as compact frames
+     *        rather than text. Use deferred output to transmit all messages as deferred log
+     *        records, which are formatted on the host. In binary output format, status
+     *        messages are transmitted as deferred log records as well.
+     * 
+     * @param[in] format The new output format.
+     */
+    void setOutputFormat(OutputFormat format) noexcept;
+
+    /**
+     * @brief Execute a command line.
+     * 
+     *        Commands received via the serial port are executed from the main loop. 
+     *        An error message is printed if the command fails.
+     * 
+     * @param[in, out] line The null-terminated command line, which is tokenized in place.
+     * 
+     * @return The status of the command.
+     */
+    command::Status executeCommand(char* line) noexcept;
+
+    /**
+     * @brief Get the statistics of given command.
+     * 
+     * @param[in] index Index of the command, see the class description for the order.
+     * 
+     * @return Pointer to the command statistics, or nullptr if the index is invalid.
+     */
+    const command::Statistics* commandStatistics(uint8_t index) const noexcept;
+
+    /**
+     * @brief Set the clock used for measuring command handling latency.
+     * 
+     * @param[in] clock The new clock, or nullptr to disable latency measurement.
+     */
+    void setCommandClock(command::Clock clock) noexcept;
+
     Logic()                        = delete; // No default constructor.
     Logic(const Logic&)            = delete; // No copy constructor.
     Logic(Logic&&)                 = delete; // No move constructor.
@@ -138,22 +212,45 @@ public:
 
 protected:
     driver::serial::Interface& serial() noexcept { return mySerial; }
+    const driver::serial::Protocol& protocol() const noexcept { return myProtocol; }
     driver::eeprom::Interface& eeprom() noexcept { return myEeprom; }
     driver::tempsensor::Interface& tempSensor() noexcept { return myTempSensor; }
     static uint16_t toggleStateAddr() noexcept { return ToggleStateAddr; }
 
+    template <typename... Args>
+    void print(logging::Id id, const Args&... args) noexcept;
+
     virtual void writeToggleStateToEeprom(bool enable) noexcept;
     virtual bool readToggleStateFromEeprom() const noexcept;
-    virtual void printTemperature() noexcept;
+    virtual void printTemperature(int16_t temperature) noexcept;
 
 private:
     void handleToggleButtonPressed() noexcept;
     void handleTempButtonPressed() noexcept;
     void restoreToggleStateFromEeprom() noexcept;
+    void printToggleState(bool enabled) noexcept;
+    void pollToggleState() noexcept;
+    void pollTemperature() noexcept;
+    void pollCommands() noexcept;
+    void printCommandStatus(command::Status status) noexcept;
+
+    static command::Status setToggleTimeout(Logic& logic, const command::Args& args) noexcept;
+    static command::Status setTempPeriod(Logic& logic, const command::Args& args) noexcept;
+    static command::Status readEeprom(Logic& logic, const command::Args& args) noexcept;
+    static command::Status dumpStats(Logic& logic, const command::Args& args) noexcept;
 
     /** Toggle state address in EEPROM. */
     static constexpr uint16_t ToggleStateAddr{0U};
 
+    /** The number of serial commands. */
+    static constexpr uint8_t CommandCount{4U};
+
+    /** Maximum number of bytes to read from EEPROM per command. */
+    static constexpr uint8_t MaxEepromReadCount{16U};
+
+    /** Table of serial commands. */
+    static const command::Entry<Logic> Commands[CommandCount];
+
     /** Reference to the LED to toggle. */
     driver::gpio::Interface& myLed;
 
@@ -183,5 +280,29 @@ private:
 
     /** Temperature sensor. */
     driver::tempsensor::Interface& myTempSensor;
+
+    /** Binary protocol for transmitting messages via the serial device. */
+    driver::serial::Protocol myProtocol;
+
+    /** Deferred logger for transmitting log records via the serial device. */
+    logging::Deferred myLogger;
+
+    /** Interpreter for commands received via the serial device. */
+    command::Interpreter<Logic, CommandCount> myCommands;
+
+    /** Serial output format. */
+    OutputFormat myOutputFormat;
+
+    /** Indicate whether the toggle state has changed and should be printed. */
+    volatile bool myToggleStateChanged;
 };
+
+// -----------------------------------------------------------------------------
+template <typename... Args>
+void Logic::print(const logging::Id id, const Args&... args) noexcept
+{
+    // Format the message on the device in text output format only.
+    if (OutputFormat::Text == myOutputFormat) { mySerial.printf(logging::format(id), args...); }
+    else { myLogger.log(id, args...); }
+}
 } // namespace logic
\ No newline at end of file
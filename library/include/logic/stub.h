@@ -31,11 +31,18 @@ public:
     
     /**
      * @brief Print the temperature in the terminal.
+     * 
+     * @param[in] temperature The temperature in degrees Celsius.
      */
-    void printTemperature() noexcept override
+    void printTemperature(const int16_t temperature) noexcept override
     {
-        // Read and print the temperature.
-        serial().printf("Simulated temperature: %d Celsius\n", tempSensor().read());
+        // Print the temperature in the selected output format.
+        if (OutputFormat::Binary == outputFormat()) { protocol().sendTemperature(temperature); }
+        else if (OutputFormat::Deferred == outputFormat()) 
+        { 
+            print(logging::Id::Temperature, temperature); 
+        }
+        else { serial().printf("Simulated temperature: %d Celsius\n", temperature); }
         myTempPrintouts++;
     }
 
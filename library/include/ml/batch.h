@@ -0,0 +1,50 @@
+/**
+ * @brief Batch kernels for evaluating regression models over many inputs.
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace ml
+{
+namespace batch
+{
+/**
+ * @brief Evaluate an affine function over many inputs, output[i] = scale * input[i] + offset.
+ * 
+ *        On the host, blocks of inputs are processed with SIMD vector operations, while 
+ *        a scalar loop is used on the MCU, which has no vector unit.
+ * 
+ * @param[in] input The inputs.
+ * @param[out] output Buffer for storing the outputs, one per input. May be the input.
+ * @param[in] count The number of inputs.
+ * @param[in] scale The factor to multiply each input with.
+ * @param[in] offset The offset to add to each product.
+ * 
+ * @return True on success, false if the input or output is null while count isn't 0.
+ */
+bool affine(const double* input, double* output, size_t count, double scale, 
+            double offset) noexcept;
+
+/**
+ * @brief Evaluate a polynomial over many normalized inputs.
+ * 
+ *        Each output is sum(coefficients[k] * t^k) with t = (input[i] - inputOffset) * 
+ *        inputScale, evaluated with Horner's method. On the host, blocks of inputs are 
+ *        processed with SIMD vector operations, while a scalar loop is used on the MCU.
+ * 
+ * @param[in] input The inputs.
+ * @param[out] output Buffer for storing the outputs, one per input. May be the input.
+ * @param[in] count The number of inputs.
+ * @param[in] coefficients The coefficients in ascending order of powers.
+ * @param[in] degree The degree of the polynomial, one less than the number of coefficients.
+ * @param[in] inputOffset The offset to subtract from each input.
+ * @param[in] inputScale The factor to multiply each offset input with.
+ * 
+ * @return True on success, false if a pointer is null while count isn't 0.
+ */
+bool polynomial(const double* input, double* output, size_t count, const double* coefficients, 
+                uint8_t degree, double inputOffset, double inputScale) noexcept;
+} // namespace batch
+} // namespace ml
@@ -0,0 +1,426 @@
+/**
+ * @brief Implementation details of ml::Matrix class and linear algebra kernels.
+ *
+ * @note Don't include this header, use <matrix.h> instead!
+ */
+#pragma once
+
+#include <math.h>
+
+#include "utils/utils.h"
+
+namespace ml
+{
+// -----------------------------------------------------------------------------
+template <typename T>
+VectorView<T>::VectorView(T* data, const size_t size, const size_t stride) noexcept
+    : myData{data}
+    , mySize{size}
+    , myStride{stride}
+{}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+template <typename U>
+VectorView<T>::VectorView(const VectorView<U>& other) noexcept
+    : myData{other.data()}
+    , mySize{other.size()}
+    , myStride{other.stride()}
+{}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+size_t VectorView<T>::size() const noexcept { return mySize; }
+
+// -----------------------------------------------------------------------------
+template <typename T>
+size_t VectorView<T>::stride() const noexcept { return myStride; }
+
+// -----------------------------------------------------------------------------
+template <typename T>
+T* VectorView<T>::data() const noexcept { return myData; }
+
+// -----------------------------------------------------------------------------
+template <typename T>
+T& VectorView<T>::operator[](const size_t index) const noexcept
+{
+    return myData[index * myStride];
+}
+
+namespace detail
+{
+/**
+ * @brief Storage of matrices with compile-time dimensions.
+ */
+template <typename T, size_t Rows, size_t Cols>
+class MatrixStorage
+{
+public:
+    /** Create zero-initialized storage. */
+    MatrixStorage() noexcept
+        : myData{}
+    {}
+
+    /** Delete storage. */
+    ~MatrixStorage() noexcept = default;
+
+    /** Get the dimensions and the elements. */
+    size_t rows() const noexcept { return Rows; }
+    size_t cols() const noexcept { return Cols; }
+    T* data() noexcept { return myData; }
+    const T* data() const noexcept { return myData; }
+
+    /** Accept the compile-time dimensions only. */
+    bool resize(const size_t rows, const size_t cols) noexcept
+    {
+        return (Rows == rows) && (Cols == cols);
+    }
+
+    MatrixStorage(const MatrixStorage&)            = delete; // No copy constructor.
+    MatrixStorage(MatrixStorage&&)                 = delete; // No move constructor.
+    MatrixStorage& operator=(const MatrixStorage&) = delete; // No copy assignment.
+    MatrixStorage& operator=(MatrixStorage&&)      = delete; // No move assignment.
+
+private:
+    /** Statically-sized elements. */
+    T myData[Rows * Cols];
+};
+
+/**
+ * @brief Storage of matrices with runtime dimensions in a single heap allocation.
+ */
+template <typename T>
+class MatrixStorage<T, 0U, 0U>
+{
+public:
+    /** Create empty storage. */
+    MatrixStorage() noexcept
+        : myData{nullptr}
+        , myRows{}
+        , myCols{}
+    {}
+
+    /** Release the elements. */
+    ~MatrixStorage() noexcept { utils::deleteMemory(myData); }
+
+    /** Get the dimensions and the elements. */
+    size_t rows() const noexcept { return myRows; }
+    size_t cols() const noexcept { return myCols; }
+    T* data() noexcept { return myData; }
+    const T* data() const noexcept { return myData; }
+
+    /** Resize the storage, the elements are left uninitialized. */
+    bool resize(const size_t rows, const size_t cols) noexcept
+    {
+        // Release the elements if the matrix is emptied.
+        if ((0U == rows) || (0U == cols))
+        {
+            utils::deleteMemory(myData);
+            myRows = 0U;
+            myCols = 0U;
+            return (0U == rows) && (0U == cols);
+        }
+
+        // Keep the allocation if the element count is unchanged, otherwise reallocate.
+        if (rows * cols != myRows * myCols)
+        {
+            T* data{utils::reallocMemory<T>(myData, rows * cols)};
+            if (nullptr == data) { return false; }
+            myData = data;
+        }
+        myRows = rows;
+        myCols = cols;
+        return true;
+    }
+
+    MatrixStorage(const MatrixStorage&)            = delete; // No copy constructor.
+    MatrixStorage(MatrixStorage&&)                 = delete; // No move constructor.
+    MatrixStorage& operator=(const MatrixStorage&) = delete; // No copy assignment.
+    MatrixStorage& operator=(MatrixStorage&&)      = delete; // No move assignment.
+
+private:
+    /** Heap-allocated elements. */
+    T* myData;
+
+    /** The number of rows. */
+    size_t myRows;
+
+    /** The number of columns. */
+    size_t myCols;
+};
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t R1, size_t C1, size_t R2, size_t C2>
+bool isAlias(const Matrix<T, R1, C1>& x, const Matrix<T, R2, C2>& y) noexcept
+{
+    return !x.empty() && (x.data() == y.data());
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void multiply(const T* a, const T* b, T* out, const size_t n, const size_t m,
+              const size_t p) noexcept
+{
+    // Number of output columns accumulated in registers at a time.
+    constexpr size_t BlockSize{4U};
+
+    for (size_t i{}; i < n; ++i)
+    {
+        const T* aRow{a + i * m};
+        T* outRow{out + i * p};
+        size_t j0{};
+
+        // Accumulate blocks of adjacent output elements, reading adjacent elements of b.
+        for (; j0 + BlockSize <= p; j0 += BlockSize)
+        {
+            T sum[BlockSize]{};
+            for (size_t k{}; k < m; ++k)
+            {
+                const T scale{aRow[k]};
+                const T* bBlock{b + k * p + j0};
+                for (size_t j{}; j < BlockSize; ++j) { sum[j] += scale * bBlock[j]; }
+            }
+            for (size_t j{}; j < BlockSize; ++j) { outRow[j0 + j] = sum[j]; }
+        }
+
+        // Compute the remaining output elements one at a time.
+        for (; j0 < p; ++j0)
+        {
+            T sum{};
+            for (size_t k{}; k < m; ++k) { sum += aRow[k] * b[k * p + j0]; }
+            outRow[j0] = sum;
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+void transpose(const T* a, T* out, const size_t n, const size_t m) noexcept
+{
+    // Number of rows and columns per block.
+    constexpr size_t BlockSize{8U};
+
+    for (size_t i0{}; i0 < n; i0 += BlockSize)
+    {
+        const size_t iEnd{n < i0 + BlockSize ? n : i0 + BlockSize};
+
+        for (size_t j0{}; j0 < m; j0 += BlockSize)
+        {
+            const size_t jEnd{m < j0 + BlockSize ? m : j0 + BlockSize};
+
+            for (size_t i{i0}; i < iEnd; ++i)
+            {
+                for (size_t j{j0}; j < jEnd; ++j) { out[j * n + i] = a[i * m + j]; }
+            }
+        }
+    }
+}
+} // namespace detail
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Rows, size_t Cols>
+Matrix<T, Rows, Cols>::Matrix(const size_t rows, const size_t cols) noexcept
+    : myStorage{}
+{
+    if (myStorage.resize(rows, cols)) { fill(T{}); }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Rows, size_t Cols>
+size_t Matrix<T, Rows, Cols>::rows() const noexcept { return myStorage.rows(); }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Rows, size_t Cols>
+size_t Matrix<T, Rows, Cols>::cols() const noexcept { return myStorage.cols(); }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Rows, size_t Cols>
+size_t Matrix<T, Rows, Cols>::size() const noexcept { return rows() * cols(); }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Rows, size_t Cols>
+bool Matrix<T, Rows, Cols>::empty() const noexcept { return 0U == size(); }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Rows, size_t Cols>
+T* Matrix<T, Rows, Cols>::data() noexcept { return myStorage.data(); }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Rows, size_t Cols>
+const T* Matrix<T, Rows, Cols>::data() const noexcept { return myStorage.data(); }
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Rows, size_t Cols>
+T& Matrix<T, Rows, Cols>::operator()(const size_t row, const size_t col) noexcept
+{
+    return data()[row * cols() + col];
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Rows, size_t Cols>
+const T& Matrix<T, Rows, Cols>::operator()(const size_t row, const size_t col) const noexcept
+{
+    return data()[row * cols() + col];
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Rows, size_t Cols>
+VectorView<T> Matrix<T, Rows, Cols>::row(const size_t row) noexcept
+{
+    return VectorView<T>{data() + row * cols(), cols()};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Rows, size_t Cols>
+VectorView<const T> Matrix<T, Rows, Cols>::row(const size_t row) const noexcept
+{
+    return VectorView<const T>{data() + row * cols(), cols()};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Rows, size_t Cols>
+VectorView<T> Matrix<T, Rows, Cols>::col(const size_t col) noexcept
+{
+    return VectorView<T>{data() + col, rows(), cols()};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Rows, size_t Cols>
+VectorView<const T> Matrix<T, Rows, Cols>::col(const size_t col) const noexcept
+{
+    return VectorView<const T>{data() + col, rows(), cols()};
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Rows, size_t Cols>
+bool Matrix<T, Rows, Cols>::resize(const size_t rows, const size_t cols) noexcept
+{
+    if (!myStorage.resize(rows, cols)) { return false; }
+    fill(T{});
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Rows, size_t Cols>
+void Matrix<T, Rows, Cols>::fill(const T value) noexcept
+{
+    T* element{data()};
+    for (size_t i{}; i < size(); ++i) { element[i] = value; }
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t R1, size_t C1, size_t R2, size_t C2, size_t R3, size_t C3>
+bool multiply(const Matrix<T, R1, C1>& a, const Matrix<T, R2, C2>& b,
+              Matrix<T, R3, C3>& out) noexcept
+{
+    // Return false if the dimensions don't match or if the output is one of the inputs.
+    if ((a.cols() != b.rows()) || detail::isAlias(out, a) || detail::isAlias(out, b) ||
+        (((out.rows() != a.rows()) || (out.cols() != b.cols())) &&
+         !out.resize(a.rows(), b.cols())))
+    {
+        return false;
+    }
+    detail::multiply(a.data(), b.data(), out.data(), a.rows(), a.cols(), b.cols());
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t Rows, size_t Cols>
+bool multiply(const Matrix<T, Rows, Cols>& a,
+              const VectorView<const typename type_traits::type_identity<T>::type> x,
+              const VectorView<T> y) noexcept
+{
+    // Return false if the sizes don't match.
+    if ((a.cols() != x.size()) || (a.rows() != y.size())) { return false; }
+
+    for (size_t i{}; i < a.rows(); ++i)
+    {
+        const T* row{a.data() + i * a.cols()};
+        T sum{};
+        for (size_t j{}; j < a.cols(); ++j) { sum += row[j] * x[j]; }
+        y[i] = sum;
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T, size_t R1, size_t C1, size_t R2, size_t C2>
+bool transpose(const Matrix<T, R1, C1>& a, Matrix<T, R2, C2>& out) noexcept
+{
+    // Return false if the dimensions don't match or if the output is the input.
+    if (detail::isAlias(out, a) ||
+        (((out.rows() != a.cols()) || (out.cols() != a.rows())) &&
+         !out.resize(a.cols(), a.rows())))
+    {
+        return false;
+    }
+    detail::transpose(a.data(), out.data(), a.rows(), a.cols());
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename T>
+bool axpy(const T alpha, const VectorView<const typename type_traits::type_identity<T>::type> x,
+          const VectorView<T> y) noexcept
+{
+    // Return false if the sizes don't match.
+    if (x.size() != y.size()) { return false; }
+    for (size_t i{}; i < x.size(); ++i) { y[i] += alpha * x[i]; }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t Size>
+bool solve(Matrix<double, Size, Size>& a, double (&b)[Size], double (&x)[Size]) noexcept
+{
+    // Pivots smaller than this fraction of the largest element are treated as zero. The
+    // diagonal alone isn't used, since it may be zero even if the system is solvable.
+    constexpr double relativeTolerance{1e-12};
+    double scale{};
+    for (size_t i{}; i < a.size(); ++i)
+    {
+        scale = fabs(a.data()[i]) > scale ? fabs(a.data()[i]) : scale;
+    }
+    if (0.0 >= scale) { return false; }
+
+    // Eliminate the elements below the diagonal, pivoting on the largest remaining element.
+    for (size_t k{}; k < Size; ++k)
+    {
+        size_t pivot{k};
+        for (size_t i{k + 1U}; i < Size; ++i)
+        {
+            if (fabs(a(i, k)) > fabs(a(pivot, k))) { pivot = i; }
+        }
+        if (fabs(a(pivot, k)) <= relativeTolerance * scale) { return false; }
+
+        if (pivot != k)
+        {
+            for (size_t j{}; j < Size; ++j)
+            {
+                const double temp{a(k, j)};
+                a(k, j)     = a(pivot, j);
+                a(pivot, j) = temp;
+            }
+            const double temp{b[k]};
+            b[k]     = b[pivot];
+            b[pivot] = temp;
+        }
+
+        for (size_t i{k + 1U}; i < Size; ++i)
+        {
+            const double factor{a(i, k) / a(k, k)};
+            axpy(-factor, a.row(k), a.row(i));
+            b[i] -= factor * b[k];
+        }
+    }
+
+    // Solve the resulting upper triangular system by back substitution.
+    for (size_t k{Size}; 0U < k--;)
+    {
+        double sum{b[k]};
+        for (size_t j{k + 1U}; j < Size; ++j) { sum -= a(k, j) * x[j]; }
+        x[k] = sum / a(k, k);
+    }
+    return true;
+}
+} // namespace ml
@@ -4,6 +4,8 @@
 #pragma once
 
 #include "ml/lin_reg/interface.h"
+#include "ml/lin_reg/least_squares.h"
+#include "ml/lin_reg/training.h"
 #include "ml/types.h"
 
 namespace ml
@@ -23,6 +25,17 @@ public:
      */
     Fixed() noexcept;
 
+    /**
+     * @brief Create a pre-trained model.
+     * 
+     *        Combined with leastSquares(), the parameters of constant training data are 
+     *        computed by the compiler, so no training is performed at runtime.
+     * 
+     * @param[in] parameters The model parameters. The model is only trained if the 
+     *                       parameters are valid.
+     */
+    explicit Fixed(const Parameters& parameters) noexcept;
+
     /**
      * @brief Destructor.
      */
@@ -44,6 +57,48 @@ public:
      */
     double predict(double input) const noexcept override;
 
+    /**
+     * @brief Predict based on many inputs at once.
+     * 
+     *        All predictions are computed with the vectorized kernel batch::affine().
+     * 
+     * @param[in] input The inputs for which to predict.
+     * @param[out] output Buffer for storing the predicted values, one per input. May be 
+     *                    the input.
+     * @param[in] count The number of inputs.
+     * 
+     * @return True on success, false if the input or output is null while count isn't 0.
+     */
+    bool predictBatch(const double* input, double* output, size_t count) const noexcept override;
+
+    /**
+     * @brief Get the size of the serialized model parameters.
+     * 
+     * @return The size of the serialized weight and bias in bytes.
+     */
+    uint8_t serializedSize() const noexcept override;
+
+    /**
+     * @brief Serialize the weight and bias of the model.
+     * 
+     * @param[out] data Buffer for storing the serialized parameters.
+     * @param[in] size The size of the buffer in bytes. Must be at least serializedSize().
+     * 
+     * @return True on success, false if the model isn't trained or if the buffer is too small.
+     */
+    bool serialize(uint8_t* data, uint8_t size) const noexcept override;
+
+    /**
+     * @brief Deserialize the weight and bias of the model. The model is trained afterwards.
+     * 
+     * @param[in] data The serialized parameters.
+     * @param[in] size The size of the serialized parameters in bytes. Must match 
+     *                 serializedSize().
+     * 
+     * @return True on success, false if the size doesn't match.
+     */
+    bool deserialize(const uint8_t* data, uint8_t size) noexcept override;
+
     /**
      * @brief Train the model.
      * 
@@ -58,13 +113,52 @@ public:
     bool train(const Matrix1d& trainIn, const Matrix2d& trainOut, size_t epochCount, 
                double learningRate = 0.01) noexcept;
 
+    /**
+     * @brief Train the model with early stopping and optional shuffling.
+     * 
+     *        The mean squared error of each epoch is accumulated from the prediction errors 
+     *        observed while updating the parameters, so tracking the loss requires no extra 
+     *        pass over the training sets. Training stops once the loss changes less than the 
+     *        minimum loss delta between two epochs, so that easy training data takes fewer 
+     *        epochs than the maximum.
+     * 
+     *        If shuffling is enabled, the training sets are shuffled in place before each 
+     *        epoch (Fisher-Yates), keeping each input value paired with its output value.
+     * 
+     * @param[in, out] trainIn Training data input values. Reordered if shuffling is enabled.
+     * @param[in, out] trainOut Training data output values. Reordered if shuffling is enabled.
+     * @param[in] options The training options, see TrainingOptions.
+     * 
+     * @return The training report, which is invalid if the options or training sets are 
+     *         invalid, in which case the model isn't changed.
+     */
+    TrainingReport train(Matrix1d& trainIn, Matrix2d& trainOut, 
+                         const TrainingOptions& options) noexcept;
+
+    /**
+     * @brief Train the model with closed-form ordinary least squares.
+     * 
+     *        The weight and bias minimizing the mean squared error are computed in a single 
+     *        pass over the training sets, without epochs or a learning rate. See LeastSquares 
+     *        for details.
+     * 
+     * @param[in] trainIn Training data input values.
+     * @param[in] trainOut Training data output values.
+     * 
+     * @return True on success, false if no training sets are present or if all input values 
+     *         are equal, in which case the weight is undefined.
+     */
+    bool trainLeastSquares(const Matrix1d& trainIn, const Matrix2d& trainOut) noexcept;
+
     Fixed(const Fixed&)            = delete; // No copy constructor.
     Fixed(Fixed&&)                 = delete; // No move constructor.
     Fixed& operator=(const Fixed&) = delete; // No copy assignment.
     Fixed& operator=(Fixed&&)      = delete; // No move assignment.
 
 private:
-    void optimize(double input, double output, double learningRate) noexcept;
+    double trainEpoch(const Matrix1d& trainIn, const Matrix2d& trainOut, size_t setCount, 
+                      double learningRate) noexcept;
+    double optimize(double input, double output, double learningRate) noexcept;
 
     /** Model weight (k-value). */
     double myWeight;
@@ -0,0 +1,60 @@
+/**
+ * @brief Implementation details of closed-form least squares fitting.
+ * 
+ * @note Don't include this header, use <least_squares.h> instead!
+ */
+#pragma once
+
+namespace ml
+{
+namespace lin_reg
+{
+// -----------------------------------------------------------------------------
+constexpr LeastSquares::LeastSquares() noexcept
+    : myInputMean{}
+    , myOutputMean{}
+    , myInputVariance{}
+    , myCovariance{}
+    , myCount{}
+{}
+
+// -----------------------------------------------------------------------------
+constexpr void LeastSquares::add(const double input, const double output) noexcept
+{
+    // Update the means first, then the centered sums with the old and new input deviation.
+    const double inputDelta{input - myInputMean};
+    ++myCount;
+    myInputMean     += inputDelta / static_cast<double>(myCount);
+    myOutputMean    += (output - myOutputMean) / static_cast<double>(myCount);
+    myInputVariance += inputDelta * (input - myInputMean);
+    myCovariance    += inputDelta * (output - myOutputMean);
+}
+
+// -----------------------------------------------------------------------------
+constexpr size_t LeastSquares::count() const noexcept { return myCount; }
+
+// -----------------------------------------------------------------------------
+constexpr Parameters LeastSquares::solve() const noexcept
+{
+    // Return invalid parameters if all inputs are equal, since the weight is undefined.
+    if ((0U == myCount) || (0.0 >= myInputVariance)) { return Parameters{0.0, 0.0, false}; }
+
+    // The regression line passes through the means with slope covariance / variance.
+    const double weight{myCovariance / myInputVariance};
+    return Parameters{weight, myOutputMean - weight * myInputMean, true};
+}
+
+// -----------------------------------------------------------------------------
+template <size_t SetCount>
+constexpr Parameters leastSquares(const double (&trainIn)[SetCount], 
+                                  const double (&trainOut)[SetCount]) noexcept
+{
+    // Generate a compiler error if the weight cannot be determined.
+    static_assert(1U < SetCount, "At least two training sets are required!");
+
+    LeastSquares accumulator{};
+    for (size_t i{}; i < SetCount; ++i) { accumulator.add(trainIn[i], trainOut[i]); }
+    return accumulator.solve();
+}
+} // namespace lin_reg
+} // namespace ml
@@ -0,0 +1,164 @@
+/**
+ * @brief Implementation details of multivariate linear regression.
+ *
+ * @note Don't include this header, use <multi.h> instead!
+ */
+#pragma once
+
+namespace ml
+{
+namespace lin_reg
+{
+namespace detail
+{
+// -----------------------------------------------------------------------------
+constexpr size_t min(const size_t x, const size_t y) noexcept { return x < y ? x : y; }
+
+// -----------------------------------------------------------------------------
+constexpr bool isLearningRateValid(const double learningRate) noexcept
+{
+    return (0.0 < learningRate) && (1.0 >= learningRate);
+}
+} // namespace detail
+
+// -----------------------------------------------------------------------------
+template <size_t InputCount>
+Multi<InputCount>::Multi() noexcept
+    : myWeights{}
+    , myBias{}
+    , myTrained{false}
+{}
+
+// -----------------------------------------------------------------------------
+template <size_t InputCount>
+bool Multi<InputCount>::isTrained() const noexcept { return myTrained; }
+
+// -----------------------------------------------------------------------------
+template <size_t InputCount>
+VectorView<const double> Multi<InputCount>::weights() const noexcept
+{
+    return VectorView<const double>{myWeights, InputCount};
+}
+
+// -----------------------------------------------------------------------------
+template <size_t InputCount>
+double Multi<InputCount>::bias() const noexcept { return myBias; }
+
+// -----------------------------------------------------------------------------
+template <size_t InputCount>
+double Multi<InputCount>::predict(const VectorView<const double> input) const noexcept
+{
+    // Return 0 if the model is untrained or if the input size is invalid.
+    if (!myTrained || (InputCount != input.size())) { return 0.0; }
+
+    double prediction{myBias};
+    for (size_t i{}; i < InputCount; ++i) { prediction += myWeights[i] * input[i]; }
+    return prediction;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t InputCount>
+template <size_t Rows, size_t Cols>
+bool Multi<InputCount>::predictBatch(const Matrix<double, Rows, Cols>& input,
+                                     const VectorView<double> output) const noexcept
+{
+    // Multiply the input sets with the weights, return false if the sizes don't match.
+    if (!myTrained || !multiply(input, weights(), output)) { return false; }
+
+    // Add the bias to each prediction.
+    for (size_t i{}; i < output.size(); ++i) { output[i] += myBias; }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t InputCount>
+template <size_t Rows, size_t Cols>
+bool Multi<InputCount>::train(const Matrix<double, Rows, Cols>& trainIn,
+                              const VectorView<const double> trainOut, const size_t epochCount,
+                              const double learningRate, const size_t batchSize) noexcept
+{
+    // Check the epoch count, learning rate and batch size, return false if invalid.
+    if ((0U == epochCount) || !detail::isLearningRateValid(learningRate) || (0U == batchSize))
+    {
+        return false;
+    }
+
+    // Check the training sets, return false if invalid.
+    const size_t setCount{detail::min(trainIn.rows(), trainOut.size())};
+    if ((InputCount != trainIn.cols()) || (0U == setCount)) { return false; }
+
+    // Clear the trainable parameters before starting training.
+    double gradient[InputCount]{};
+    const VectorView<double> weights{myWeights, InputCount};
+    const VectorView<double> weightGradient{gradient, InputCount};
+    for (size_t i{}; i < InputCount; ++i) { myWeights[i] = 0.0; }
+    myBias = 0.0;
+
+    // Mark the model as trained, so that predict() can be used during training.
+    myTrained = true;
+
+    // Train the model the specified number of epochs, one batch of training sets at a time.
+    for (size_t epoch{}; epoch < epochCount; ++epoch)
+    {
+        for (size_t batchStart{}; batchStart < setCount; batchStart += batchSize)
+        {
+            const size_t batchEnd{detail::min(batchStart + batchSize, setCount)};
+            double biasGradient{};
+            for (size_t i{}; i < InputCount; ++i) { gradient[i] = 0.0; }
+
+            // Accumulate the gradient of the batch, each input set scaled by its error.
+            for (size_t set{batchStart}; set < batchEnd; ++set)
+            {
+                const double error{trainOut[set] - predict(trainIn.row(set))};
+                axpy(error, trainIn.row(set), weightGradient);
+                biasGradient += error;
+            }
+
+            // Update the parameters with the average gradient of the batch.
+            const double step{learningRate / static_cast<double>(batchEnd - batchStart)};
+            axpy(step, weightGradient, weights);
+            myBias += step * biasGradient;
+        }
+    }
+    return myTrained;
+}
+
+// -----------------------------------------------------------------------------
+template <size_t InputCount>
+template <size_t Rows, size_t Cols>
+bool Multi<InputCount>::trainNormalEquation(const Matrix<double, Rows, Cols>& trainIn,
+                                            const VectorView<const double> trainOut) noexcept
+{
+    // Check the training sets, return false if invalid.
+    const size_t setCount{detail::min(trainIn.rows(), trainOut.size())};
+    if ((InputCount != trainIn.cols()) || (0U == setCount)) { return false; }
+
+    // Accumulate X^T * X and X^T * y, where each row of X is extended by a constant 1.
+    Matrix<double, ParameterCount, ParameterCount> normal{};
+    double moment[ParameterCount]{};
+    double extended[ParameterCount]{};
+    extended[InputCount] = 1.0;
+    const VectorView<const double> extendedView{extended, ParameterCount};
+
+    for (size_t set{}; set < setCount; ++set)
+    {
+        for (size_t i{}; i < InputCount; ++i) { extended[i] = trainIn(set, i); }
+
+        for (size_t i{}; i < ParameterCount; ++i)
+        {
+            axpy(extended[i], extendedView, normal.row(i));
+            moment[i] += extended[i] * trainOut[set];
+        }
+    }
+
+    // Solve for the parameters, return false if the inputs are linearly dependent.
+    double parameters[ParameterCount]{};
+    if (!solve(normal, moment, parameters)) { return false; }
+
+    for (size_t i{}; i < InputCount; ++i) { myWeights[i] = parameters[i]; }
+    myBias    = parameters[InputCount];
+    myTrained = true;
+    return myTrained;
+}
+} // namespace lin_reg
+} // namespace ml
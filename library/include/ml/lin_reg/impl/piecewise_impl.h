@@ -0,0 +1,313 @@
+/**
+ * @brief Implementation details of piecewise linear regression.
+ * 
+ * @note Don't include this header, use <piecewise.h> instead!
+ */
+#pragma once
+
+#include <math.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "utils/utils.h"
+
+namespace ml
+{
+namespace lin_reg
+{
+// -----------------------------------------------------------------------------
+template <uint8_t SegmentCount>
+Piecewise<SegmentCount>::Piecewise() noexcept
+    : myKnots{}
+    , myValues{}
+    , myTrained{false}
+{}
+
+// -----------------------------------------------------------------------------
+template <uint8_t SegmentCount>
+Piecewise<SegmentCount>::Piecewise(const double (&knots)[KnotCount], 
+                                   const double (&values)[KnotCount]) noexcept
+    : myKnots{}
+    , myValues{}
+    , myTrained{false}
+{
+    for (uint8_t i{}; i < KnotCount; ++i)
+    {
+        myKnots[i]  = knots[i];
+        myValues[i] = values[i];
+    }
+    myTrained = isIncreasing();
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t SegmentCount>
+bool Piecewise<SegmentCount>::isTrained() const noexcept { return myTrained; }
+
+// -----------------------------------------------------------------------------
+template <uint8_t SegmentCount>
+double Piecewise<SegmentCount>::predict(const double input) const noexcept
+{
+    if (!myTrained) { return 0.0; }
+
+    // Interpolate between the knots of the segment, which also extrapolates the end segments.
+    const uint8_t i{findSegment(input)};
+    const double fraction{(input - myKnots[i]) / (myKnots[i + 1U] - myKnots[i])};
+    return myValues[i] + fraction * (myValues[i + 1U] - myValues[i]);
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t SegmentCount>
+bool Piecewise<SegmentCount>::predictBatch(const double* input, double* output, 
+                                           const size_t count) const noexcept
+{
+    if ((0U < count) && ((nullptr == input) || (nullptr == output))) { return false; }
+    for (size_t i{}; i < count; ++i) { output[i] = Piecewise::predict(input[i]); }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t SegmentCount>
+uint8_t Piecewise<SegmentCount>::serializedSize() const noexcept { return SerializedSize; }
+
+// -----------------------------------------------------------------------------
+template <uint8_t SegmentCount>
+bool Piecewise<SegmentCount>::serialize(uint8_t* data, const uint8_t size) const noexcept
+{
+    // Check the parameters, return false if invalid or if the model isn't trained.
+    if ((nullptr == data) || (SerializedSize > size) || !myTrained) { return false; }
+
+    // Copy the knots followed by the values in the native floating-point format.
+    memcpy(data, myKnots, sizeof(myKnots));
+    memcpy(data + sizeof(myKnots), myValues, sizeof(myValues));
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t SegmentCount>
+bool Piecewise<SegmentCount>::deserialize(const uint8_t* data, const uint8_t size) noexcept
+{
+    // Check the parameters, return false if invalid.
+    if ((nullptr == data) || (SerializedSize != size)) { return false; }
+
+    // Restore the knots and values, the model is trained if the knots are valid.
+    memcpy(myKnots, data, sizeof(myKnots));
+    memcpy(myValues, data + sizeof(myKnots), sizeof(myValues));
+    myTrained = isIncreasing();
+    return myTrained;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t SegmentCount>
+bool Piecewise<SegmentCount>::train(const Matrix1d& trainIn, const Matrix2d& trainOut) noexcept
+{
+    // Check the training set count, return false if invalid.
+    const size_t setCount{trainIn.size() < trainOut.size() ? trainIn.size() : trainOut.size()};
+    if (2U > setCount) { return false; }
+
+    // Spread the knots evenly over the input range, return false if all inputs are equal.
+    double minInput{trainIn[0U]};
+    double maxInput{trainIn[0U]};
+    for (size_t i{1U}; i < setCount; ++i)
+    {
+        minInput = trainIn[i] < minInput ? trainIn[i] : minInput;
+        maxInput = trainIn[i] > maxInput ? trainIn[i] : maxInput;
+    }
+    if (minInput >= maxInput) { return false; }
+    const double width{(maxInput - minInput) / SegmentCount};
+
+    // Accumulate the normal equations, where each input contributes to the two knots of its
+    // segment, weighted by its distance to the other knot. The system is tridiagonal.
+    double diagonal[KnotCount]{};
+    double offDiagonal[SegmentCount]{};
+    double moment[KnotCount]{};
+
+    for (size_t set{}; set < setCount; ++set)
+    {
+        const double position{(trainIn[set] - minInput) / width};
+        const uint8_t i{position < SegmentCount - 1U ? static_cast<uint8_t>(position) 
+                                                     : static_cast<uint8_t>(SegmentCount - 1U)};
+        const double upper{position - i};
+        const double lower{1.0 - upper};
+
+        diagonal[i]      += lower * lower;
+        diagonal[i + 1U] += upper * upper;
+        offDiagonal[i]   += lower * upper;
+        moment[i]        += lower * trainOut[set];
+        moment[i + 1U]   += upper * trainOut[set];
+    }
+
+    // Eliminate the sub-diagonal (Thomas algorithm), which is stable without pivoting since 
+    // the system is symmetric positive definite. Return false if a knot is unconstrained.
+    double scale{};
+    for (const auto& element : diagonal) { scale = element > scale ? element : scale; }
+    constexpr double relativeTolerance{1e-12};
+    if (diagonal[0U] <= relativeTolerance * scale) { return false; }
+
+    for (uint8_t i{1U}; i < KnotCount; ++i)
+    {
+        const double factor{offDiagonal[i - 1U] / diagonal[i - 1U]};
+        diagonal[i] -= factor * offDiagonal[i - 1U];
+        moment[i]   -= factor * moment[i - 1U];
+        if (diagonal[i] <= relativeTolerance * scale) { return false; }
+    }
+
+    // Solve for the values at the knots by back substitution.
+    myValues[SegmentCount] = moment[SegmentCount] / diagonal[SegmentCount];
+    for (uint8_t i{SegmentCount}; 0U < i--;)
+    {
+        myValues[i] = (moment[i] - offDiagonal[i] * myValues[i + 1U]) / diagonal[i];
+    }
+
+    for (uint8_t i{}; i < SegmentCount; ++i) { myKnots[i] = minInput + i * width; }
+    myKnots[SegmentCount] = maxInput;
+    myTrained             = true;
+    return myTrained;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t SegmentCount>
+double Piecewise<SegmentCount>::knot(const uint8_t index) const noexcept
+{
+    return KnotCount > index ? myKnots[index] : 0.0;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t SegmentCount>
+uint8_t Piecewise<SegmentCount>::findSegment(const double input) const noexcept
+{
+    // Find the last segment starting at or before the input, or the first segment if none.
+    uint8_t first{};
+    uint8_t last{SegmentCount - 1U};
+    while (first < last)
+    {
+        const uint8_t middle{static_cast<uint8_t>((first + last + 1U) / 2U)};
+        if (myKnots[middle] <= input) { first = middle; }
+        else { last = static_cast<uint8_t>(middle - 1U); }
+    }
+    return first;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t SegmentCount>
+bool Piecewise<SegmentCount>::isIncreasing() const noexcept
+{
+    for (uint8_t i{}; i < SegmentCount; ++i)
+    {
+        if (!(myKnots[i] < myKnots[i + 1U])) { return false; }
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t SegmentCount, uint8_t FracBits>
+QuantizedPiecewise<SegmentCount, FracBits>::QuantizedPiecewise() noexcept
+    : myKnots{}
+    , myValues{}
+    , mySlopes{}
+    , myMaxValue{}
+    , myTrained{false}
+{}
+
+// -----------------------------------------------------------------------------
+template <uint8_t SegmentCount, uint8_t FracBits>
+bool QuantizedPiecewise<SegmentCount, FracBits>::isTrained() const noexcept { return myTrained; }
+
+// -----------------------------------------------------------------------------
+template <uint8_t SegmentCount, uint8_t FracBits>
+int16_t QuantizedPiecewise<SegmentCount, FracBits>::predict(const uint16_t adcValue) const noexcept
+{
+    if (!myTrained) { return 0; }
+    const int32_t scaled{evaluate(adcValue)};
+
+    // Round half away from zero, like utils::round(), by shifting the absolute value.
+    return static_cast<int16_t>(0 <= scaled ? (scaled + Half) >> FracBits 
+                                            : -((Half - scaled) >> FracBits));
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t SegmentCount, uint8_t FracBits>
+bool QuantizedPiecewise<SegmentCount, FracBits>::quantize(const Piecewise<SegmentCount>& model, 
+                                                          const uint16_t maxValue, 
+                                                          const double supplyVoltage, 
+                                                          double& maxError) noexcept
+{
+    // Check the parameters, return false if invalid.
+    if (!model.isTrained() || (0U == maxValue) || (0.0 >= supplyVoltage)) { return false; }
+
+    // Round the knots to the nearest ADC values within range and evaluate the model there.
+    uint16_t knots[KnotCount]{};
+    double values[KnotCount]{};
+    for (uint8_t i{}; i < KnotCount; ++i)
+    {
+        const double adcValue{model.knot(i) / supplyVoltage * maxValue};
+        knots[i]  = 0.0 >= adcValue ? 0U 
+                  : maxValue <= adcValue ? maxValue : utils::round<uint16_t>(adcValue);
+        values[i] = model.predict(static_cast<double>(knots[i]) * supplyVoltage / maxValue);
+    }
+
+    // Compute the slope of each segment per ADC step. Segments collapsed into a single ADC 
+    // value are never used for interpolation, since the next segment starts at the same value.
+    double slopes[SegmentCount]{};
+    for (uint8_t i{}; i < SegmentCount; ++i)
+    {
+        const uint16_t length{static_cast<uint16_t>(knots[i + 1U] - knots[i])};
+        slopes[i] = 0U < length ? (values[i + 1U] - values[i]) / length 
+                  : 0U == i ? 0.0 : slopes[i - 1U];
+    }
+
+    // Return false if the predictions or the intermediate fixed-point values can overflow.
+    for (uint8_t i{}; i < SegmentCount; ++i)
+    {
+        const double bound{fabs(values[i]) + fabs(slopes[i]) * maxValue};
+        if ((INT32_MAX <= (bound + 1.0) * Scale) || (INT16_MAX < bound)) { return false; }
+    }
+
+    // Round the values and slopes to the nearest fixed-point values.
+    for (uint8_t i{}; i < KnotCount; ++i)
+    {
+        myKnots[i]  = knots[i];
+        myValues[i] = utils::round<int32_t>(values[i] * Scale);
+    }
+    for (uint8_t i{}; i < SegmentCount; ++i)
+    {
+        mySlopes[i] = utils::round<int32_t>(slopes[i] * Scale);
+    }
+    myMaxValue = maxValue;
+    myTrained  = true;
+
+    // Compare with the model at every ADC value, since the knots have been rounded.
+    maxError = 0.0;
+    for (uint32_t adcValue{}; adcValue <= maxValue; ++adcValue)
+    {
+        const double input{static_cast<double>(adcValue) * supplyVoltage / maxValue};
+        const double quantized{static_cast<double>(evaluate(static_cast<uint16_t>(adcValue))) / 
+                               Scale};
+        const double error{fabs(quantized - model.predict(input))};
+        maxError = error > maxError ? error : maxError;
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t SegmentCount, uint8_t FracBits>
+int32_t QuantizedPiecewise<SegmentCount, FracBits>::evaluate(const uint16_t adcValue) const noexcept
+{
+    // Saturate the ADC value, since the fixed-point range is only verified up to the max value.
+    const uint16_t input{myMaxValue < adcValue ? myMaxValue : adcValue};
+
+    // Find the last segment starting at or before the input, or the first segment if none.
+    uint8_t first{};
+    uint8_t last{SegmentCount - 1U};
+    while (first < last)
+    {
+        const uint8_t middle{static_cast<uint8_t>((first + last + 1U) / 2U)};
+        if (myKnots[middle] <= input) { first = middle; }
+        else { last = static_cast<uint8_t>(middle - 1U); }
+    }
+
+    // Interpolate from the start of the segment, the offset is negative below the first knot.
+    const int32_t offset{static_cast<int32_t>(input) - static_cast<int32_t>(myKnots[first])};
+    return myValues[first] + mySlopes[first] * offset;
+}
+} // namespace lin_reg
+} // namespace ml
@@ -0,0 +1,80 @@
+/**
+ * @brief Implementation details of quantized linear regression.
+ * 
+ * @note Don't include this header, use <quantized.h> instead!
+ */
+#pragma once
+
+#include <math.h>
+#include <stdint.h>
+
+#include "utils/utils.h"
+
+namespace ml
+{
+namespace lin_reg
+{
+// -----------------------------------------------------------------------------
+template <uint8_t FracBits>
+Quantized<FracBits>::Quantized() noexcept
+    : myWeight{}
+    , myBias{}
+    , myMaxValue{}
+    , myTrained{false}
+{}
+
+// -----------------------------------------------------------------------------
+template <uint8_t FracBits>
+bool Quantized<FracBits>::isTrained() const noexcept { return myTrained; }
+
+// -----------------------------------------------------------------------------
+template <uint8_t FracBits>
+int16_t Quantized<FracBits>::predict(const uint16_t adcValue) const noexcept
+{
+    if (!myTrained) { return 0; }
+
+    // Saturate the ADC value, since the fixed-point range is only verified up to the max value.
+    const int32_t input{static_cast<int32_t>(myMaxValue < adcValue ? myMaxValue : adcValue)};
+    const int32_t scaled{myWeight * input + myBias};
+
+    // Round half away from zero, like utils::round(), by shifting the absolute value.
+    return static_cast<int16_t>(0 <= scaled ? (scaled + Half) >> FracBits 
+                                            : -((Half - scaled) >> FracBits));
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t FracBits>
+bool Quantized<FracBits>::quantize(const Interface& model, const uint16_t maxValue, 
+                                   const double supplyVoltage, double& maxError) noexcept
+{
+    // Check the parameters, return false if invalid.
+    if (!model.isTrained() || (0U == maxValue) || (0.0 >= supplyVoltage)) { return false; }
+
+    // Fold the conversion from ADC value to input voltage into the weight.
+    const double bias{model.predict(0.0)};
+    const double maxPrediction{model.predict(supplyVoltage)};
+    const double weight{(maxPrediction - bias) / maxValue};
+
+    // Return false if the predictions or the intermediate fixed-point values can overflow.
+    const double maxScaled{(fabs(weight) * maxValue + fabs(bias) + 1.0) * Scale};
+    if ((INT32_MAX <= maxScaled) || !utils::inRange<double>(bias, INT16_MIN, INT16_MAX) || 
+        !utils::inRange<double>(maxPrediction, INT16_MIN, INT16_MAX))
+    {
+        return false;
+    }
+
+    // Round the parameters to the nearest fixed-point values.
+    myWeight   = utils::round<int32_t>(weight * Scale);
+    myBias     = utils::round<int32_t>(bias * Scale);
+    myMaxValue = maxValue;
+    myTrained  = true;
+
+    // The error is linear in the ADC value, so the max error is found at either end.
+    const double weightError{static_cast<double>(myWeight) / Scale - weight};
+    const double biasError{static_cast<double>(myBias) / Scale - bias};
+    const double maxValueError{fabs(weightError * maxValue + biasError)};
+    maxError = fabs(biasError) > maxValueError ? fabs(biasError) : maxValueError;
+    return true;
+}
+} // namespace lin_reg
+} // namespace ml
@@ -3,12 +3,18 @@
  */
 #pragma once
 
+#include <stddef.h>
+#include <stdint.h>
+
 namespace ml
 {
 namespace lin_reg
 {
 /**
  * @brief Linear regression interface.
+ * 
+ *        Nonlinear models, such as poly_reg::Fixed and Piecewise, implement this interface too,
+ *        so that drivers and the model storage accept any regression model.
  */
 class Interface
 {
@@ -33,6 +39,62 @@ public:
      * @return The predicted value.
      */
     virtual double predict(double input) const noexcept = 0;
+
+    /**
+     * @brief Predict based on many inputs at once, for instance a logged dataset.
+     * 
+     *        The default implementation calls predict() for each input. Models override this
+     *        method to evaluate all inputs with a single virtual call, using SIMD vector 
+     *        operations on the host where possible.
+     * 
+     * @param[in] input The inputs for which to predict.
+     * @param[out] output Buffer for storing the predicted values, one per input. May be 
+     *                    the input.
+     * @param[in] count The number of inputs.
+     * 
+     * @return True on success, false if the input or output is null while count isn't 0.
+     */
+    virtual bool predictBatch(const double* input, double* output, size_t count) const noexcept;
+
+    /**
+     * @brief Get the size of the serialized model parameters.
+     * 
+     * @return The size of the serialized model parameters in bytes.
+     */
+    virtual uint8_t serializedSize() const noexcept = 0;
+
+    /**
+     * @brief Serialize the model parameters, for instance to store the model in EEPROM.
+     * 
+     *        The serialized format is only valid for the platform it was created on.
+     * 
+     * @param[out] data Buffer for storing the serialized parameters.
+     * @param[in] size The size of the buffer in bytes. Must be at least serializedSize().
+     * 
+     * @return True on success, false if the model isn't trained or if the buffer is too small.
+     */
+    virtual bool serialize(uint8_t* data, uint8_t size) const noexcept = 0;
+
+    /**
+     * @brief Deserialize model parameters created by serialize(). The model is trained 
+     *        afterwards.
+     * 
+     * @param[in] data The serialized parameters.
+     * @param[in] size The size of the serialized parameters in bytes. Must match 
+     *                 serializedSize().
+     * 
+     * @return True on success, false if the size doesn't match.
+     */
+    virtual bool deserialize(const uint8_t* data, uint8_t size) noexcept = 0;
 };
+
+// -----------------------------------------------------------------------------
+inline bool Interface::predictBatch(const double* input, double* output, 
+                                    const size_t count) const noexcept
+{
+    if ((0U < count) && ((nullptr == input) || (nullptr == output))) { return false; }
+    for (size_t i{}; i < count; ++i) { output[i] = predict(input[i]); }
+    return true;
+}
 } // namespace lin_reg
 } // namespace ml
\ No newline at end of file
@@ -0,0 +1,118 @@
+/**
+ * @brief Closed-form least squares fitting of linear regression models.
+ */
+#pragma once
+
+#include <stddef.h>
+
+namespace ml
+{
+namespace lin_reg
+{
+/**
+ * @brief Structure of linear regression model parameters.
+ */
+struct Parameters
+{
+    /** Model weight (k-value). */
+    double weight;
+
+    /** Model bias (m-value). */
+    double bias;
+
+    /** Indicate whether the parameters are valid. */
+    bool valid;
+};
+
+/**
+ * @brief Accumulator for closed-form ordinary least squares.
+ * 
+ *        The means and the centered sums of squares are accumulated incrementally (Welford's 
+ *        method), which avoids the cancellation of subtracting large raw sums and keeps the 
+ *        result accurate for badly scaled inputs. All operations are constexpr, so the same 
+ *        accumulator fits models at runtime and at compile time.
+ * 
+ *        This class is non-copyable and non-movable.
+ */
+class LeastSquares
+{
+public:
+    /**
+     * @brief Create empty accumulator.
+     */
+    constexpr LeastSquares() noexcept;
+
+    /**
+     * @brief Delete accumulator.
+     */
+    ~LeastSquares() noexcept = default;
+
+    /**
+     * @brief Add a training set.
+     * 
+     * @param[in] input The input value.
+     * @param[in] output The output value.
+     */
+    constexpr void add(double input, double output) noexcept;
+
+    /**
+     * @brief Get the number of added training sets.
+     * 
+     * @return The number of added training sets.
+     */
+    constexpr size_t count() const noexcept;
+
+    /**
+     * @brief Compute the weight and bias minimizing the mean squared error.
+     * 
+     * @return The model parameters, which are invalid if no training sets are present or 
+     *         if all input values are equal, in which case the weight is undefined.
+     */
+    constexpr Parameters solve() const noexcept;
+
+    LeastSquares(const LeastSquares&)            = delete; // No copy constructor.
+    LeastSquares(LeastSquares&&)                 = delete; // No move constructor.
+    LeastSquares& operator=(const LeastSquares&) = delete; // No copy assignment.
+    LeastSquares& operator=(LeastSquares&&)      = delete; // No move assignment.
+
+private:
+    /** Mean of the input values. */
+    double myInputMean;
+
+    /** Mean of the output values. */
+    double myOutputMean;
+
+    /** Sum of squared input deviations from the mean. */
+    double myInputVariance;
+
+    /** Sum of input/output co-deviations from the means. */
+    double myCovariance;
+
+    /** The number of added training sets. */
+    size_t myCount;
+};
+
+/**
+ * @brief Fit a linear regression model to given training data with least squares.
+ * 
+ *        Constant training data is fitted by the compiler, for instance:
+ * 
+ *        constexpr double trainIn[]{0.0, 1.0, 2.0};
+ *        constexpr double trainOut[]{1.0, 3.0, 5.0};
+ *        constexpr auto parameters{ml::lin_reg::leastSquares(trainIn, trainOut)};
+ *        static_assert(parameters.valid, "Invalid training data!");
+ * 
+ * @tparam SetCount The number of training sets. Must be greater than 1.
+ * 
+ * @param[in] trainIn Training data input values.
+ * @param[in] trainOut Training data output values.
+ * 
+ * @return The model parameters, which are invalid if all input values are equal.
+ */
+template <size_t SetCount>
+constexpr Parameters leastSquares(const double (&trainIn)[SetCount], 
+                                  const double (&trainOut)[SetCount]) noexcept;
+} // namespace lin_reg
+} // namespace ml
+
+#include "impl/least_squares_impl.h"
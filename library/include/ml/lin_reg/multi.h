@@ -0,0 +1,151 @@
+/**
+ * @brief Multivariate linear regression implementation.
+ */
+#pragma once
+
+#include <stddef.h>
+
+#include "ml/matrix.h"
+
+namespace ml
+{
+namespace lin_reg
+{
+/**
+ * @brief Multivariate linear regression implementation.
+ *
+ *        The model predicts y = w0 * x0 + w1 * x1 + ... + b from several inputs, for instance
+ *        the sensor voltage, the supply voltage and the time of day. Training sets are stored
+ *        as the rows of a matrix, one column per input.
+ *
+ *        This class is non-copyable and non-movable.
+ *
+ * @tparam InputCount The number of inputs. Must be greater than 0.
+ */
+template <size_t InputCount>
+class Multi
+{
+    // Generate a compiler error if the number of inputs is invalid.
+    static_assert(0U < InputCount, "The model requires at least one input!");
+
+public:
+    /**
+     * @brief Create untrained model.
+     */
+    Multi() noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~Multi() noexcept = default;
+
+    /**
+     * @brief Get the number of inputs.
+     *
+     * @return The number of inputs.
+     */
+    static constexpr size_t inputCount() noexcept { return InputCount; }
+
+    /**
+     * @brief Check whether the model is trained.
+     *
+     * @return True if the model is trained, false otherwise.
+     */
+    bool isTrained() const noexcept;
+
+    /**
+     * @brief Get the weights of the model.
+     *
+     * @return Read-only view of the weights, one per input.
+     */
+    VectorView<const double> weights() const noexcept;
+
+    /**
+     * @brief Get the bias of the model.
+     *
+     * @return The bias.
+     */
+    double bias() const noexcept;
+
+    /**
+     * @brief Predict based on given inputs.
+     *
+     * @param[in] input The inputs for which to predict, such as a row of a matrix.
+     *
+     * @return The predicted value, or 0 if the model is untrained or the input size is invalid.
+     */
+    double predict(VectorView<const double> input) const noexcept;
+
+    /**
+     * @brief Predict based on many input sets at once.
+     *
+     *        The predictions are computed with a single matrix-vector multiplication.
+     *
+     * @param[in] input The input sets, one row per set and one column per input.
+     * @param[out] output View for storing the predicted values, one per input set.
+     *
+     * @return True on success, false if the model is untrained or if the sizes don't match.
+     */
+    template <size_t Rows, size_t Cols>
+    bool predictBatch(const Matrix<double, Rows, Cols>& input,
+                      VectorView<double> output) const noexcept;
+
+    /**
+     * @brief Train the model with mini-batch gradient descent.
+     *
+     *        The gradient of the mean squared error is accumulated over each batch of
+     *        consecutive training sets before the parameters are updated.
+     *
+     * @param[in] trainIn Training data input values, one row per set and one column per input.
+     * @param[in] trainOut Training data output values, one per set.
+     * @param[in] epochCount Number of epochs to perform training. Must be greater than 0.
+     * @param[in] learningRate Learning rate to use for updating the parameters (default = 0.01).
+     *                         Must be greater than 0.0 and less than or equal to 1.0.
+     * @param[in] batchSize The number of training sets per parameter update (default = 1).
+     *                      Must be greater than 0.
+     *
+     * @return True on success, false on failure.
+     */
+    template <size_t Rows, size_t Cols>
+    bool train(const Matrix<double, Rows, Cols>& trainIn, VectorView<const double> trainOut,
+               size_t epochCount, double learningRate = 0.01, size_t batchSize = 1U) noexcept;
+
+    /**
+     * @brief Train the model with the closed-form normal equations.
+     *
+     *        The normal equations (X^T * X) * p = X^T * y, where X holds the training inputs
+     *        extended by a constant input for the bias, are accumulated in a single pass over
+     *        the training sets and solved with Gaussian elimination.
+     *
+     * @param[in] trainIn Training data input values, one row per set and one column per input.
+     * @param[in] trainOut Training data output values, one per set.
+     *
+     * @return True on success, false if no training sets are present or if the inputs are
+     *         linearly dependent, in which case the weights are undefined.
+     */
+    template <size_t Rows, size_t Cols>
+    bool trainNormalEquation(const Matrix<double, Rows, Cols>& trainIn,
+                             VectorView<const double> trainOut) noexcept;
+
+    Multi(const Multi&)            = delete; // No copy constructor.
+    Multi(Multi&&)                 = delete; // No move constructor.
+    Multi& operator=(const Multi&) = delete; // No copy assignment.
+    Multi& operator=(Multi&&)      = delete; // No move assignment.
+
+private:
+    /** The number of model parameters, the weights followed by the bias. */
+    static constexpr size_t ParameterCount{InputCount + 1U};
+
+    /** Model weights, one per input. */
+    double myWeights[InputCount];
+
+    /** Model bias. */
+    double myBias;
+
+    /** Indicate whether the model is trained. */
+    bool myTrained;
+};
+} // namespace lin_reg
+} // namespace ml
+
+#include "impl/multi_impl.h"
@@ -0,0 +1,172 @@
+/**
+ * @brief Online linear regression implementation.
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ml/lin_reg/interface.h"
+#include "ml/types.h"
+
+namespace ml
+{
+namespace lin_reg
+{
+/**
+ * @brief Online linear regression implementation based on recursive least squares.
+ * 
+ *        Each reference measurement updates the weight and bias directly, so no training 
+ *        history is stored and each update costs a fixed number of operations. The 2x2 
+ *        covariance of the parameter estimates is tracked along with the parameters, so 
+ *        that a single update can move a confident model only slightly.
+ * 
+ *        A forgetting factor below 1 discounts older measurements exponentially, so that the
+ *        model follows sensor drift. With a forgetting factor of 1, all measurements are 
+ *        weighted equally and the model converges to the least squares solution.
+ * 
+ *        This class is non-copyable and non-movable.
+ */
+class Online final : public Interface
+{
+public:
+    /**
+     * @brief Constructor.
+     * 
+     * @param[in] forgettingFactor Weight of older measurements per update (default = 1.0). 
+     *                             Values outside (0.0, 1.0] are replaced by 1.0.
+     * @param[in] initialCovariance Initial variance of the parameters (default = 1000.0). 
+     *                              Larger values let the first measurements dominate. 
+     *                              Values less than or equal to 0.0 are replaced by the
+     *                              default value.
+     */
+    explicit Online(double forgettingFactor = 1.0, double initialCovariance = 1000.0) noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~Online() noexcept override = default;
+
+    /**
+     * @brief Check whether the model is trained.
+     * 
+     * @return True if at least two measurements have been added, false otherwise.
+     */
+    bool isTrained() const noexcept override;
+
+    /**
+     * @brief Predict based on given input.
+     * 
+     * @param[in] input Input for which to predict.
+     * 
+     * @return The predicted value.
+     */
+    double predict(double input) const noexcept override;
+
+    /**
+     * @brief Predict based on many inputs at once.
+     * 
+     *        All predictions are computed with the vectorized kernel batch::affine().
+     * 
+     * @param[in] input The inputs for which to predict.
+     * @param[out] output Buffer for storing the predicted values, one per input. May be 
+     *                    the input.
+     * @param[in] count The number of inputs.
+     * 
+     * @return True on success, false if the input or output is null while count isn't 0.
+     */
+    bool predictBatch(const double* input, double* output, size_t count) const noexcept override;
+
+    /**
+     * @brief Get the size of the serialized model parameters.
+     * 
+     * @return The size of the serialized weight, bias and covariance in bytes.
+     */
+    uint8_t serializedSize() const noexcept override;
+
+    /**
+     * @brief Serialize the weight, bias and covariance of the model.
+     * 
+     *        The covariance is included, so that a restored model keeps its confidence when
+     *        updated further.
+     * 
+     * @param[out] data Buffer for storing the serialized parameters.
+     * @param[in] size The size of the buffer in bytes. Must be at least serializedSize().
+     * 
+     * @return True on success, false if the model isn't trained or if the buffer is too small.
+     */
+    bool serialize(uint8_t* data, uint8_t size) const noexcept override;
+
+    /**
+     * @brief Deserialize the weight, bias and covariance of the model. The model is trained 
+     *        afterwards.
+     * 
+     * @param[in] data The serialized parameters.
+     * @param[in] size The size of the serialized parameters in bytes. Must match 
+     *                 serializedSize().
+     * 
+     * @return True on success, false if the size doesn't match.
+     */
+    bool deserialize(const uint8_t* data, uint8_t size) noexcept override;
+
+    /**
+     * @brief Add a reference measurement to the model.
+     * 
+     * @param[in] input The measured input value.
+     * @param[in] output The reference output value.
+     * 
+     * @return True on success, false if the update is numerically invalid, in which case the
+     *         model is left unchanged.
+     */
+    bool update(double input, double output) noexcept;
+
+    /**
+     * @brief Train the model from scratch with given training data.
+     * 
+     *        The model is reset, then each training set is added as a measurement.
+     * 
+     * @param[in] trainIn Training data input values.
+     * @param[in] trainOut Training data output values.
+     * 
+     * @return True on success, false if fewer than two training sets are present or if 
+     *         an update failed.
+     */
+    bool train(const Matrix1d& trainIn, const Matrix2d& trainOut) noexcept;
+
+    /**
+     * @brief Reset the model to the untrained state.
+     */
+    void reset() noexcept;
+
+    Online(const Online&)            = delete; // No copy constructor.
+    Online(Online&&)                 = delete; // No move constructor.
+    Online& operator=(const Online&) = delete; // No copy assignment.
+    Online& operator=(Online&&)      = delete; // No move assignment.
+
+private:
+    /** Model weight (k-value). */
+    double myWeight;
+
+    /** Model bias (m-value). */
+    double myBias;
+
+    /** Covariance of the weight estimate. */
+    double myWeightVariance;
+
+    /** Covariance of the weight and bias estimates. */
+    double myCovariance;
+
+    /** Covariance of the bias estimate. */
+    double myBiasVariance;
+
+    /** Weight of older measurements per update. */
+    const double myForgettingFactor;
+
+    /** Initial variance of the parameters. */
+    const double myInitialCovariance;
+
+    /** The number of added measurements, saturated at 2. */
+    uint8_t myUpdateCount;
+};
+} // namespace lin_reg
+} // namespace ml
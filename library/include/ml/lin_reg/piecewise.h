@@ -0,0 +1,281 @@
+/**
+ * @brief Piecewise linear regression implementation.
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ml/lin_reg/interface.h"
+#include "ml/lin_reg/quantized.h"
+#include "ml/types.h"
+
+namespace ml
+{
+namespace lin_reg
+{
+/**
+ * @brief Piecewise linear regression implementation.
+ * 
+ *        The model consists of consecutive linear segments joined at knots, which 
+ *        approximates nonlinear sensors such as thermistors to any precision given enough 
+ *        segments. Predictions interpolate linearly between the two knots surrounding the 
+ *        input, which are found with a binary search. Inputs outside the knots are 
+ *        extrapolated from the first and last segment.
+ * 
+ *        This class is non-copyable and non-movable.
+ * 
+ * @tparam SegmentCount The number of segments. Must be between 1 and 32, such that the 
+ *                      serialized knots and values fit in 255 bytes (at most 14 segments 
+ *                      with 64-bit doubles).
+ */
+template <uint8_t SegmentCount>
+class Piecewise final : public Interface
+{
+    // Generate compiler errors if the number of segments is invalid.
+    static_assert((0U < SegmentCount) && (32U >= SegmentCount), "Invalid segment count!");
+    static_assert(UINT8_MAX >= 2U * (SegmentCount + 1U) * sizeof(double), 
+                  "The serialized model parameters must fit in 255 bytes!");
+
+public:
+    /** The number of knots, one more than the number of segments. */
+    static constexpr uint8_t KnotCount{SegmentCount + 1U};
+
+    /**
+     * @brief Create untrained model.
+     */
+    Piecewise() noexcept;
+
+    /**
+     * @brief Create a pre-trained model.
+     * 
+     * @param[in] knots The input values of the knots. Must be strictly increasing, else the 
+     *                  model is untrained.
+     * @param[in] values The predicted values at the knots.
+     */
+    Piecewise(const double (&knots)[KnotCount], const double (&values)[KnotCount]) noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~Piecewise() noexcept override = default;
+
+    /**
+     * @brief Get the number of segments.
+     * 
+     * @return The number of segments.
+     */
+    static constexpr uint8_t segmentCount() noexcept { return SegmentCount; }
+
+    /**
+     * @brief Check whether the model is trained.
+     * 
+     * @return True if the model is trained, false otherwise.
+     */
+    bool isTrained() const noexcept override;
+
+    /**
+     * @brief Predict based on given input.
+     * 
+     * @param[in] input Input for which to predict.
+     * 
+     * @return The predicted value, or 0 if the model is untrained.
+     */
+    double predict(double input) const noexcept override;
+
+    /**
+     * @brief Predict based on many inputs at once.
+     * 
+     *        The segment of each input is found with a binary search, so predictions are 
+     *        computed one at a time, but without a virtual call per input.
+     * 
+     * @param[in] input The inputs for which to predict.
+     * @param[out] output Buffer for storing the predicted values, one per input. May be 
+     *                    the input.
+     * @param[in] count The number of inputs.
+     * 
+     * @return True on success, false if the input or output is null while count isn't 0.
+     */
+    bool predictBatch(const double* input, double* output, size_t count) const noexcept override;
+
+    /**
+     * @brief Get the size of the serialized model parameters.
+     * 
+     * @return The size of the serialized knots and values in bytes.
+     */
+    uint8_t serializedSize() const noexcept override;
+
+    /**
+     * @brief Serialize the knots and values of the model.
+     * 
+     * @param[out] data Buffer for storing the serialized parameters.
+     * @param[in] size The size of the buffer in bytes. Must be at least serializedSize().
+     * 
+     * @return True on success, false if the model isn't trained or if the buffer is too small.
+     */
+    bool serialize(uint8_t* data, uint8_t size) const noexcept override;
+
+    /**
+     * @brief Deserialize the knots and values of the model. The model is trained afterwards.
+     * 
+     * @param[in] data The serialized parameters.
+     * @param[in] size The size of the serialized parameters in bytes. Must match 
+     *                 serializedSize().
+     * 
+     * @return True on success, false if the size doesn't match or if the knots aren't 
+     *         strictly increasing.
+     */
+    bool deserialize(const uint8_t* data, uint8_t size) noexcept override;
+
+    /**
+     * @brief Train the model with closed-form least squares.
+     * 
+     *        The knots are spread evenly between the smallest and the largest input value. 
+     *        The values at the knots minimizing the mean squared error of the continuous model
+     *        form a tridiagonal system, which is solved in a single pass without pivoting, so 
+     *        training requires memory proportional to the number of knots only.
+     * 
+     * @param[in] trainIn Training data input values.
+     * @param[in] trainOut Training data output values.
+     * 
+     * @return True on success, false if all input values are equal or if a knot has no 
+     *         training data in its adjacent segments, in which case the model isn't changed.
+     */
+    bool train(const Matrix1d& trainIn, const Matrix2d& trainOut) noexcept;
+
+    /**
+     * @brief Get the input value of given knot.
+     * 
+     * @param[in] index The index of the knot. Must be less than KnotCount.
+     * 
+     * @return The input value of the knot, or 0 if the index is invalid.
+     */
+    double knot(uint8_t index) const noexcept;
+
+    Piecewise(const Piecewise&)            = delete; // No copy constructor.
+    Piecewise(Piecewise&&)                 = delete; // No move constructor.
+    Piecewise& operator=(const Piecewise&) = delete; // No copy assignment.
+    Piecewise& operator=(Piecewise&&)      = delete; // No move assignment.
+
+private:
+    uint8_t findSegment(double input) const noexcept;
+    bool isIncreasing() const noexcept;
+
+    /** The size of the serialized parameters in bytes. */
+    static constexpr uint8_t SerializedSize{2U * KnotCount * sizeof(double)};
+
+    /** The input values of the knots in increasing order. */
+    double myKnots[KnotCount];
+
+    /** The predicted values at the knots. */
+    double myValues[KnotCount];
+
+    /** Indicate whether the model is trained. */
+    bool myTrained;
+};
+
+/**
+ * @brief Quantized piecewise linear regression implementation.
+ * 
+ *        The knots are stored as ADC values, while the values at the knots and the slope of 
+ *        each segment per ADC step are stored as signed fixed-point numbers in Q format with 
+ *        the given number of fractional bits. Each prediction costs a binary search over 
+ *        16-bit knots, a single 32-bit multiply-add and a shift.
+ * 
+ *        This class is non-copyable and non-movable.
+ * 
+ * @tparam SegmentCount The number of segments. Must be between 1 and 32.
+ * @tparam FracBits The number of fractional bits of the values and slopes (default = 16). 
+ *                  Must be between 1 and 24.
+ */
+template <uint8_t SegmentCount, uint8_t FracBits = 16U>
+class QuantizedPiecewise final : public QuantizedInterface
+{
+    // Generate compiler errors if the parameters are invalid.
+    static_assert((0U < SegmentCount) && (32U >= SegmentCount), "Invalid segment count!");
+    static_assert((0U < FracBits) && (24U >= FracBits), "Invalid number of fractional bits!");
+
+public:
+    /**
+     * @brief Create untrained model.
+     */
+    QuantizedPiecewise() noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~QuantizedPiecewise() noexcept override = default;
+
+    /**
+     * @brief Check whether the model is trained.
+     * 
+     * @return True if the model is trained, false otherwise.
+     */
+    bool isTrained() const noexcept override;
+
+    /**
+     * @brief Predict based on given ADC value.
+     * 
+     *        ADC values above the max value given at quantization are saturated.
+     * 
+     * @param[in] adcValue The raw ADC value for which to predict.
+     * 
+     * @return The predicted value rounded to the nearest integer, or 0 if the model is 
+     *         untrained.
+     */
+    int16_t predict(uint16_t adcValue) const noexcept override;
+
+    /**
+     * @brief Quantize a trained model predicting based on the input voltage of an ADC.
+     * 
+     *        The knots are rounded to the nearest ADC values, where the model is evaluated.
+     * 
+     * @param[in] model The trained model to quantize.
+     * @param[in] maxValue The max value of the ADC. Must be greater than 0.
+     * @param[in] supplyVoltage The supply voltage of the ADC in Volts. Must be greater than 0.
+     * @param[out] maxError Reference to variable for storing the max absolute error of the
+     *                      quantized model, evaluated at every ADC value and excluding the 
+     *                      rounding of predictions to the nearest integer.
+     * 
+     * @return True on success, false if the model isn't trained, if the parameters are 
+     *         invalid or if the predictions don't fit in the fixed-point format.
+     */
+    bool quantize(const Piecewise<SegmentCount>& model, uint16_t maxValue, double supplyVoltage, 
+                  double& maxError) noexcept;
+
+    QuantizedPiecewise(const QuantizedPiecewise&)            = delete; // No copy constructor.
+    QuantizedPiecewise(QuantizedPiecewise&&)                 = delete; // No move constructor.
+    QuantizedPiecewise& operator=(const QuantizedPiecewise&) = delete; // No copy assignment.
+    QuantizedPiecewise& operator=(QuantizedPiecewise&&)      = delete; // No move assignment.
+
+private:
+    int32_t evaluate(uint16_t adcValue) const noexcept;
+
+    /** The number of knots, one more than the number of segments. */
+    static constexpr uint8_t KnotCount{SegmentCount + 1U};
+
+    /** Scale factor of the fixed-point format. */
+    static constexpr int32_t Scale{static_cast<int32_t>(1UL << FracBits)};
+
+    /** Half of the fixed-point scale, used for rounding. */
+    static constexpr int32_t Half{Scale / 2};
+
+    /** The knots as ADC values in non-decreasing order. */
+    uint16_t myKnots[KnotCount];
+
+    /** The values at the knots in fixed-point format. */
+    int32_t myValues[KnotCount];
+
+    /** The slope of each segment per ADC step in fixed-point format. */
+    int32_t mySlopes[SegmentCount];
+
+    /** Max ADC value. */
+    uint16_t myMaxValue;
+
+    /** Indicate whether the model is trained. */
+    bool myTrained;
+};
+} // namespace lin_reg
+} // namespace ml
+
+#include "impl/piecewise_impl.h"
@@ -0,0 +1,137 @@
+/**
+ * @brief Quantized linear regression implementation.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "ml/lin_reg/interface.h"
+
+namespace ml
+{
+namespace lin_reg
+{
+/**
+ * @brief Quantized linear regression interface.
+ * 
+ *        Quantized models predict directly from raw ADC values with integer arithmetic only.
+ */
+class QuantizedInterface
+{
+public:
+    /**
+     * @brief Destructor.
+     */
+    virtual ~QuantizedInterface() noexcept = default;
+
+    /**
+     * @brief Check whether the model is trained.
+     * 
+     * @return True if the model is trained, false otherwise.
+     */
+    virtual bool isTrained() const noexcept = 0;
+
+    /**
+     * @brief Predict based on given ADC value.
+     * 
+     * @param[in] adcValue The raw ADC value for which to predict.
+     * 
+     * @return The predicted value rounded to the nearest integer, or 0 if the model is 
+     *         untrained.
+     */
+    virtual int16_t predict(uint16_t adcValue) const noexcept = 0;
+};
+
+/**
+ * @brief Quantized linear regression implementation.
+ * 
+ *        The weight and bias are stored as signed fixed-point numbers in Q format with the 
+ *        given number of fractional bits. The conversion from ADC value to input voltage is 
+ *        folded into the weight when quantizing a trained model, so each prediction costs a 
+ *        single 32-bit multiply-add and a shift instead of floating-point math.
+ * 
+ *        This class is non-copyable and non-movable.
+ * 
+ * @tparam FracBits The number of fractional bits of the weight and bias (default = 16). 
+ *                  Must be between 1 and 24.
+ */
+template <uint8_t FracBits = 16U>
+class Quantized final : public QuantizedInterface
+{
+    // Generate a compiler error if the number of fractional bits is invalid.
+    static_assert((0U < FracBits) && (24U >= FracBits), "Invalid number of fractional bits!");
+
+public:
+    /**
+     * @brief Create untrained model.
+     */
+    Quantized() noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~Quantized() noexcept override = default;
+
+    /**
+     * @brief Check whether the model is trained.
+     * 
+     * @return True if the model is trained, false otherwise.
+     */
+    bool isTrained() const noexcept override;
+
+    /**
+     * @brief Predict based on given ADC value.
+     * 
+     *        ADC values above the max value given at quantization are saturated.
+     * 
+     * @param[in] adcValue The raw ADC value for which to predict.
+     * 
+     * @return The predicted value rounded to the nearest integer, or 0 if the model is 
+     *         untrained.
+     */
+    int16_t predict(uint16_t adcValue) const noexcept override;
+
+    /**
+     * @brief Quantize a trained model predicting based on the input voltage of an ADC.
+     * 
+     * @param[in] model The trained model to quantize.
+     * @param[in] maxValue The max value of the ADC. Must be greater than 0.
+     * @param[in] supplyVoltage The supply voltage of the ADC in Volts. Must be greater than 0.
+     * @param[out] maxError Reference to variable for storing the max absolute error of the
+     *                      quantized weight and bias over the entire ADC range, excluding
+     *                      the rounding of predictions to the nearest integer.
+     * 
+     * @return True on success, false if the model isn't trained, if the parameters are 
+     *         invalid or if the predictions don't fit in the fixed-point format.
+     */
+    bool quantize(const Interface& model, uint16_t maxValue, double supplyVoltage, 
+                  double& maxError) noexcept;
+
+    Quantized(const Quantized&)            = delete; // No copy constructor.
+    Quantized(Quantized&&)                 = delete; // No move constructor.
+    Quantized& operator=(const Quantized&) = delete; // No copy assignment.
+    Quantized& operator=(Quantized&&)      = delete; // No move assignment.
+
+private:
+    /** Scale factor of the fixed-point format. */
+    static constexpr int32_t Scale{static_cast<int32_t>(1UL << FracBits)};
+
+    /** Half of the fixed-point scale, used for rounding. */
+    static constexpr int32_t Half{Scale / 2};
+
+    /** Model weight per ADC step in fixed-point format. */
+    int32_t myWeight;
+
+    /** Model bias in fixed-point format. */
+    int32_t myBias;
+
+    /** Max ADC value. */
+    uint16_t myMaxValue;
+
+    /** Indicate whether the model is trained. */
+    bool myTrained;
+};
+} // namespace lin_reg
+} // namespace ml
+
+#include "impl/quantized_impl.h"
@@ -0,0 +1,81 @@
+/**
+ * @brief Persistent storage of linear regression models in EEPROM.
+ */
+#pragma once
+
+#include <stdint.h>
+
+namespace driver
+{
+/** EEPROM (Electrically Erasable Programmable ROM) stream interface. */
+namespace eeprom { class Interface; }
+} // namespace driver
+
+namespace ml
+{
+namespace lin_reg
+{
+/** Linear regression interface. */
+class Interface;
+
+/**
+ * @brief Persistent storage of linear regression models in EEPROM.
+ * 
+ *        Models are stored as records with the following layout:
+ *            - Version of the record format (1 byte).
+ *            - Size of the serialized model parameters (1 byte).
+ *            - Serialized model parameters, see Interface::serialize().
+ *            - CRC16 checksum of the preceding bytes (2 bytes, little endian).
+ * 
+ *        Loading a stored model only requires a few EEPROM reads, so the model doesn't need
+ *        to be retrained at every boot. Records written by another format version, for 
+ *        another model type or corrupted records are rejected.
+ */
+namespace storage
+{
+/** Version of the record format, increase whenever the layout changes. */
+constexpr uint8_t Version{1U};
+
+/** Maximum size of the serialized model parameters in bytes. */
+constexpr uint8_t MaxParameterSize{64U};
+
+/** The number of bytes added to the serialized model parameters by each record. */
+constexpr uint8_t RecordOverhead{4U};
+
+/**
+ * @brief Get the size of the record of given model.
+ * 
+ * @param[in] model The model.
+ * 
+ * @return The size of the record in bytes.
+ */
+uint16_t recordSize(const Interface& model) noexcept;
+
+/**
+ * @brief Store given model in EEPROM.
+ * 
+ * @param[in] model The trained model to store.
+ * @param[in] eeprom The EEPROM stream to write to.
+ * @param[in] address The start address of the record.
+ * 
+ * @return True on success, false if the model isn't trained, the model parameters are too 
+ *         large or if the EEPROM write failed.
+ */
+bool save(const Interface& model, driver::eeprom::Interface& eeprom, 
+          uint16_t address) noexcept;
+
+/**
+ * @brief Load given model from EEPROM.
+ * 
+ * @param[out] model The model to load. The model is left unchanged on failure.
+ * @param[in] eeprom The EEPROM stream to read from.
+ * @param[in] address The start address of the record.
+ * 
+ * @return True on success, false if the record is missing, has another version or size, 
+ *         if the checksum doesn't match or if the EEPROM read failed.
+ */
+bool load(Interface& model, const driver::eeprom::Interface& eeprom, 
+          uint16_t address) noexcept;
+} // namespace storage
+} // namespace lin_reg
+} // namespace ml
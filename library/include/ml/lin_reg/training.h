@@ -0,0 +1,55 @@
+/**
+ * @brief Options and results of iterative model training.
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace ml
+{
+namespace lin_reg
+{
+/**
+ * @brief Structure of gradient descent training options.
+ */
+struct TrainingOptions
+{
+    /** Maximum number of epochs to perform training. Must be greater than 0. */
+    size_t epochCount{100U};
+
+    /** Learning rate to use for updating the parameters. Must be in the range (0.0, 1.0]. */
+    double learningRate{0.01};
+
+    /**
+     * Stop training once the mean squared error changes less than this value between two 
+     * consecutive epochs. Must be at least 0.0, early stopping is disabled if 0.0.
+     */
+    double minLossDelta{0.0};
+
+    /** Indicate whether to shuffle the training sets before each epoch. */
+    bool shuffle{false};
+
+    /** Seed of the pseudo-random number generator used for shuffling. */
+    uint32_t seed{1U};
+};
+
+/**
+ * @brief Structure of gradient descent training results.
+ */
+struct TrainingReport
+{
+    /** The number of epochs performed. */
+    size_t epochCount;
+
+    /** The mean squared error of the last epoch performed. */
+    double loss;
+
+    /** Indicate whether training stopped early since the loss stopped improving. */
+    bool converged;
+
+    /** Indicate whether training succeeded. */
+    bool valid;
+};
+} // namespace lin_reg
+} // namespace ml
@@ -0,0 +1,360 @@
+/**
+ * @brief Row-major matrices and linear algebra kernels for machine learning models.
+ */
+#pragma once
+
+#include <stddef.h>
+
+#include "utils/type_traits.h"
+
+namespace ml
+{
+/**
+ * @brief Non-owning view of equally spaced matrix elements, such as a row or a column.
+ *
+ *        Views point directly into the matrix, so no elements are copied. A view is only
+ *        valid as long as the viewed matrix isn't resized or deleted. Views are cheap to copy.
+ *
+ * @tparam T The element type, const for read-only views.
+ */
+template <typename T>
+class VectorView
+{
+public:
+    /**
+     * @brief Create view of given elements.
+     *
+     * @param[in] data Pointer to the first element.
+     * @param[in] size The number of elements.
+     * @param[in] stride The distance between consecutive elements (default = 1).
+     */
+    VectorView(T* data, size_t size, size_t stride = 1U) noexcept;
+
+    /**
+     * @brief Create read-only view of a writable view.
+     *
+     * @tparam U The element type of the other view.
+     *
+     * @param[in] other The view to create a read-only view of.
+     */
+    template <typename U>
+    VectorView(const VectorView<U>& other) noexcept;
+
+    /**
+     * @brief Delete view.
+     */
+    ~VectorView() noexcept = default;
+
+    /**
+     * @brief Get the number of elements of the view.
+     *
+     * @return The number of elements.
+     */
+    size_t size() const noexcept;
+
+    /**
+     * @brief Get the distance between consecutive elements of the view.
+     *
+     * @return The stride in elements, 1 for contiguous views.
+     */
+    size_t stride() const noexcept;
+
+    /**
+     * @brief Get pointer to the first element of the view.
+     *
+     * @return Pointer to the first element.
+     */
+    T* data() const noexcept;
+
+    /**
+     * @brief Get element at given index.
+     *
+     * @param[in] index Index of the element. Must be less than size().
+     *
+     * @return Reference to the element.
+     */
+    T& operator[](size_t index) const noexcept;
+
+private:
+    /** Pointer to the first element. */
+    T* myData;
+
+    /** The number of elements. */
+    size_t mySize;
+
+    /** Distance between consecutive elements. */
+    size_t myStride;
+};
+
+namespace detail
+{
+/**
+ * @brief Storage of matrices with compile-time dimensions.
+ *
+ * @tparam T The element type.
+ * @tparam Rows The number of rows.
+ * @tparam Cols The number of columns.
+ */
+template <typename T, size_t Rows, size_t Cols>
+class MatrixStorage;
+
+/**
+ * @brief Storage of matrices with runtime dimensions.
+ *
+ * @tparam T The element type.
+ */
+template <typename T>
+class MatrixStorage<T, 0U, 0U>;
+} // namespace detail
+
+/**
+ * @brief Row-major matrix with contiguous storage.
+ *
+ *        Matrices with compile-time dimensions are stored in a static array, while matrices
+ *        with runtime dimensions are stored in a single heap allocation. In both cases, the
+ *        elements of each row are adjacent in memory, so rows are traversed sequentially
+ *        by the kernels below.
+ *
+ *        This class is non-copyable and non-movable.
+ *
+ * @tparam T The element type. Must be arithmetic.
+ * @tparam Rows The number of rows, or 0 for runtime dimensions (default = 0).
+ * @tparam Cols The number of columns, or 0 for runtime dimensions (default = 0).
+ */
+template <typename T, size_t Rows = 0U, size_t Cols = 0U>
+class Matrix
+{
+    // Generate compiler errors if the parameters are invalid.
+    static_assert(type_traits::is_arithmetic<T>::value, "Matrices only support arithmetic types!");
+    static_assert((0U == Rows) == (0U == Cols), "Either both or no dimensions must be fixed!");
+
+public:
+    /**
+     * @brief Create matrix with all elements set to 0.
+     *
+     *        Matrices with runtime dimensions are empty unless dimensions are given.
+     *
+     * @param[in] rows The number of rows (default = Rows).
+     * @param[in] cols The number of columns (default = Cols).
+     */
+    explicit Matrix(size_t rows = Rows, size_t cols = Cols) noexcept;
+
+    /**
+     * @brief Delete matrix.
+     */
+    ~Matrix() noexcept = default;
+
+    /**
+     * @brief Check whether the matrix has compile-time dimensions.
+     *
+     * @return True if the dimensions are fixed at compile time, false otherwise.
+     */
+    static constexpr bool isStatic() noexcept { return 0U != Rows; }
+
+    /**
+     * @brief Get the number of rows.
+     *
+     * @return The number of rows.
+     */
+    size_t rows() const noexcept;
+
+    /**
+     * @brief Get the number of columns.
+     *
+     * @return The number of columns.
+     */
+    size_t cols() const noexcept;
+
+    /**
+     * @brief Get the number of elements.
+     *
+     * @return The number of elements.
+     */
+    size_t size() const noexcept;
+
+    /**
+     * @brief Check whether the matrix is empty.
+     *
+     * @return True if the matrix holds no elements, false otherwise.
+     */
+    bool empty() const noexcept;
+
+    /**
+     * @brief Get pointer to the elements in row-major order.
+     *
+     * @return Pointer to the first element.
+     */
+    T* data() noexcept;
+
+    /**
+     * @brief Get pointer to the elements in row-major order.
+     *
+     * @return Pointer to the first element.
+     */
+    const T* data() const noexcept;
+
+    /**
+     * @brief Get element at given position.
+     *
+     * @param[in] row The row of the element. Must be less than rows().
+     * @param[in] col The column of the element. Must be less than cols().
+     *
+     * @return Reference to the element.
+     */
+    T& operator()(size_t row, size_t col) noexcept;
+
+    /**
+     * @brief Get element at given position.
+     *
+     * @param[in] row The row of the element. Must be less than rows().
+     * @param[in] col The column of the element. Must be less than cols().
+     *
+     * @return Reference to the element.
+     */
+    const T& operator()(size_t row, size_t col) const noexcept;
+
+    /**
+     * @brief Get view of given row.
+     *
+     * @param[in] row The row to view. Must be less than rows().
+     *
+     * @return Contiguous view of the row.
+     */
+    VectorView<T> row(size_t row) noexcept;
+
+    /**
+     * @brief Get read-only view of given row.
+     *
+     * @param[in] row The row to view. Must be less than rows().
+     *
+     * @return Contiguous view of the row.
+     */
+    VectorView<const T> row(size_t row) const noexcept;
+
+    /**
+     * @brief Get view of given column.
+     *
+     * @param[in] col The column to view. Must be less than cols().
+     *
+     * @return Strided view of the column.
+     */
+    VectorView<T> col(size_t col) noexcept;
+
+    /**
+     * @brief Get read-only view of given column.
+     *
+     * @param[in] col The column to view. Must be less than cols().
+     *
+     * @return Strided view of the column.
+     */
+    VectorView<const T> col(size_t col) const noexcept;
+
+    /**
+     * @brief Resize the matrix. All elements are set to 0 afterwards.
+     *
+     *        Matrices with compile-time dimensions can only be "resized" to their dimensions.
+     *
+     * @param[in] rows The new number of rows.
+     * @param[in] cols The new number of columns.
+     *
+     * @return True on success, false if the dimensions are invalid or on allocation failure.
+     */
+    bool resize(size_t rows, size_t cols) noexcept;
+
+    /**
+     * @brief Set all elements to given value.
+     *
+     * @param[in] value The value to set.
+     */
+    void fill(T value) noexcept;
+
+    Matrix(const Matrix&)            = delete; // No copy constructor.
+    Matrix(Matrix&&)                 = delete; // No move constructor.
+    Matrix& operator=(const Matrix&) = delete; // No copy assignment.
+    Matrix& operator=(Matrix&&)      = delete; // No move assignment.
+
+private:
+    /** Storage of the elements and the dimensions. */
+    detail::MatrixStorage<T, Rows, Cols> myStorage;
+};
+
+/**
+ * @brief Multiply two matrices, out = a * b.
+ *
+ *        Blocks of four adjacent output elements are accumulated in registers while walking
+ *        down b, so each output element is written once and b is read in adjacent groups.
+ *
+ * @param[in] a The left-hand matrix (n x m).
+ * @param[in] b The right-hand matrix (m x p).
+ * @param[out] out The output matrix (n x p). Matrices with runtime dimensions are resized.
+ *                 Must not be a or b.
+ *
+ * @return True on success, false if the dimensions don't match or if out is a or b.
+ */
+template <typename T, size_t R1, size_t C1, size_t R2, size_t C2, size_t R3, size_t C3>
+bool multiply(const Matrix<T, R1, C1>& a, const Matrix<T, R2, C2>& b,
+              Matrix<T, R3, C3>& out) noexcept;
+
+/**
+ * @brief Multiply matrix and vector, y = a * x.
+ *
+ *        Each output element is the dot product of a contiguous row and x.
+ *
+ * @param[in] a The matrix (n x m).
+ * @param[in] x The input vector (m elements).
+ * @param[out] y The output vector (n elements). Must not overlap x.
+ *
+ * @return True on success, false if the sizes don't match.
+ */
+template <typename T, size_t Rows, size_t Cols>
+bool multiply(const Matrix<T, Rows, Cols>& a, 
+              VectorView<const typename type_traits::type_identity<T>::type> x, 
+              VectorView<T> y) noexcept;
+
+/**
+ * @brief Transpose matrix, out = a^T.
+ *
+ *        The matrix is transposed in square blocks, so that both the rows read and the rows
+ *        written stay in cache.
+ *
+ * @param[in] a The matrix to transpose (n x m).
+ * @param[out] out The output matrix (m x n). Matrices with runtime dimensions are resized.
+ *                 Must not be a.
+ *
+ * @return True on success, false if the dimensions don't match or if out is a.
+ */
+template <typename T, size_t R1, size_t C1, size_t R2, size_t C2>
+bool transpose(const Matrix<T, R1, C1>& a, Matrix<T, R2, C2>& out) noexcept;
+
+/**
+ * @brief Scale and add vector, y = alpha * x + y.
+ *
+ * @param[in] alpha The scale factor.
+ * @param[in] x The vector to scale and add.
+ * @param[in, out] y The vector to add to.
+ *
+ * @return True on success, false if the sizes don't match.
+ */
+template <typename T>
+bool axpy(T alpha, VectorView<const typename type_traits::type_identity<T>::type> x, 
+          VectorView<T> y) noexcept;
+
+/**
+ * @brief Solve a square system of linear equations, a * x = b.
+ *
+ *        The system is solved with Gaussian elimination and partial pivoting, followed by 
+ *        back substitution. a and b are overwritten during elimination.
+ *
+ * @tparam Size The number of equations and unknowns.
+ *
+ * @param[in, out] a The coefficient matrix (Size x Size).
+ * @param[in, out] b The right-hand side (Size elements).
+ * @param[out] x The solution (Size elements).
+ *
+ * @return True on success, false if a is singular, in which case x is undefined.
+ */
+template <size_t Size>
+bool solve(Matrix<double, Size, Size>& a, double (&b)[Size], double (&x)[Size]) noexcept;
+} // namespace ml
+
+#include "impl/matrix_impl.h"
@@ -0,0 +1,41 @@
+/**
+ * @brief Fixed-point activation functions for neural networks.
+ */
+#pragma once
+
+#include <stdint.h>
+
+namespace ml
+{
+namespace nn
+{
+/** The number of fractional bits of activations between layers (Q12, range [-8, 8)). */
+constexpr uint8_t ActivationFracBits{12U};
+
+/**
+ * @brief Enumeration of activation functions.
+ */
+enum class Activation : uint8_t
+{
+    Linear, /** Identity, used for output layers. */
+    Relu,   /** Rectified linear unit, max(0, x). */
+    Tanh,   /** Hyperbolic tangent, looked up in a table stored in program memory. */
+};
+
+/**
+ * @brief Apply activation function to given value.
+ * 
+ *        The hyperbolic tangent is interpolated linearly between 129 table entries covering 
+ *        [0, 4] in steps of 1/32, using tanh(-x) = -tanh(x) for negative values, and saturates
+ *        beyond. The table occupies 258 bytes of program memory and the max error is below 
+ *        1/1024.
+ * 
+ * @param[in] activation The activation function to apply.
+ * @param[in] value The value in Q12 format.
+ * 
+ * @return The activated value in Q12 format.
+ */
+int16_t activate(Activation activation, int16_t value) noexcept;
+
+} // namespace nn
+} // namespace ml
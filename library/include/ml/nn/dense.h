@@ -0,0 +1,71 @@
+/**
+ * @brief Fixed-point dense neural network layers.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "ml/nn/activation.h"
+
+namespace ml
+{
+namespace nn
+{
+/**
+ * @brief Structure of a fully connected layer with weights stored in program memory.
+ * 
+ *        Each output is act((sum(w * x) + b) >> shift), where the inputs x are Q12 
+ *        activations, the weights w have f fractional bits and the biases b have 12 + f 
+ *        fractional bits. Hidden layers use shift = f, so that the outputs are Q12 
+ *        activations again, while the output layer may use a smaller shift to produce the
+ *        number of fractional bits required by the application.
+ * 
+ *        The structure itself is small and is kept in RAM, while the weights and biases
+ *        are intended to be stored in program memory (PROGMEM), for instance as generated 
+ *        by the host-side exporter.
+ * 
+ * @tparam Weight The weight type, int8_t or int16_t.
+ */
+template <typename Weight>
+struct Dense
+{
+    /** Weights in row-major order in program memory, one row of inputs per output. */
+    const Weight* weights;
+
+    /** Biases in program memory, one per output. */
+    const int32_t* biases;
+
+    /** The number of inputs. */
+    uint8_t inputCount;
+
+    /** The number of outputs. */
+    uint8_t outputCount;
+
+    /** Right shift converting the accumulated sums to the output format. */
+    uint8_t shift;
+
+    /** Activation function applied to the outputs. */
+    Activation activation;
+};
+
+/**
+ * @brief Compute the outputs of a dense layer.
+ * 
+ *        Products are accumulated in 32 bits for 8-bit weights and in 64 bits for 16-bit 
+ *        weights, so the sums can't overflow. The outputs are rounded to nearest and 
+ *        saturated to 16 bits before the activation function is applied.
+ * 
+ * @tparam Weight The weight type, int8_t or int16_t.
+ * 
+ * @param[in] layer The layer to compute.
+ * @param[in] input The input activations, layer.inputCount values.
+ * @param[out] output Buffer for storing the output activations, layer.outputCount values.
+ *                    Must not overlap the input.
+ */
+template <typename Weight>
+void forward(const Dense<Weight>& layer, const int16_t* input, int16_t* output) noexcept;
+
+} // namespace nn
+} // namespace ml
+
+#include "impl/dense_impl.h"
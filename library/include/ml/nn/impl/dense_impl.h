@@ -0,0 +1,75 @@
+/**
+ * @brief Implementation details of fixed-point dense neural network layers.
+ * 
+ * @note Don't include this header, use <dense.h> instead!
+ */
+#pragma once
+
+#include "arch/avr/hw_platform.h"
+#include "utils/type_traits.h"
+
+namespace ml
+{
+namespace nn
+{
+namespace detail
+{
+/**
+ * @brief Accumulator types wide enough to sum products of 16-bit activations and weights.
+ * 
+ * @tparam Weight The weight type.
+ */
+template <typename Weight>
+struct Accumulator;
+
+/** 8-bit weights: up to 255 products of 23 bits each fit in 32 bits. */
+template <>
+struct Accumulator<int8_t> { using type = int32_t; };
+
+/** 16-bit weights: products of 31 bits each require 64 bits. */
+template <>
+struct Accumulator<int16_t> { using type = int64_t; };
+
+// -----------------------------------------------------------------------------
+inline int8_t readWeight(const int8_t* address) noexcept
+{
+    return static_cast<int8_t>(pgm_read_byte(address));
+}
+
+// -----------------------------------------------------------------------------
+inline int16_t readWeight(const int16_t* address) noexcept
+{
+    return static_cast<int16_t>(pgm_read_word(address));
+}
+} // namespace detail
+
+// -----------------------------------------------------------------------------
+template <typename Weight>
+void forward(const Dense<Weight>& layer, const int16_t* input, int16_t* output) noexcept
+{
+    // Generate a compiler error if the weight type is unsupported.
+    static_assert(type_traits::is_same<Weight, int8_t>::value || 
+                  type_traits::is_same<Weight, int16_t>::value, 
+                  "Only 8-bit and 16-bit weights are supported!");
+    using Sum = typename detail::Accumulator<Weight>::type;
+    const Sum half{0U < layer.shift ? static_cast<Sum>(1) << (layer.shift - 1U) : 0};
+    const Weight* weights{layer.weights};
+
+    for (uint8_t i{}; i < layer.outputCount; ++i)
+    {
+        // Start from the bias and accumulate the weighted inputs, reading one row of weights.
+        Sum sum{static_cast<int32_t>(pgm_read_dword(&layer.biases[i]))};
+        for (uint8_t j{}; j < layer.inputCount; ++j)
+        {
+            sum += static_cast<Sum>(detail::readWeight(weights++)) * input[j];
+        }
+
+        // Round to nearest, saturate to 16 bits and apply the activation function.
+        sum = (sum + half) >> layer.shift;
+        const int16_t value{static_cast<int16_t>(INT16_MAX < sum ? INT16_MAX 
+                                               : INT16_MIN > sum ? INT16_MIN : sum)};
+        output[i] = activate(layer.activation, value);
+    }
+}
+} // namespace nn
+} // namespace ml
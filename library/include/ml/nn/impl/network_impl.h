@@ -0,0 +1,121 @@
+/**
+ * @brief Implementation details of the fixed-point dense neural network inference engine.
+ * 
+ * @note Don't include this header, use <network.h> instead!
+ */
+#pragma once
+
+#include <stdint.h>
+
+namespace ml
+{
+namespace nn
+{
+// -----------------------------------------------------------------------------
+template <typename Weight, uint8_t LayerCount, uint8_t MaxWidth>
+Network<Weight, LayerCount, MaxWidth>::Network(const Dense<Weight> (&layers)[LayerCount], 
+                                               const uint16_t inputOffset, 
+                                               const uint16_t inputScale, 
+                                               const uint8_t outputFracBits) noexcept
+    : myLayers{}
+    , myBuffers{}
+    , myInputOffset{inputOffset}
+    , myInputScale{inputScale}
+    , myOutputFracBits{outputFracBits}
+    , myValid{false}
+{
+    for (uint8_t i{}; i < LayerCount; ++i) { myLayers[i] = layers[i]; }
+    myValid = isValid();
+}
+
+// -----------------------------------------------------------------------------
+template <typename Weight, uint8_t LayerCount, uint8_t MaxWidth>
+bool Network<Weight, LayerCount, MaxWidth>::isTrained() const noexcept { return myValid; }
+
+// -----------------------------------------------------------------------------
+template <typename Weight, uint8_t LayerCount, uint8_t MaxWidth>
+uint8_t Network<Weight, LayerCount, MaxWidth>::inputCount() const noexcept
+{
+    return myValid ? myLayers[0U].inputCount : 0U;
+}
+
+// -----------------------------------------------------------------------------
+template <typename Weight, uint8_t LayerCount, uint8_t MaxWidth>
+uint8_t Network<Weight, LayerCount, MaxWidth>::outputCount() const noexcept
+{
+    return myValid ? myLayers[LayerCount - 1U].outputCount : 0U;
+}
+
+// -----------------------------------------------------------------------------
+template <typename Weight, uint8_t LayerCount, uint8_t MaxWidth>
+bool Network<Weight, LayerCount, MaxWidth>::infer(const int16_t* input, 
+                                                  int16_t* output) const noexcept
+{
+    // Check the parameters, return false if invalid.
+    if (!myValid || (nullptr == input) || (nullptr == output)) { return false; }
+
+    // Run the network and copy the outputs from the last buffer written.
+    const int16_t* result{run(input)};
+    for (uint8_t i{}; i < outputCount(); ++i) { output[i] = result[i]; }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename Weight, uint8_t LayerCount, uint8_t MaxWidth>
+int16_t Network<Weight, LayerCount, MaxWidth>::predict(const uint16_t adcValue) const noexcept
+{
+    if (!myValid || (1U != inputCount()) || (1U != outputCount())) { return 0; }
+
+    // Normalize the ADC value, the difference is limited so that the product fits in 32 bits.
+    const int32_t difference{static_cast<int32_t>(adcValue) - myInputOffset};
+    const int32_t limited{INT16_MAX < difference ? INT16_MAX 
+                        : -INT16_MAX > difference ? -INT16_MAX : difference};
+    const int32_t scaled{(limited * myInputScale) >> (24U - ActivationFracBits)};
+    const int16_t input{static_cast<int16_t>(INT16_MAX < scaled ? INT16_MAX 
+                                           : INT16_MIN > scaled ? INT16_MIN : scaled)};
+    const int32_t output{*run(&input)};
+
+    // Round half away from zero, like utils::round(), by shifting the absolute value.
+    if (0U == myOutputFracBits) { return static_cast<int16_t>(output); }
+    const int32_t half{static_cast<int32_t>(1L << (myOutputFracBits - 1U))};
+    return static_cast<int16_t>(0 <= output ? (output + half) >> myOutputFracBits 
+                                            : -((half - output) >> myOutputFracBits));
+}
+
+// -----------------------------------------------------------------------------
+template <typename Weight, uint8_t LayerCount, uint8_t MaxWidth>
+bool Network<Weight, LayerCount, MaxWidth>::isValid() const noexcept
+{
+    if (16U <= myOutputFracBits) { return false; }
+
+    // Check that each layer is set, fits in the buffers and matches the previous layer.
+    for (uint8_t i{}; i < LayerCount; ++i)
+    {
+        const Dense<Weight>& layer{myLayers[i]};
+        if ((nullptr == layer.weights) || (nullptr == layer.biases) || 
+            (0U == layer.inputCount) || (MaxWidth < layer.inputCount) || 
+            (0U == layer.outputCount) || (MaxWidth < layer.outputCount) ||
+            ((0U < i) && (myLayers[i - 1U].outputCount != layer.inputCount)))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <typename Weight, uint8_t LayerCount, uint8_t MaxWidth>
+const int16_t* Network<Weight, LayerCount, MaxWidth>::run(const int16_t* input) const noexcept
+{
+    // Alternate between the buffers, so that the inputs of each layer are the outputs of the
+    // previous layer.
+    for (uint8_t i{}; i < LayerCount; ++i)
+    {
+        int16_t* output{myBuffers[i & 1U]};
+        forward(myLayers[i], input, output);
+        input = output;
+    }
+    return input;
+}
+} // namespace nn
+} // namespace ml
@@ -0,0 +1,144 @@
+/**
+ * @brief Fixed-point dense neural network inference engine.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "ml/lin_reg/quantized.h"
+#include "ml/nn/dense.h"
+#include "utils/type_traits.h"
+
+namespace ml
+{
+namespace nn
+{
+/**
+ * @brief Fixed-point dense neural network inference engine.
+ * 
+ *        The network is a chain of dense layers with weights stored in program memory, 
+ *        for instance a 1-8-1 multilayer perceptron trained and quantized on the host, see 
+ *        host::nn::Mlp. Activations are propagated as 16-bit Q12 values between two fixed 
+ *        buffers of MaxWidth values, so inference performs no dynamic allocation and uses
+ *        4 * MaxWidth bytes of RAM. Since the buffers are members, inference isn't reentrant.
+ * 
+ *        When used as a quantized regression model, the ADC value is normalized to the 
+ *        input x = (ADC value - input offset) * input scale, where the input scale is a Q24
+ *        number, and the network output is interpreted as a fixed-point number with the 
+ *        given number of fractional bits.
+ * 
+ *        This class is non-copyable and non-movable.
+ * 
+ * @tparam Weight The weight type, int8_t or int16_t.
+ * @tparam LayerCount The number of layers. Must be greater than 0.
+ * @tparam MaxWidth The max number of inputs or outputs of any layer. Must be greater than 0.
+ */
+template <typename Weight, uint8_t LayerCount, uint8_t MaxWidth>
+class Network final : public lin_reg::QuantizedInterface
+{
+    // Generate compiler errors if the parameters are invalid.
+    static_assert(type_traits::is_same<Weight, int8_t>::value || 
+                  type_traits::is_same<Weight, int16_t>::value, 
+                  "Only 8-bit and 16-bit weights are supported!");
+    static_assert(0U < LayerCount, "The network requires at least one layer!");
+    static_assert(0U < MaxWidth, "The network requires at least one input!");
+
+public:
+    /**
+     * @brief Create network of given layers.
+     * 
+     *        The network is valid if the outputs of each layer match the inputs of the next
+     *        layer, if no layer is wider than MaxWidth and if all weights and biases are set.
+     * 
+     * @param[in] layers The layers of the network, from input to output. The layer 
+     *                   descriptors are copied, while the weights and biases are referenced.
+     * @param[in] inputOffset ADC value corresponding to input 0 (default = 0).
+     * @param[in] inputScale Input per ADC value in Q24 format (default = 2^14, which maps
+     *                       the range of a 10-bit ADC to [0, 1)).
+     * @param[in] outputFracBits The number of fractional bits of the network output 
+     *                           (default = 8). Must be less than 16.
+     */
+    explicit Network(const Dense<Weight> (&layers)[LayerCount], uint16_t inputOffset = 0U, 
+                     uint16_t inputScale = 1U << 14U, 
+                     uint8_t outputFracBits = ActivationFracBits) noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~Network() noexcept override = default;
+
+    /**
+     * @brief Check whether the network is valid and can be used for inference.
+     * 
+     * @return True if the network is valid, false otherwise.
+     */
+    bool isTrained() const noexcept override;
+
+    /**
+     * @brief Get the number of network inputs.
+     * 
+     * @return The number of inputs, or 0 if the network is invalid.
+     */
+    uint8_t inputCount() const noexcept;
+
+    /**
+     * @brief Get the number of network outputs.
+     * 
+     * @return The number of outputs, or 0 if the network is invalid.
+     */
+    uint8_t outputCount() const noexcept;
+
+    /**
+     * @brief Run inference on given inputs.
+     * 
+     * @param[in] input The inputs in Q12 format, inputCount() values.
+     * @param[out] output Buffer for storing the outputs, outputCount() values with the 
+     *                    number of fractional bits given at construction.
+     * 
+     * @return True on success, false if the network is invalid.
+     */
+    bool infer(const int16_t* input, int16_t* output) const noexcept;
+
+    /**
+     * @brief Predict based on given ADC value.
+     * 
+     *        The network must have a single input and a single output.
+     * 
+     * @param[in] adcValue The raw ADC value for which to predict.
+     * 
+     * @return The network output rounded to the nearest integer, or 0 if the network is 
+     *         invalid or doesn't have a single input and output.
+     */
+    int16_t predict(uint16_t adcValue) const noexcept override;
+
+    Network(const Network&)            = delete; // No copy constructor.
+    Network(Network&&)                 = delete; // No move constructor.
+    Network& operator=(const Network&) = delete; // No copy assignment.
+    Network& operator=(Network&&)      = delete; // No move assignment.
+
+private:
+    bool isValid() const noexcept;
+    const int16_t* run(const int16_t* input) const noexcept;
+
+    /** Layer descriptors, from input to output. */
+    Dense<Weight> myLayers[LayerCount];
+
+    /** Ping-pong buffers holding the activations between layers. */
+    mutable int16_t myBuffers[2U][MaxWidth];
+
+    /** ADC value corresponding to input 0. */
+    uint16_t myInputOffset;
+
+    /** Input per ADC value in Q24 format. */
+    uint16_t myInputScale;
+
+    /** The number of fractional bits of the network output. */
+    uint8_t myOutputFracBits;
+
+    /** Indicate whether the network is valid. */
+    bool myValid;
+};
+} // namespace nn
+} // namespace ml
+
+#include "impl/network_impl.h"
@@ -0,0 +1,187 @@
+/**
+ * @brief Polynomial regression implementation.
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "ml/lin_reg/interface.h"
+#include "ml/types.h"
+
+namespace ml
+{
+namespace poly_reg
+{
+/**
+ * @brief Polynomial regression implementation.
+ * 
+ *        The model predicts y = c0 + c1 * t + c2 * t^2 + ... + cN * t^N, which fits nonlinear 
+ *        sensors such as thermistors. The polynomial is evaluated with Horner's method, so 
+ *        each prediction costs N multiply-adds and no powers are computed.
+ * 
+ *        Trained models normalize the input to t = (x - offset) * scale, which maps the 
+ *        training inputs onto [-1, 1] and keeps the least squares fit well conditioned even 
+ *        with single-precision floating-point numbers. Pre-trained models use t = x.
+ * 
+ *        The model implements the linear regression interface, so it can be used in place of 
+ *        a linear model, for instance by driver::tempsensor::Smart or ml::lin_reg::storage.
+ * 
+ *        This class is non-copyable and non-movable.
+ * 
+ * @tparam Degree The degree of the polynomial. Must be between 1 and 8.
+ */
+template <uint8_t Degree>
+class Fixed final : public lin_reg::Interface
+{
+    // Generate a compiler error if the degree is invalid.
+    static_assert((0U < Degree) && (8U >= Degree), "Invalid polynomial degree!");
+
+public:
+    /** The number of coefficients, one per power of the input. */
+    static constexpr uint8_t CoefficientCount{Degree + 1U};
+
+    /**
+     * @brief Create untrained model.
+     */
+    Fixed() noexcept;
+
+    /**
+     * @brief Create a pre-trained model.
+     * 
+     * @param[in] coefficients The coefficients in ascending order of powers, starting with 
+     *                         the constant term.
+     */
+    explicit Fixed(const double (&coefficients)[CoefficientCount]) noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~Fixed() noexcept override = default;
+
+    /**
+     * @brief Get the degree of the polynomial.
+     * 
+     * @return The degree of the polynomial.
+     */
+    static constexpr uint8_t degree() noexcept { return Degree; }
+
+    /**
+     * @brief Check whether the model is trained.
+     * 
+     * @return True if the model is trained, false otherwise.
+     */
+    bool isTrained() const noexcept override;
+
+    /**
+     * @brief Predict based on given input.
+     * 
+     * @param[in] input Input for which to predict.
+     * 
+     * @return The predicted value, or 0 if the model is untrained.
+     */
+    double predict(double input) const noexcept override;
+
+    /**
+     * @brief Predict based on many inputs at once.
+     * 
+     *        All predictions are computed with the vectorized kernel batch::polynomial().
+     * 
+     * @param[in] input The inputs for which to predict.
+     * @param[out] output Buffer for storing the predicted values, one per input. May be 
+     *                    the input.
+     * @param[in] count The number of inputs.
+     * 
+     * @return True on success, false if the input or output is null while count isn't 0.
+     */
+    bool predictBatch(const double* input, double* output, size_t count) const noexcept override;
+
+    /**
+     * @brief Get the size of the serialized model parameters.
+     * 
+     * @return The size of the serialized coefficients and input normalization in bytes.
+     */
+    uint8_t serializedSize() const noexcept override;
+
+    /**
+     * @brief Serialize the coefficients and the input normalization of the model.
+     * 
+     * @param[out] data Buffer for storing the serialized parameters.
+     * @param[in] size The size of the buffer in bytes. Must be at least serializedSize().
+     * 
+     * @return True on success, false if the model isn't trained or if the buffer is too small.
+     */
+    bool serialize(uint8_t* data, uint8_t size) const noexcept override;
+
+    /**
+     * @brief Deserialize the coefficients and the input normalization of the model. The 
+     *        model is trained afterwards.
+     * 
+     * @param[in] data The serialized parameters.
+     * @param[in] size The size of the serialized parameters in bytes. Must match 
+     *                 serializedSize().
+     * 
+     * @return True on success, false if the size doesn't match.
+     */
+    bool deserialize(const uint8_t* data, uint8_t size) noexcept override;
+
+    /**
+     * @brief Train the model with closed-form least squares.
+     * 
+     *        The normal equations of the normalized inputs are accumulated in a single pass 
+     *        over the training sets and solved with Gaussian elimination, see ml::solve().
+     * 
+     * @param[in] trainIn Training data input values.
+     * @param[in] trainOut Training data output values.
+     * 
+     * @return True on success, false if fewer than Degree + 1 distinct input values are 
+     *         present, in which case the model isn't changed.
+     */
+    bool train(const Matrix1d& trainIn, const Matrix2d& trainOut) noexcept;
+
+    /**
+     * @brief Get the coefficients of the model for a linearly transformed input.
+     * 
+     *        The coefficients c' are computed such that sum(c'k * u^k) predicts the same as 
+     *        predict(scale * u + offset). The default arguments give the coefficients in 
+     *        terms of the input itself, while for instance a scale equal to the supply 
+     *        voltage gives the coefficients in terms of the ADC value divided by its max value.
+     * 
+     * @param[out] coefficients Array for storing the coefficients in ascending order of 
+     *                          powers.
+     * @param[in] scale The scale of the transformed input (default = 1.0).
+     * @param[in] offset The offset of the transformed input (default = 0.0).
+     * 
+     * @return True on success, false if the model isn't trained.
+     */
+    bool coefficients(double (&coefficients)[CoefficientCount], double scale = 1.0, 
+                      double offset = 0.0) const noexcept;
+
+    Fixed(const Fixed&)            = delete; // No copy constructor.
+    Fixed(Fixed&&)                 = delete; // No move constructor.
+    Fixed& operator=(const Fixed&) = delete; // No copy assignment.
+    Fixed& operator=(Fixed&&)      = delete; // No move assignment.
+
+private:
+    /** The number of serialized parameters: the coefficients, the offset and the scale. */
+    static constexpr uint8_t SerializedCount{CoefficientCount + 2U};
+
+    /** The size of the serialized parameters in bytes. */
+    static constexpr uint8_t SerializedSize{SerializedCount * sizeof(double)};
+
+    /** Model coefficients of the normalized input in ascending order of powers. */
+    double myCoefficients[CoefficientCount];
+
+    /** Offset subtracted from the input before scaling. */
+    double myInputOffset;
+
+    /** Scale applied to the input after subtracting the offset. */
+    double myInputScale;
+
+    /** Indicate whether the model is trained. */
+    bool myTrained;
+};
+} // namespace poly_reg
+} // namespace ml
+
+#include "impl/fixed_impl.h"
@@ -0,0 +1,173 @@
+/**
+ * @brief Implementation details of polynomial regression.
+ * 
+ * @note Don't include this header, use <fixed.h> instead!
+ */
+#pragma once
+
+#include <string.h>
+
+#include "ml/batch.h"
+#include "ml/matrix.h"
+
+namespace ml
+{
+namespace poly_reg
+{
+// -----------------------------------------------------------------------------
+template <uint8_t Degree>
+Fixed<Degree>::Fixed() noexcept
+    : myCoefficients{}
+    , myInputOffset{0.0}
+    , myInputScale{1.0}
+    , myTrained{false}
+{}
+
+// -----------------------------------------------------------------------------
+template <uint8_t Degree>
+Fixed<Degree>::Fixed(const double (&coefficients)[CoefficientCount]) noexcept
+    : myCoefficients{}
+    , myInputOffset{0.0}
+    , myInputScale{1.0}
+    , myTrained{true}
+{
+    for (uint8_t i{}; i < CoefficientCount; ++i) { myCoefficients[i] = coefficients[i]; }
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t Degree>
+bool Fixed<Degree>::isTrained() const noexcept { return myTrained; }
+
+// -----------------------------------------------------------------------------
+template <uint8_t Degree>
+double Fixed<Degree>::predict(const double input) const noexcept
+{
+    // Evaluate the polynomial with Horner's method, starting with the highest power.
+    const double normalized{(input - myInputOffset) * myInputScale};
+    double prediction{myCoefficients[Degree]};
+    for (uint8_t i{Degree}; 0U < i--;) { prediction = prediction * normalized + myCoefficients[i]; }
+    return prediction;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t Degree>
+bool Fixed<Degree>::predictBatch(const double* input, double* output, 
+                                 const size_t count) const noexcept
+{
+    return batch::polynomial(input, output, count, myCoefficients, Degree, myInputOffset, 
+                             myInputScale);
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t Degree>
+uint8_t Fixed<Degree>::serializedSize() const noexcept { return SerializedSize; }
+
+// -----------------------------------------------------------------------------
+template <uint8_t Degree>
+bool Fixed<Degree>::serialize(uint8_t* data, const uint8_t size) const noexcept
+{
+    // Check the parameters, return false if invalid or if the model isn't trained.
+    if ((nullptr == data) || (SerializedSize > size) || !myTrained) { return false; }
+
+    // Copy the coefficients followed by the input normalization in the native format.
+    memcpy(data, myCoefficients, sizeof(myCoefficients));
+    memcpy(data + sizeof(myCoefficients), &myInputOffset, sizeof(myInputOffset));
+    memcpy(data + sizeof(myCoefficients) + sizeof(myInputOffset), &myInputScale, 
+           sizeof(myInputScale));
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t Degree>
+bool Fixed<Degree>::deserialize(const uint8_t* data, const uint8_t size) noexcept
+{
+    // Check the parameters, return false if invalid.
+    if ((nullptr == data) || (SerializedSize != size)) { return false; }
+
+    // Restore the coefficients and the input normalization, the model is trained afterwards.
+    memcpy(myCoefficients, data, sizeof(myCoefficients));
+    memcpy(&myInputOffset, data + sizeof(myCoefficients), sizeof(myInputOffset));
+    memcpy(&myInputScale, data + sizeof(myCoefficients) + sizeof(myInputOffset), 
+           sizeof(myInputScale));
+    myTrained = true;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t Degree>
+bool Fixed<Degree>::train(const Matrix1d& trainIn, const Matrix2d& trainOut) noexcept
+{
+    // Check the training set count, return false if invalid.
+    const size_t setCount{trainIn.size() < trainOut.size() ? trainIn.size() : trainOut.size()};
+    if (CoefficientCount > setCount) { return false; }
+
+    // Map the input range onto [-1, 1], return false if all inputs are equal.
+    double minInput{trainIn[0U]};
+    double maxInput{trainIn[0U]};
+    for (size_t i{1U}; i < setCount; ++i)
+    {
+        minInput = trainIn[i] < minInput ? trainIn[i] : minInput;
+        maxInput = trainIn[i] > maxInput ? trainIn[i] : maxInput;
+    }
+    if (minInput >= maxInput) { return false; }
+    const double inputOffset{0.5 * (minInput + maxInput)};
+    const double inputScale{2.0 / (maxInput - minInput)};
+
+    // Accumulate V^T * V and V^T * y, where each row of V holds the powers of an input.
+    Matrix<double, CoefficientCount, CoefficientCount> normal{};
+    double moment[CoefficientCount]{};
+    double powers[CoefficientCount]{};
+    const VectorView<const double> powerView{powers, CoefficientCount};
+
+    for (size_t set{}; set < setCount; ++set)
+    {
+        const double normalized{(trainIn[set] - inputOffset) * inputScale};
+        powers[0U] = 1.0;
+        for (uint8_t i{1U}; i < CoefficientCount; ++i) { powers[i] = powers[i - 1U] * normalized; }
+
+        for (uint8_t i{}; i < CoefficientCount; ++i)
+        {
+            axpy(powers[i], powerView, normal.row(i));
+            moment[i] += powers[i] * trainOut[set];
+        }
+    }
+
+    // Solve for the coefficients, return false if too few distinct inputs are present.
+    double coefficients[CoefficientCount]{};
+    if (!solve(normal, moment, coefficients)) { return false; }
+
+    for (uint8_t i{}; i < CoefficientCount; ++i) { myCoefficients[i] = coefficients[i]; }
+    myInputOffset = inputOffset;
+    myInputScale  = inputScale;
+    myTrained     = true;
+    return myTrained;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t Degree>
+bool Fixed<Degree>::coefficients(double (&coefficients)[CoefficientCount], const double scale, 
+                                 const double offset) const noexcept
+{
+    if (!myTrained) { return false; }
+
+    // The normalized input is linear in the transformed input, t = a * u + b.
+    const double a{scale * myInputScale};
+    const double b{(offset - myInputOffset) * myInputScale};
+
+    // Expand the polynomial with Horner's method, multiplying the partial result by 
+    // (a * u + b) before adding the next coefficient.
+    for (uint8_t i{}; i < CoefficientCount; ++i) { coefficients[i] = 0.0; }
+    coefficients[0U] = myCoefficients[Degree];
+
+    for (uint8_t k{Degree}; 0U < k--;)
+    {
+        for (uint8_t i{static_cast<uint8_t>(Degree - k)}; 0U < i; --i)
+        {
+            coefficients[i] = coefficients[i] * b + coefficients[i - 1U] * a;
+        }
+        coefficients[0U] = coefficients[0U] * b + myCoefficients[k];
+    }
+    return true;
+}
+} // namespace poly_reg
+} // namespace ml
@@ -0,0 +1,105 @@
+/**
+ * @brief Implementation details of quantized polynomial regression.
+ * 
+ * @note Don't include this header, use <quantized.h> instead!
+ */
+#pragma once
+
+#include <math.h>
+#include <stdint.h>
+
+#include "utils/utils.h"
+
+namespace ml
+{
+namespace poly_reg
+{
+// -----------------------------------------------------------------------------
+template <uint8_t Degree, uint8_t FracBits>
+Quantized<Degree, FracBits>::Quantized() noexcept
+    : myCoefficients{}
+    , myInputScale{}
+    , myMaxValue{}
+    , myTrained{false}
+{}
+
+// -----------------------------------------------------------------------------
+template <uint8_t Degree, uint8_t FracBits>
+bool Quantized<Degree, FracBits>::isTrained() const noexcept { return myTrained; }
+
+// -----------------------------------------------------------------------------
+template <uint8_t Degree, uint8_t FracBits>
+int16_t Quantized<Degree, FracBits>::predict(const uint16_t adcValue) const noexcept
+{
+    if (!myTrained) { return 0; }
+    const int32_t scaled{evaluate(adcValue)};
+
+    // Round half away from zero, like utils::round(), by shifting the absolute value.
+    return static_cast<int16_t>(0 <= scaled ? (scaled + Half) >> FracBits 
+                                            : -((Half - scaled) >> FracBits));
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t Degree, uint8_t FracBits>
+bool Quantized<Degree, FracBits>::quantize(const Fixed<Degree>& model, const uint16_t maxValue, 
+                                           const double supplyVoltage, double& maxError) noexcept
+{
+    // Check the parameters, return false if invalid.
+    if (!model.isTrained() || (0U == maxValue) || (0.0 >= supplyVoltage)) { return false; }
+
+    // Express the polynomial in terms of the ADC value divided by its max value.
+    double coefficients[Degree + 1U]{};
+    if (!model.coefficients(coefficients, supplyVoltage)) { return false; }
+
+    // The fraction is in [0, 1], so the sum of the absolute coefficients bounds both the 
+    // predictions and the partial results of Horner's method.
+    double bound{};
+    for (const auto& coefficient : coefficients) { bound += fabs(coefficient); }
+
+    // Return false if the predictions or the intermediate fixed-point values can overflow.
+    if ((INT32_MAX <= (bound + 1.0) * Scale) || (INT16_MAX < bound)) { return false; }
+
+    // Round the coefficients to the nearest fixed-point values.
+    for (uint8_t i{}; i <= Degree; ++i)
+    {
+        myCoefficients[i] = utils::round<int32_t>(coefficients[i] * Scale);
+    }
+    myInputScale = static_cast<uint32_t>(((1ULL << (InputFracBits + 16U)) + maxValue / 2U) / 
+                                         maxValue);
+    myMaxValue   = maxValue;
+    myTrained    = true;
+
+    // Compare with the model at every ADC value, since the error isn't linear in the input.
+    maxError = 0.0;
+    for (uint32_t adcValue{}; adcValue <= maxValue; ++adcValue)
+    {
+        const double input{static_cast<double>(adcValue) * supplyVoltage / maxValue};
+        const double quantized{static_cast<double>(evaluate(static_cast<uint16_t>(adcValue))) / 
+                               Scale};
+        const double error{fabs(quantized - model.predict(input))};
+        maxError = error > maxError ? error : maxError;
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+template <uint8_t Degree, uint8_t FracBits>
+int32_t Quantized<Degree, FracBits>::evaluate(const uint16_t adcValue) const noexcept
+{
+    // Saturate the ADC value, since the fixed-point range is only verified up to the max value.
+    const uint32_t input{myMaxValue < adcValue ? myMaxValue : adcValue};
+
+    // Compute the fraction of the max value in Q15, rounded to nearest.
+    const int32_t fraction{static_cast<int32_t>((input * myInputScale + 0x8000UL) >> 16U)};
+
+    // Evaluate the polynomial with Horner's method, starting with the highest power.
+    int32_t result{myCoefficients[Degree]};
+    for (uint8_t i{Degree}; 0U < i--;)
+    {
+        result = static_cast<int32_t>((static_cast<int64_t>(result) * fraction) >> InputFracBits) 
+                 + myCoefficients[i];
+    }
+    return result;
+}
+} // namespace poly_reg
+} // namespace ml
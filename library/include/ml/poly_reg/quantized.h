@@ -0,0 +1,115 @@
+/**
+ * @brief Quantized polynomial regression implementation.
+ */
+#pragma once
+
+#include <stdint.h>
+
+#include "ml/lin_reg/quantized.h"
+#include "ml/poly_reg/fixed.h"
+
+namespace ml
+{
+namespace poly_reg
+{
+/**
+ * @brief Quantized polynomial regression implementation.
+ * 
+ *        The coefficients are stored as signed fixed-point numbers in Q format with the given 
+ *        number of fractional bits, expressed in terms of the ADC value divided by its max 
+ *        value. This ratio is computed with a single 32-bit multiplication and lies in 
+ *        [0, 1], so each Horner step is a 32x16-bit multiplication, a shift and an addition 
+ *        and no floating-point math is performed per prediction.
+ * 
+ *        This class is non-copyable and non-movable.
+ * 
+ * @tparam Degree The degree of the polynomial. Must be between 1 and 8.
+ * @tparam FracBits The number of fractional bits of the coefficients (default = 16). 
+ *                  Must be between 1 and 24.
+ */
+template <uint8_t Degree, uint8_t FracBits = 16U>
+class Quantized final : public lin_reg::QuantizedInterface
+{
+    // Generate compiler errors if the parameters are invalid.
+    static_assert((0U < Degree) && (8U >= Degree), "Invalid polynomial degree!");
+    static_assert((0U < FracBits) && (24U >= FracBits), "Invalid number of fractional bits!");
+
+public:
+    /**
+     * @brief Create untrained model.
+     */
+    Quantized() noexcept;
+
+    /**
+     * @brief Destructor.
+     */
+    ~Quantized() noexcept override = default;
+
+    /**
+     * @brief Check whether the model is trained.
+     * 
+     * @return True if the model is trained, false otherwise.
+     */
+    bool isTrained() const noexcept override;
+
+    /**
+     * @brief Predict based on given ADC value.
+     * 
+     *        ADC values above the max value given at quantization are saturated.
+     * 
+     * @param[in] adcValue The raw ADC value for which to predict.
+     * 
+     * @return The predicted value rounded to the nearest integer, or 0 if the model is 
+     *         untrained.
+     */
+    int16_t predict(uint16_t adcValue) const noexcept override;
+
+    /**
+     * @brief Quantize a trained model predicting based on the input voltage of an ADC.
+     * 
+     * @param[in] model The trained model to quantize.
+     * @param[in] maxValue The max value of the ADC. Must be greater than 0.
+     * @param[in] supplyVoltage The supply voltage of the ADC in Volts. Must be greater than 0.
+     * @param[out] maxError Reference to variable for storing the max absolute error of the
+     *                      quantized model, evaluated at every ADC value and excluding the 
+     *                      rounding of predictions to the nearest integer.
+     * 
+     * @return True on success, false if the model isn't trained, if the parameters are 
+     *         invalid or if the predictions don't fit in the fixed-point format.
+     */
+    bool quantize(const Fixed<Degree>& model, uint16_t maxValue, double supplyVoltage, 
+                  double& maxError) noexcept;
+
+    Quantized(const Quantized&)            = delete; // No copy constructor.
+    Quantized(Quantized&&)                 = delete; // No move constructor.
+    Quantized& operator=(const Quantized&) = delete; // No copy assignment.
+    Quantized& operator=(Quantized&&)      = delete; // No move assignment.
+
+private:
+    int32_t evaluate(uint16_t adcValue) const noexcept;
+
+    /** Scale factor of the fixed-point format. */
+    static constexpr int32_t Scale{static_cast<int32_t>(1UL << FracBits)};
+
+    /** Half of the fixed-point scale, used for rounding. */
+    static constexpr int32_t Half{Scale / 2};
+
+    /** The number of fractional bits of the ADC value divided by its max value. */
+    static constexpr uint8_t InputFracBits{15U};
+
+    /** Model coefficients in fixed-point format in ascending order of powers. */
+    int32_t myCoefficients[Degree + 1U];
+
+    /** Factor converting ADC values to fractions of the max value in Q15, scaled by 2^16. */
+    uint32_t myInputScale;
+
+    /** Max ADC value. */
+    uint16_t myMaxValue;
+
+    /** Indicate whether the model is trained. */
+    bool myTrained;
+};
+} // namespace poly_reg
+} // namespace ml
+
+#include "impl/quantized_impl.h"
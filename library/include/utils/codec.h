@@ -0,0 +1,135 @@
+/**
+ * @brief Contains byte-level encoding utilities for binary serial communication, such as
+ *        checksums (CRC16), byte stuffing (COBS) and variable length integers (varints).
+ */
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace utils
+{
+namespace crc
+{
+/** Initial value of the CRC16 checksum. */
+constexpr uint16_t Crc16Init{0xFFFFU};
+
+/**
+ * @brief Calculate the CRC16 checksum (CRC-16/CCITT-FALSE, polynomial 0x1021) of given data.
+ *
+ *        The checksum can be calculated in several steps by passing the result of the previous
+ *        calculation as the initial value of the next.
+ *
+ * @param[in] data Pointer to the data to calculate the checksum of.
+ * @param[in] size The size of the data in bytes.
+ * @param[in] crc Initial value of the checksum (default = 0xFFFF).
+ *
+ * @return The calculated checksum.
+ */
+uint16_t crc16(const uint8_t* data, size_t size, uint16_t crc = Crc16Init) noexcept;
+
+} // namespace crc
+
+namespace cobs
+{
+/** Frame delimiter, never present in COBS encoded data. */
+constexpr uint8_t Delimiter{0x00U};
+
+/**
+ * @brief Get the maximum size of COBS encoded data.
+ *
+ * @param[in] size The size of the data to encode in bytes.
+ *
+ * @return The maximum size of the encoded data in bytes, excluding the frame delimiter.
+ */
+constexpr size_t maxEncodedSize(const size_t size) noexcept { return size + size / 254U + 1U; }
+
+/**
+ * @brief Encode data with COBS (Consistent Overhead Byte Stuffing).
+ *
+ *        The encoded data contains no zero bytes, which enables the receiver to use zero bytes
+ *        as frame delimiters and resynchronize after dropped bytes. The delimiter itself is
+ *        not appended.
+ *
+ * @param[in] source Pointer to the data to encode.
+ * @param[in] size The size of the data to encode in bytes.
+ * @param[out] destination Pointer to the destination buffer.
+ * @param[in] destinationSize The size of the destination buffer in bytes.
+ *
+ * @return The size of the encoded data in bytes, or 0 on failure.
+ */
+size_t encode(const uint8_t* source, size_t size, uint8_t* destination,
+              size_t destinationSize) noexcept;
+
+/**
+ * @brief Decode COBS encoded data.
+ *
+ *        The data to decode shall not contain the frame delimiter.
+ *
+ * @param[in] source Pointer to the data to decode.
+ * @param[in] size The size of the data to decode in bytes.
+ * @param[out] destination Pointer to the destination buffer.
+ * @param[in] destinationSize The size of the destination buffer in bytes.
+ *
+ * @return The size of the decoded data in bytes, or 0 on failure.
+ */
+size_t decode(const uint8_t* source, size_t size, uint8_t* destination,
+              size_t destinationSize) noexcept;
+
+} // namespace cobs
+
+namespace varint
+{
+/** Maximum size of a 32-bit varint in bytes. */
+constexpr uint8_t MaxSize{5U};
+
+/**
+ * @brief Map a signed integer to an unsigned integer (zigzag encoding), so that values of
+ *        small magnitude result in short varints regardless of the sign.
+ *
+ * @param[in] value The value to map.
+ *
+ * @return The corresponding unsigned value.
+ */
+constexpr uint32_t zigzag(const int32_t value) noexcept
+{
+    return (static_cast<uint32_t>(value) << 1U) ^ static_cast<uint32_t>(value >> 31U);
+}
+
+/**
+ * @brief Map a zigzag encoded unsigned integer back to the original signed integer.
+ *
+ * @param[in] value The value to map.
+ *
+ * @return The corresponding signed value.
+ */
+constexpr int32_t unzigzag(const uint32_t value) noexcept
+{
+    return static_cast<int32_t>((value >> 1U) ^ (~(value & 1U) + 1U));
+}
+
+/**
+ * @brief Encode an unsigned integer as a varint (seven bits per byte, least significant
+ *        group first, most significant bit set on all bytes but the last).
+ *
+ * @param[in] value The value to encode.
+ * @param[out] destination Pointer to the destination buffer.
+ * @param[in] destinationSize The size of the destination buffer in bytes.
+ *
+ * @return The size of the encoded value in bytes, or 0 on failure.
+ */
+uint8_t encode(uint32_t value, uint8_t* destination, size_t destinationSize) noexcept;
+
+/**
+ * @brief Decode a varint to an unsigned integer.
+ *
+ * @param[in] source Pointer to the data to decode.
+ * @param[in] size The size of the data to decode in bytes.
+ * @param[out] value Reference to variable for storing the decoded value.
+ *
+ * @return The number of bytes consumed, or 0 on failure.
+ */
+uint8_t decode(const uint8_t* source, size_t size, uint32_t& value) noexcept;
+
+} // namespace varint
+} // namespace utils
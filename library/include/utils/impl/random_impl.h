@@ -0,0 +1,30 @@
+/**
+ * @brief Implementation details of the pseudo-random number generator.
+ * 
+ * @note Don't include this header, use <random.h> instead!
+ */
+#pragma once
+
+namespace utils
+{
+// -----------------------------------------------------------------------------
+constexpr Random::Random(const uint32_t seed) noexcept
+    : myState{0U != seed ? seed : 1U}
+{}
+
+// -----------------------------------------------------------------------------
+constexpr uint32_t Random::next() noexcept
+{
+    // Apply Marsaglia's xorshift32 with shift triple (13, 17, 5), which has full period.
+    myState ^= myState << 13U;
+    myState ^= myState >> 17U;
+    myState ^= myState << 5U;
+    return myState;
+}
+
+// -----------------------------------------------------------------------------
+constexpr uint32_t Random::below(const uint32_t bound) noexcept
+{
+    return 0U < bound ? next() % bound : 0U;
+}
+} // namespace utils
@@ -0,0 +1,65 @@
+/**
+ * @brief Small pseudo-random number generator.
+ */
+#pragma once
+
+#include <stdint.h>
+
+namespace utils
+{
+/**
+ * @brief Xorshift pseudo-random number generator (32-bit state).
+ * 
+ *        Each number is generated with three shifts and three XOR operations, so no 
+ *        multiplication or lookup table is needed. The sequence is deterministic for a given 
+ *        seed, which makes randomized algorithms reproducible. Not suitable for cryptography.
+ * 
+ *        This class is non-copyable and non-movable.
+ */
+class Random
+{
+public:
+    /**
+     * @brief Create generator.
+     * 
+     * @param[in] seed The initial state. A seed of 0 is replaced by 1, since the generator
+     *                 would otherwise only produce zeros.
+     */
+    explicit constexpr Random(uint32_t seed = 1U) noexcept;
+
+    /**
+     * @brief Delete generator.
+     */
+    ~Random() noexcept = default;
+
+    /**
+     * @brief Generate the next number of the sequence.
+     * 
+     * @return A pseudo-random number in the range [1, 2^32 - 1].
+     */
+    constexpr uint32_t next() noexcept;
+
+    /**
+     * @brief Generate a number less than given bound.
+     * 
+     *        The number is the remainder of next() divided by the bound. The resulting bias 
+     *        is negligible for bounds much smaller than 2^32.
+     * 
+     * @param[in] bound The exclusive upper bound. Must be greater than 0.
+     * 
+     * @return A pseudo-random number in the range [0, bound), or 0 if the bound is 0.
+     */
+    constexpr uint32_t below(uint32_t bound) noexcept;
+
+    Random(const Random&)            = delete; // No copy constructor.
+    Random(Random&&)                 = delete; // No move constructor.
+    Random& operator=(const Random&) = delete; // No copy assignment.
+    Random& operator=(Random&&)      = delete; // No move assignment.
+
+private:
+    /** The current state, never 0. */
+    uint32_t myState;
+};
+} // namespace utils
+
+#include "impl/random_impl.h"
@@ -242,4 +242,39 @@ struct is_reference<T&>
 {
     static const bool value{true};
 };
+
+/**
+ * @brief Check if two types are the same.
+ * 
+ * @tparam T1 The first type to compare.
+ * @tparam T2 The second type to compare.
+ */
+template <typename T1, typename T2>
+struct is_same
+{
+    // True for identical types only.
+    static const bool value{false};
+};
+
+/**
+ * @brief Specialization for identical types.
+ * 
+ * @tparam T The type.
+ */
+template <typename T>
+struct is_same<T, T>
+{
+    static const bool value{true};
+};
+
+/**
+ * @brief Provide given type unchanged, which excludes it from template argument deduction.
+ * 
+ * @tparam T The type.
+ */
+template <typename T>
+struct type_identity
+{
+    typedef T type;
+};
 } // namespace type_traits
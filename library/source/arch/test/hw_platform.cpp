@@ -24,6 +24,70 @@ namespace test
 /** Array representing registers. */
 RegisterMemory<Memory::Size> Memory::data{};
 
+namespace
+{
+/** Sleep mode bits SM[2:0] for idle mode. */
+constexpr std::uint8_t Idle{0U};
+
+/** Sleep mode bits SM[2:0] for ADC noise reduction mode. */
+constexpr std::uint8_t AdcNoiseReduction{1U};
+
+/** Interrupt service routine run when an ADC conversion completes in sleep. */
+InterruptHandler myAdcInterrupt{nullptr};
+
+/** Interrupt service routine run when the EEPROM is ready in sleep. */
+InterruptHandler myEepromInterrupt{nullptr};
+
+/** The number of times the CPU has entered sleep. */
+std::uint32_t mySleepCount{};
+
+// -----------------------------------------------------------------------------
+void sleep() noexcept
+{
+    // Ignore the sleep instruction unless sleep is enabled.
+    if (!READ(SMCR, SE)) { return; }
+    mySleepCount++;
+
+    // Complete the conversion started on entering ADC noise reduction mode.
+    if ((AdcNoiseReduction == ((SMCR >> SM0) & 0x07U)) && READ(ADCSRA, ADEN))
+    {
+        CLR(ADCSRA, ADSC);
+        SET(ADCSRA, ADIF);
+
+        // Wake up via the conversion-complete interrupt, which clears the interrupt flag.
+        if (READ(ADCSRA, ADIE) && READ(SREG, I_FLAG) && (nullptr != myAdcInterrupt))
+        {
+            CLR(ADCSRA, ADIF);
+            myAdcInterrupt();
+        }
+    }
+
+    // Complete ongoing EEPROM programming in idle mode.
+    if (Idle == ((SMCR >> SM0) & 0x07U))
+    {
+        CLR(EECR, EEPE);
+
+        // Wake up via the EEPROM ready interrupt, which is active as long as it's enabled.
+        if (READ(EECR, EERIE) && READ(SREG, I_FLAG) && (nullptr != myEepromInterrupt))
+        {
+            myEepromInterrupt();
+        }
+    }
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+void setAdcInterrupt(const InterruptHandler handler) noexcept { myAdcInterrupt = handler; }
+
+// -----------------------------------------------------------------------------
+void setEepromInterrupt(const InterruptHandler handler) noexcept 
+{ 
+    myEepromInterrupt = handler; 
+}
+
+// -----------------------------------------------------------------------------
+std::uint32_t sleepCount() noexcept { return mySleepCount; }
+
 // -----------------------------------------------------------------------------
 void executeAssemblyCmd(const std::string& cmd) noexcept
 {
@@ -31,6 +95,7 @@ void executeAssemblyCmd(const std::string& cmd) noexcept
     else if ("CLI" == cmd) { CLR(SREG, I_FLAG); }
     // No-op: watchdog counter reset not needed in unit tests.
     else if ("WDR" == cmd) {}
+    else if ("SLEEP" == cmd) { sleep(); }
 }
 
 // -----------------------------------------------------------------------------
@@ -2,7 +2,9 @@
  * @brief ADC driver implementation details for the ATmega328P ADC (A/D converter).
  */
 #include "arch/avr/hw_platform.h"
+#include "container/ring_buffer.h"
 #include "driver/adc/atmega328p.h"
+#include "driver/adc/sequencer.h"
 #include "utils/utils.h"
 
 namespace driver 
@@ -25,10 +27,92 @@ struct AdcParam
     /** Supply voltage in Volts. */
     static constexpr double SupplyVoltage{5.0};
 
+    /** Supply voltage in millivolts. */
+    static constexpr uint16_t SupplyVoltage_mV{5000U};
+
     /** ADC port offset (pin [14:19] == port [A0:A5]). */
     static constexpr uint8_t PortOffset{14U};
+
+    /** Size of the sample buffer used for continuous sampling. */
+    static constexpr size_t SampleBufferSize{32U};
 };
 
+/** Auto trigger source bits (ADTS[2:0]) for each trigger. */
+constexpr uint8_t TriggerSource[static_cast<uint8_t>(Trigger::Count)]{0U, 4U};
+
+/** Sample buffer filled by the conversion-complete interrupt. */
+container::RingBuffer<uint16_t, AdcParam::SampleBufferSize> mySamples{};
+
+/** The number of samples dropped due to a full sample buffer. */
+volatile uint16_t myDroppedSamples{};
+
+/** Indicate whether continuous sampling or scanning is active. */
+volatile bool mySampling{false};
+
+/** Sequencer of the ongoing scan, or nullptr if not scanning. */
+Sequencer* volatile myScan{nullptr};
+
+/** Indicate whether a single non-blocking conversion is ongoing. */
+volatile bool myConverting{false};
+
+/** Indicate whether the result of a single non-blocking conversion is pending. */
+volatile bool myConversionReady{false};
+
+/** Result of the last single non-blocking conversion. */
+volatile uint16_t myConversionResult{};
+
+/** Indicate whether the conversion of a blocking read in noise reduction mode is complete. */
+volatile bool myReadComplete{false};
+
+/** The number of extra bits added by oversampling. */
+uint8_t myOversampling{};
+
+/** Sum of the conversions accumulated by the conversion-complete interrupt. */
+uint32_t myAccumulator{};
+
+/** The number of conversions accumulated by the conversion-complete interrupt. */
+uint16_t myAccumulated{};
+
+// -----------------------------------------------------------------------------
+constexpr uint16_t conversionCount(const uint8_t extraBits) noexcept
+{
+    // Each extra bit requires four times as many conversions.
+    return static_cast<uint16_t>(1U << (2U * extraBits));
+}
+
+// -----------------------------------------------------------------------------
+bool accumulate(const uint16_t value, uint16_t& result) noexcept
+{
+    // Accumulate the conversion, return false until 4^n conversions have been accumulated.
+    myAccumulator += value;
+    if (conversionCount(myOversampling) > ++myAccumulated) { return false; }
+
+    // Decimate the sum by n bits, then start the next accumulation.
+    result        = static_cast<uint16_t>(myAccumulator >> myOversampling);
+    myAccumulator = 0U;
+    myAccumulated = 0U;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+void handleSingleConversion(const uint16_t value) noexcept
+{
+    uint16_t result{};
+
+    // Start the next conversion until 4^n conversions have been accumulated.
+    if (!accumulate(value, result)) 
+    { 
+        utils::set(ADCSRA, ADSC); 
+        return;
+    }
+
+    // Store the result before publishing it, then disable the interrupt.
+    myConversionResult = result;
+    myConversionReady  = true;
+    myConverting       = false;
+    utils::clear(ADCSRA, ADIE);
+}
+
 // -----------------------------------------------------------------------------
 constexpr uint8_t normalizeChannel(const uint8_t channel) noexcept
 {
@@ -36,13 +120,55 @@ constexpr uint8_t normalizeChannel(const uint8_t channel) noexcept
 }
 
 // -----------------------------------------------------------------------------
-uint16_t adcValue(const uint8_t channel) noexcept
+void pollConversion() noexcept
 {
-    ADMUX = (1U << REFS0) | normalizeChannel(channel);
+    // Start the conversion and busy-wait until it's complete.
     utils::set(ADCSRA, ADEN, ADSC, ADPS0, ADPS1, ADPS2);
     while (!utils::read(ADCSRA, ADIF));
     utils::set(ADCSRA, ADIF);
-    return ADC;
+}
+
+// -----------------------------------------------------------------------------
+void sleepConversion() noexcept
+{
+    // Enable the conversion-complete interrupt to wake up the CPU, clear pending interrupts.
+    // Save the interrupt state, which is restored once the conversion is complete.
+    const uint8_t sreg{SREG};
+    utils::globalInterruptDisable();
+    myReadComplete = false;
+    utils::set(ADCSRA, ADEN, ADIE, ADIF, ADPS0, ADPS1, ADPS2);
+
+    // Enter ADC noise reduction mode, which starts the conversion. Sleep again if the CPU 
+    // was woken up by another interrupt before the conversion was complete. Interrupts are 
+    // only enabled while sleeping, the instruction following SEI is always executed before 
+    // an interrupt, so the wake-up can't be lost between the check and the sleep.
+    SMCR = (1U << SM0) | (1U << SE);
+    while (!myReadComplete) 
+    { 
+        asm("SEI");
+        asm("SLEEP"); 
+        asm("CLI");
+    }
+    utils::clear(SMCR, SE);
+    utils::clear(ADCSRA, ADIE);
+    SREG = sreg;
+}
+
+// -----------------------------------------------------------------------------
+uint16_t adcValue(const uint8_t channel, const ReadMode mode) noexcept
+{
+    ADMUX = (1U << REFS0) | normalizeChannel(channel);
+    const uint16_t count{conversionCount(myOversampling)};
+    uint32_t sum{};
+
+    // Accumulate 4^n conversions, then decimate the sum by n bits.
+    for (uint16_t i{}; i < count; ++i)
+    {
+        if (ReadMode::NoiseReduction == mode) { sleepConversion(); }
+        else { pollConversion(); }
+        sum += ADC;
+    }
+    return static_cast<uint16_t>(sum >> myOversampling);
 }
 } // namespace 
 
@@ -57,24 +183,34 @@ Interface& Atmega328p::getInstance() noexcept
 }
 
 // -----------------------------------------------------------------------------
-uint8_t Atmega328p::resolution() const noexcept { return AdcParam::Resolution; }
+uint8_t Atmega328p::resolution() const noexcept 
+{ 
+    return AdcParam::Resolution + myOversampling; 
+}
 
 // -----------------------------------------------------------------------------
-uint16_t Atmega328p::maxValue() const noexcept { return AdcParam::MaxValue; }
+uint16_t Atmega328p::maxValue() const noexcept 
+{ 
+    return static_cast<uint16_t>(((AdcParam::MaxValue + 1UL) << myOversampling) - 1U); 
+}
 
 // -----------------------------------------------------------------------------
 double Atmega328p::supplyVoltage() const noexcept { return AdcParam::SupplyVoltage; }
 
+// -----------------------------------------------------------------------------
+uint16_t Atmega328p::supplyVoltage_mV() const noexcept { return AdcParam::SupplyVoltage_mV; }
+
 // -----------------------------------------------------------------------------
 uint16_t Atmega328p::read(const uint8_t channel) const noexcept
 { 
-    return myEnabled && isChannelValid(channel) ? adcValue(channel) : 0U;
+    return myEnabled && !mySampling && !myConverting && isChannelValid(channel) 
+        ? adcValue(channel, myReadMode) : 0U;
 }
 
 // -----------------------------------------------------------------------------
 double Atmega328p::dutyCycle(const uint8_t channel) const noexcept
 {
-    return read(channel) / static_cast<double>(AdcParam::MaxValue);
+    return read(channel) / static_cast<double>(maxValue());
 }
 
 // -----------------------------------------------------------------------------
@@ -83,6 +219,18 @@ double Atmega328p::inputVoltage(const uint8_t channel) const noexcept
     return dutyCycle(channel) * AdcParam::SupplyVoltage;
 }
 
+// -----------------------------------------------------------------------------
+uint16_t Atmega328p::inputVoltage_mV(const uint8_t channel) const noexcept
+{
+    return readScaled(channel, AdcParam::SupplyVoltage_mV);
+}
+
+// -----------------------------------------------------------------------------
+uint16_t Atmega328p::readScaled(const uint8_t channel, const uint16_t fullScale) const noexcept
+{
+    return scale(read(channel), fullScale, resolution());
+}
+
 // -----------------------------------------------------------------------------
 bool Atmega328p::isInitialized() const noexcept { return true; }
 
@@ -99,11 +247,194 @@ bool Atmega328p::isChannelValid(const uint8_t channel) const noexcept
         || utils::inRange(channel, Port::C0, Port::C5);
 }
 
+// -----------------------------------------------------------------------------
+bool Atmega328p::setReadMode(const ReadMode mode) noexcept
+{
+    // Check the input parameter, return false if invalid.
+    if (ReadMode::Count <= mode) { return false; }
+    myReadMode = mode;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+ReadMode Atmega328p::readMode() const noexcept { return myReadMode; }
+
+// -----------------------------------------------------------------------------
+bool Atmega328p::setOversampling(const uint8_t extraBits) noexcept
+{
+    // Check the input parameter, return false if invalid or if the ADC is busy.
+    if ((MaxOversampling < extraBits) || mySampling || myConverting) { return false; }
+    myOversampling = extraBits;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+uint8_t Atmega328p::oversampling() const noexcept { return myOversampling; }
+
+// -----------------------------------------------------------------------------
+bool Atmega328p::startConversion(const uint8_t channel) noexcept
+{
+    // Check the input parameter, return false if invalid or if the ADC is busy or disabled.
+    if (!myEnabled || !isChannelValid(channel) || mySampling || myConverting) { return false; }
+
+    // Select the channel, discard the previous result and restart the accumulation.
+    ADMUX             = (1U << REFS0) | adc::normalizeChannel(channel);
+    myAccumulator     = 0U;
+    myAccumulated     = 0U;
+    myConversionReady = false;
+    myConverting      = true;
+
+    // Enable the conversion-complete interrupt, clear pending interrupts and start converting.
+    // Leave the global interrupt state as is, since this may be called from an interrupt.
+    utils::set(ADCSRA, ADEN, ADIE, ADIF, ADPS0, ADPS1, ADPS2);
+    utils::set(ADCSRA, ADSC);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+bool Atmega328p::isConverting() const noexcept { return myConverting; }
+
+// -----------------------------------------------------------------------------
+bool Atmega328p::readConversion(uint16_t& value) noexcept
+{
+    // Read the result with interrupts disabled, since a new conversion may be started from 
+    // an interrupt. Restore the interrupt state afterwards.
+    const uint8_t sreg{SREG};
+    utils::globalInterruptDisable();
+    const bool ready{myConversionReady};
+    if (ready) { value = myConversionResult; }
+    myConversionReady = false;
+    SREG = sreg;
+    return ready;
+}
+
+// -----------------------------------------------------------------------------
+bool Atmega328p::startSampling(const uint8_t channel, const Trigger trigger) noexcept
+{
+    // Check the input parameters, return false if invalid or if the ADC is disabled.
+    if (!myEnabled || !isChannelValid(channel) || (Trigger::Count <= trigger) || myConverting) 
+    { 
+        return false; 
+    }
+
+    // Stop ongoing sampling and clear the sample buffer.
+    stopSampling();
+    mySamples.clear();
+    myDroppedSamples = 0U;
+
+    // Select the channel, then start auto triggered conversions.
+    startAutoTrigger(normalizeChannel(channel), trigger);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+bool Atmega328p::startScan(Sequencer& sequencer, const Trigger trigger) noexcept
+{
+    // Check the input parameters, return false if invalid or if the ADC is disabled.
+    if (!myEnabled || (0U == sequencer.channelCount()) || (Trigger::Count <= trigger) || 
+        myConverting) 
+    { 
+        return false; 
+    }
+
+    // Stop ongoing sampling, then start scanning from the first channel.
+    stopSampling();
+    sequencer.reset();
+    myScan = &sequencer;
+    startAutoTrigger(sequencer.currentChannel(), trigger);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+void Atmega328p::stopSampling() noexcept
+{
+    // Disable auto triggering and the conversion-complete interrupt.
+    utils::clear(ADCSRA, ADATE, ADIE);
+    ADCSRB     = 0U;
+    mySampling = false;
+    myScan     = nullptr;
+}
+
+// -----------------------------------------------------------------------------
+bool Atmega328p::isSampling() const noexcept { return mySampling; }
+
+// -----------------------------------------------------------------------------
+bool Atmega328p::readSample(uint16_t& sample) noexcept { return mySamples.pop(sample); }
+
+// -----------------------------------------------------------------------------
+uint16_t Atmega328p::pendingSamples() const noexcept 
+{ 
+    return static_cast<uint16_t>(mySamples.size()); 
+}
+
+// -----------------------------------------------------------------------------
+uint16_t Atmega328p::droppedSamples() const noexcept { return myDroppedSamples; }
+
+// -----------------------------------------------------------------------------
+uint8_t Atmega328p::normalizeChannel(const uint8_t channel) const noexcept 
+{ 
+    return adc::normalizeChannel(channel); 
+}
+
+// -----------------------------------------------------------------------------
+void Atmega328p::startAutoTrigger(const uint8_t channel, const Trigger trigger) noexcept
+{
+    // Configure the ADC with interrupts disabled, restore the interrupt state afterwards.
+    const uint8_t sreg{SREG};
+    utils::globalInterruptDisable();
+
+    // Select the normalized channel and the trigger source, restart the accumulation.
+    ADMUX         = (1U << REFS0) | channel;
+    ADCSRB        = TriggerSource[static_cast<uint8_t>(trigger)];
+    myAccumulator = 0U;
+    myAccumulated = 0U;
+
+    // Enable auto triggering and the conversion-complete interrupt, clear pending interrupts.
+    // The first conversion has to be started manually in free running mode.
+    mySampling = true;
+    utils::set(ADCSRA, ADEN, ADATE, ADIE, ADIF, ADPS0, ADPS1, ADPS2);
+    if (Trigger::FreeRunning == trigger) { utils::set(ADCSRA, ADSC); }
+    SREG = sreg;
+}
+
 // -----------------------------------------------------------------------------
 Atmega328p::Atmega328p() noexcept
     : myEnabled{true}
+    , myReadMode{ReadMode::Polling}
 {
     read(Pin::A0);
 }
+
+// -----------------------------------------------------------------------------
+ISR(ADC_vect)
+{
+    uint16_t value{};
+
+    // Handle single non-blocking conversions.
+    if (myConverting)
+    {
+        handleSingleConversion(ADC);
+        return;
+    }
+
+    // Signal completion of a blocking read in noise reduction mode.
+    if (!mySampling) 
+    { 
+        myReadComplete = true; 
+        return;
+    }
+
+    // Accumulate the conversion, wait for more conversions when oversampling.
+    if (!accumulate(ADC, value)) { return; }
+    Sequencer* scan{myScan};
+
+    // Pass the result to the sequencer when scanning, switch channel if requested.
+    if (nullptr != scan)
+    {
+        if (scan->handleConversion(value)) { ADMUX = (1U << REFS0) | scan->currentChannel(); }
+    }
+    // Otherwise store the result, count the sample as dropped if the buffer is full.
+    else if (!mySamples.push(value)) { myDroppedSamples = myDroppedSamples + 1U; }
+}
 } // namespace adc
 } // namespace driver
@@ -0,0 +1,107 @@
+/**
+ * @brief Implementation details of the multi-channel ADC scan sequencer.
+ */
+#include "arch/avr/hw_platform.h"
+#include "driver/adc/interface.h"
+#include "driver/adc/sequencer.h"
+#include "utils/utils.h"
+
+namespace driver
+{
+namespace adc
+{
+// -----------------------------------------------------------------------------
+Sequencer::Sequencer(const Interface& adc) noexcept
+    : myAdc{adc}
+    , myChannels{}
+    , myResults{}
+    , myPublished{}
+    , mySequence{}
+    , myChannelCount{}
+    , myIndex{}
+    , myDiscard{false}
+{}
+
+// -----------------------------------------------------------------------------
+bool Sequencer::setChannels(const uint8_t* channels, const uint8_t channelCount) noexcept
+{
+    // Check the input parameters, return false if invalid.
+    if ((nullptr == channels) || (0U == channelCount) || (MaxChannelCount < channelCount)) 
+    { 
+        return false; 
+    }
+    for (uint8_t i{}; i < channelCount; ++i)
+    {
+        if (!myAdc.isChannelValid(channels[i])) { return false; }
+    }
+
+    // Store the normalized channels, then restart the scan.
+    for (uint8_t i{}; i < channelCount; ++i) 
+    { 
+        myChannels[i] = myAdc.normalizeChannel(channels[i]); 
+    }
+    myChannelCount = channelCount;
+    reset();
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+uint8_t Sequencer::channelCount() const noexcept { return myChannelCount; }
+
+// -----------------------------------------------------------------------------
+uint8_t Sequencer::currentChannel() const noexcept { return myChannels[myIndex]; }
+
+// -----------------------------------------------------------------------------
+bool Sequencer::handleConversion(const uint16_t value) noexcept
+{
+    // Ignore conversions if no channels are set.
+    if (0U == myChannelCount) { return false; }
+
+    // Discard the first conversion after a multiplexer switch.
+    if (myDiscard) 
+    { 
+        myDiscard = false; 
+        return false;
+    }
+
+    // Store the result, publish the results once all channels have been converted.
+    myResults[myIndex] = value;
+
+    if (myChannelCount <= myIndex + 1U)
+    {
+        for (uint8_t i{}; i < myChannelCount; ++i) { myPublished[i] = myResults[i]; }
+        mySequence = UINT16_MAX > mySequence ? mySequence + 1U : 1U;
+        myIndex    = 0U;
+    }
+    else { myIndex = myIndex + 1U; }
+
+    // Switch channel unless a single channel is scanned.
+    myDiscard = 1U < myChannelCount;
+    return myDiscard;
+}
+
+// -----------------------------------------------------------------------------
+bool Sequencer::snapshot(Snapshot& snapshot) const noexcept
+{
+    // Copy the published results with interrupts disabled to get a coherent snapshot.
+    // Restore the interrupt state afterwards.
+    const uint8_t sreg{SREG};
+    utils::globalInterruptDisable();
+    snapshot.channelCount = myChannelCount;
+    snapshot.sequence     = mySequence;
+    for (uint8_t i{}; i < myChannelCount; ++i) { snapshot.values[i] = myPublished[i]; }
+    SREG = sreg;
+
+    // Return true if a complete scan has been published.
+    return 0U < snapshot.sequence;
+}
+
+// -----------------------------------------------------------------------------
+void Sequencer::reset() noexcept
+{
+    mySequence = 0U;
+    myIndex    = 0U;
+    myDiscard  = false;
+}
+} // namespace adc
+} // namespace driver
@@ -2,6 +2,7 @@
  * @brief EEPROM stream implementation details for ATmega328P.
  */
 #include "arch/avr/hw_platform.h"
+#include "container/ring_buffer.h"
 #include "driver/eeprom/atmega328p.h"
 #include "utils/utils.h"
 
@@ -21,7 +22,111 @@ struct EepromParam
 
     /** Highest EEPROM address. */
     static constexpr uint16_t MaxAddress{Size - 1U};
+
+    /** The number of bytes the write queue can hold. */
+    static constexpr size_t QueueSize{16U};
+};
+
+/**
+ * @brief Structure of a byte pending to be written.
+ */
+struct PendingByte
+{
+    /** The destination address. */
+    uint16_t address;
+
+    /** The data to write. */
+    uint8_t data;
+
+    /** Callback to invoke once written, only set for the last byte of a write. */
+    WriteCallback callback;
 };
+
+/** Queue of bytes to write, emptied by the EEPROM ready interrupt. */
+container::RingBuffer<PendingByte, EepromParam::QueueSize> myQueue{};
+
+/** Callback to invoke once the byte being programmed is written. */
+volatile WriteCallback myCallback{nullptr};
+
+/** Indicate whether a byte of the queue is being programmed. */
+volatile bool myProgramming{false};
+
+// -----------------------------------------------------------------------------
+void startProgramming(const uint16_t address, const uint8_t data, 
+                      const ProgramMode mode) noexcept
+{
+    // Set the address and data to write.
+    EEAR = address;
+    EEDR = data;
+
+    // Select the programming mode, which can only be changed while EEPE is cleared.
+    utils::clear(EECR, EEPM0, EEPM1);
+    if (ProgramMode::EraseOnly == mode) { utils::set(EECR, EEPM0); }
+    else if (ProgramMode::WriteOnly == mode) { utils::set(EECR, EEPM1); }
+
+    // Start the write sequence, EEPE must be set within four clock cycles after EEMPE.
+    utils::set(EECR, EEMPE);
+    utils::set(EECR, EEPE);
+}
+
+// -----------------------------------------------------------------------------
+uint8_t readStoredByte(const uint16_t address) noexcept
+{
+    // Set the address from which to read, then read the value of the given address.
+    EEAR = address;
+    utils::set(EECR, EERE);
+    return EEDR;
+}
+
+// -----------------------------------------------------------------------------
+void invokeCallback() noexcept
+{
+    const WriteCallback callback{myCallback};
+    myCallback = nullptr;
+    if (nullptr != callback) { callback(); }
+}
+
+// -----------------------------------------------------------------------------
+void processQueue() noexcept
+{
+    // The previous byte is written, invoke its callback if it was the last byte of a write.
+    myProgramming = false;
+    invokeCallback();
+
+    // Start programming the next changed byte, skip bytes already holding the new value.
+    PendingByte pending{};
+    while (myQueue.pop(pending))
+    {
+        myCallback = pending.callback;
+        const uint8_t storedData{readStoredByte(pending.address)};
+
+        if (pending.data != storedData)
+        {
+            myProgramming = true;
+            startProgramming(pending.address, pending.data, programMode(storedData, pending.data));
+            return;
+        }
+        invokeCallback();
+    }
+    // Disable the EEPROM ready interrupt once the queue is empty.
+    utils::clear(EECR, EERIE);
+}
+
+// -----------------------------------------------------------------------------
+bool findPendingByte(const uint16_t address, uint8_t& data) noexcept
+{
+    // Search the latest bytes first, since they overwrite earlier bytes at the same address.
+    for (size_t i{myQueue.size()}; 0U < i--;)
+    {
+        PendingByte pending{};
+        if (myQueue.peek(pending, i) && (address == pending.address))
+        {
+            data = pending.data;
+            return true;
+        }
+    }
+    return false;
+}
 } // namespace
 
 // -----------------------------------------------------------------------------
@@ -46,6 +151,70 @@ bool Atmega328p::isEnabled() const noexcept { return myEnabled; }
 // -----------------------------------------------------------------------------
 void Atmega328p::setEnabled(const bool enable) noexcept { myEnabled = enable; }
 
+// -----------------------------------------------------------------------------
+bool Atmega328p::writeAsync(const uint16_t address, const uint8_t* data, const uint8_t size, 
+                            const WriteCallback callback) noexcept
+{
+    // Return false if the data is invalid, the address is invalid or if the stream is disabled.
+    if ((nullptr == data) || (0U == size) || !isAddressValid(address, size) || !myEnabled)
+    {
+        return false;
+    }
+
+    // Return false unless all bytes fit in the queue, so that writes are never split.
+    if (myQueue.freeSpace() < size) { return false; }
+
+    // Queue the bytes, the callback is invoked once the last byte is written.
+    for (uint8_t i{}; i < size; ++i)
+    {
+        const WriteCallback byteCallback{size - 1U == i ? callback : nullptr};
+        myQueue.push(PendingByte{static_cast<uint16_t>(address + i), data[i], byteCallback});
+    }
+
+    // Enable the EEPROM ready interrupt, which is triggered once the EEPROM is ready. Global 
+    // interrupts are left as is, since writes may be queued from interrupt service routines.
+    utils::set(EECR, EERIE);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+bool Atmega328p::isWritePending() const noexcept { return !myQueue.empty() || myProgramming; }
+
+// -----------------------------------------------------------------------------
+void Atmega328p::flush() noexcept
+{
+    if (!isWritePending()) { return; }
+
+    // Program the pending bytes by polling if global interrupts are disabled, for instance
+    // when called from an interrupt service routine, since sleeping would never wake up.
+    if (!utils::read(SREG, SREG_I))
+    {
+        utils::clear(EECR, EERIE);
+        while (isWritePending())
+        {
+            while (utils::read(EECR, EEPE));
+            processQueue();
+        }
+        return;
+    }
+
+    // Enter idle mode, which is woken up by the EEPROM ready interrupt after each byte.
+    // The queue is checked with interrupts disabled. SEI delays interrupts by one instruction,
+    // so an interrupt emptying the queue after the check always wakes up the CPU.
+    utils::globalInterruptDisable();
+    utils::set(EECR, EERIE);
+    SMCR = (1U << SE);
+
+    while (isWritePending())
+    {
+        asm("SEI");
+        asm("SLEEP");
+        asm("CLI");
+    }
+    utils::clear(SMCR, SE);
+    utils::globalInterruptEnable();
+}
+
 // -----------------------------------------------------------------------------
 Atmega328p::Atmega328p() noexcept
     : myEnabled{false} 
@@ -60,34 +229,51 @@ bool Atmega328p::isAddressValid(const uint16_t address, const uint8_t dataSize)
 // -----------------------------------------------------------------------------
 void Atmega328p::writeByte(const uint16_t address, const uint8_t data) noexcept
 {
+    programByte(address, data, ProgramMode::EraseWrite);
+}
+
+// -----------------------------------------------------------------------------
+void Atmega328p::programByte(const uint16_t address, const uint8_t data, 
+                             const ProgramMode mode) noexcept
+{
+    // Complete pending asynchronous writes first, so that writes are performed in order.
+    flush();
+
     // Wait until EEPROM is ready to send the next byte.
     while (utils::read(EECR, EEPE));
 
-    // Set the address and data to write.
-    EEAR = address;
-    EEDR = data;
-
     // Perform write, disable interrupts during the write sequence.
+    const uint8_t sreg{SREG};
     utils::globalInterruptDisable();
-    utils::set(EECR, EEMPE);
-    utils::set(EECR, EEPE);
+    startProgramming(address, data, mode);
 
-    // Re-enable interrupts once the write sequence is complete.
-    utils::globalInterruptEnable();
+    // Restore the interrupt state once the write sequence is complete.
+    SREG = sreg;
 }
 
 // -----------------------------------------------------------------------------
 uint8_t Atmega328p::readByte(const uint16_t address) const noexcept
 {
-    // Wait until EEPROM is ready to read the next byte.
-    while (utils::read(EECR, EEPE));
+    // Disable the EEPROM ready interrupt while reading, so that the queue is neither emptied
+    // nor programmed meanwhile.
+    const bool interruptEnabled{utils::read(EECR, EERIE)};
+    utils::clear(EECR, EERIE);
 
-    // Set the address from which to read.
-    EEAR = address;
+    // Return the queued data if the address is pending to be written, else wait until EEPROM
+    // is ready to read the next byte and read the value of the given address.
+    uint8_t data{};
+    if (!findPendingByte(address, data))
+    {
+        while (utils::read(EECR, EEPE));
+        data = readStoredByte(address);
+    }
 
-    // Read and return the value of the given address.
-    utils::set(EECR, EERE);
-    return EEDR;
+    // Re-enable the EEPROM ready interrupt once the byte is read.
+    if (interruptEnabled) { utils::set(EECR, EERIE); }
+    return data;
 }
+
+// -----------------------------------------------------------------------------
+ISR(EE_READY_vect) { processQueue(); }
 } // namespace eeprom
 } // namespace driver
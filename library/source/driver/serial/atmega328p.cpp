@@ -53,6 +53,9 @@ bool Atmega328p::isEnabled() const noexcept { return myEnabled; }
 // -----------------------------------------------------------------------------
 void Atmega328p::setEnabled(const bool enable) noexcept { myEnabled = enable; }
 
+// -----------------------------------------------------------------------------
+bool Atmega328p::isDataAvailable() const noexcept { return utils::read(UCSR0A, RXC0); }
+
 // -----------------------------------------------------------------------------
 int16_t Atmega328p::read(uint8_t* buffer, const uint16_t size, 
                          const uint16_t timeout_ms) const noexcept
@@ -94,6 +97,22 @@ int16_t Atmega328p::read(uint8_t* buffer, const uint16_t size,
     return static_cast<int16_t>(bytesRead);
 }
 
+// -----------------------------------------------------------------------------
+int16_t Atmega328p::write(const uint8_t* data, const uint16_t size) const noexcept
+{
+    // Check the input parameters, return -1 if invalid.
+    if ((nullptr == data) || (size == 0U)) { return -1; }
+
+    // Return 0 if serial transmission isn't enabled.
+    if (!myEnabled) { return 0; }
+
+    // Transmit each byte as is.
+    for (uint16_t i{}; i < size; ++i) { transmitChar(static_cast<char>(data[i])); }
+
+    // Return the number of bytes written.
+    return static_cast<int16_t>(size);
+}
+
 // -----------------------------------------------------------------------------
 Atmega328p::Atmega328p() noexcept 
     : myEnabled{true}
@@ -0,0 +1,145 @@
+/**
+ * @brief Implementation details of the binary framed serial protocol.
+ */
+#include "driver/serial/interface.h"
+#include "driver/serial/protocol.h"
+#include "utils/codec.h"
+
+namespace driver
+{
+namespace serial
+{
+namespace
+{
+/** Size of the checksum in bytes. */
+constexpr size_t CrcSize{sizeof(uint16_t)};
+
+/** Minimum size of a raw frame in bytes (type and checksum). */
+constexpr size_t MinRawFrameSize{1U + CrcSize};
+} // namespace
+
+// -----------------------------------------------------------------------------
+Protocol::Protocol(Interface& serial) noexcept
+    : mySerial{serial}
+{}
+
+// -----------------------------------------------------------------------------
+bool Protocol::send(const MessageType type, const int32_t* values,
+                    const uint8_t valueCount) const noexcept
+{
+    // Check the input parameters, return false if invalid.
+    if ((Message::MaxValueCount < valueCount) || ((nullptr == values) && (0U < valueCount)))
+    {
+        return false;
+    }
+
+    // Create the message.
+    Message message{type, valueCount, {}};
+    for (uint8_t i{}; i < valueCount; ++i) { message.values[i] = values[i]; }
+
+    // Encode and transmit the frame, return true if the entire frame was written.
+    uint8_t frame[MaxFrameSize]{};
+    const size_t frameSize{encode(message, frame, sizeof(frame))};
+    return (0U < frameSize) &&
+        (static_cast<int16_t>(frameSize) == mySerial.write(frame, frameSize));
+}
+
+// -----------------------------------------------------------------------------
+bool Protocol::sendTemperature(const int16_t temperature) const noexcept
+{
+    const int32_t value{temperature};
+    return send(MessageType::Temperature, &value, 1U);
+}
+
+// -----------------------------------------------------------------------------
+bool Protocol::sendToggleState(const bool enabled) const noexcept
+{
+    const int32_t value{enabled ? 1 : 0};
+    return send(MessageType::ToggleState, &value, 1U);
+}
+
+// -----------------------------------------------------------------------------
+bool Protocol::receive(Message& message, const uint16_t timeout_ms) const noexcept
+{
+    uint8_t frame[MaxFrameSize]{};
+    size_t size{};
+    bool overflow{false};
+
+    // Read one byte at a time until a valid frame has been received.
+    while (true)
+    {
+        uint8_t byte{};
+        if (1 != mySerial.read(&byte, 1U, timeout_ms)) { return false; }
+
+        if (utils::cobs::Delimiter == byte)
+        {
+            // Return true if a valid frame was received, otherwise resynchronize.
+            if (!overflow && (0U < size) && decode(frame, size, message)) { return true; }
+            size     = 0U;
+            overflow = false;
+        }
+        // Store the received byte, drop the frame if it's too large.
+        else if (sizeof(frame) > size) { frame[size++] = byte; }
+        else { overflow = true; }
+    }
+}
+
+// -----------------------------------------------------------------------------
+size_t Protocol::encode(const Message& message, uint8_t* frame, const size_t frameSize) noexcept
+{
+    // Check the input parameters, return 0 if invalid.
+    if ((nullptr == frame) || (Message::MaxValueCount < message.valueCount)) { return 0U; }
+
+    // Create the raw frame, starting with the message type.
+    uint8_t raw[MaxRawFrameSize]{static_cast<uint8_t>(message.type)};
+    size_t rawSize{1U};
+
+    // Add the values as zigzag encoded varints.
+    for (uint8_t i{}; i < message.valueCount; ++i)
+    {
+        rawSize += utils::varint::encode(utils::varint::zigzag(message.values[i]),
+                                         raw + rawSize, sizeof(raw) - rawSize);
+    }
+
+    // Append the checksum, least significant byte first.
+    const uint16_t crc{utils::crc::crc16(raw, rawSize)};
+    raw[rawSize++] = static_cast<uint8_t>(crc);
+    raw[rawSize++] = static_cast<uint8_t>(crc >> 8U);
+
+    // Encode the raw frame, then append the delimiter.
+    const size_t size{utils::cobs::encode(raw, rawSize, frame, frameSize)};
+    if ((0U == size) || (frameSize <= size)) { return 0U; }
+    frame[size] = utils::cobs::Delimiter;
+    return size + 1U;
+}
+
+// -----------------------------------------------------------------------------
+bool Protocol::decode(const uint8_t* frame, const size_t size, Message& message) noexcept
+{
+    // Decode the frame, return false if it's too small to contain a valid message.
+    uint8_t raw[MaxRawFrameSize]{};
+    const size_t rawSize{utils::cobs::decode(frame, size, raw, sizeof(raw))};
+    if (MinRawFrameSize > rawSize) { return false; }
+
+    // Verify the checksum, return false on mismatch.
+    const size_t dataSize{rawSize - CrcSize};
+    const uint16_t crc{static_cast<uint16_t>(raw[dataSize] | (raw[dataSize + 1U] << 8U))};
+    if (crc != utils::crc::crc16(raw, dataSize)) { return false; }
+
+    // Decode the values, return false if any value is invalid.
+    message.type       = static_cast<MessageType>(raw[0U]);
+    message.valueCount = 0U;
+
+    for (size_t i{1U}; i < dataSize;)
+    {
+        uint32_t value{};
+        const uint8_t consumed{utils::varint::decode(raw + i, dataSize - i, value)};
+        if ((0U == consumed) || (Message::MaxValueCount <= message.valueCount)) { return false; }
+        message.values[message.valueCount++] = utils::varint::unzigzag(value);
+        i += consumed;
+    }
+    // Return true to indicate success.
+    return true;
+}
+} // namespace serial
+} // namespace driver
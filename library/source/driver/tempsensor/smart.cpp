@@ -6,6 +6,7 @@
 #include "driver/adc/interface.h"    // Contains the ADC interface.
 #include "driver/tempsensor/smart.h" // Contains the smart sensor class.
 #include "ml/lin_reg/interface.h"    // Contains the linear regression interface.
+#include "ml/lin_reg/quantized.h"    // Contains the quantized linear regression interface.
 #include "utils/utils.h"             // Contains a function to round numbers.
 
 namespace driver
@@ -15,8 +16,25 @@ namespace tempsensor
 // -----------------------------------------------------------------------------
 Smart::Smart(uint8_t pin, adc::Interface& adc, ml::lin_reg::Interface& linReg) noexcept
     : myAdc{adc}
-    , myLinReg{linReg}
+    , myLinReg{&linReg}
+    , myQuantizedLinReg{nullptr}
+    , myCallback{nullptr}
     , myPin{pin}
+    , myReading{false}
+{
+    // Enable the ADC if initialization succeeded.
+    if (isInitialized()) { myAdc.setEnabled(true); }
+}
+
+// -----------------------------------------------------------------------------
+Smart::Smart(uint8_t pin, adc::Interface& adc, 
+             const ml::lin_reg::QuantizedInterface& linReg) noexcept
+    : myAdc{adc}
+    , myLinReg{nullptr}
+    , myQuantizedLinReg{&linReg}
+    , myCallback{nullptr}
+    , myPin{pin}
+    , myReading{false}
 {
     // Enable the ADC if initialization succeeded.
     if (isInitialized()) { myAdc.setEnabled(true); }
@@ -27,26 +45,61 @@ bool Smart::isInitialized() const noexcept
 {
     // Return true if the ADC is initialized, the temp sensor pin is a valid ADC channel,
     // and the linear regression model is trained.
-    return myAdc.isInitialized() && myAdc.isChannelValid(myPin) && myLinReg.isTrained();
+    const bool trained{nullptr != myQuantizedLinReg ? myQuantizedLinReg->isTrained() 
+                                                    : myLinReg->isTrained()};
+    return myAdc.isInitialized() && myAdc.isChannelValid(myPin) && trained;
 }
 
 // -----------------------------------------------------------------------------
 int16_t Smart::read() const noexcept
 {
-    // Read the temperature if the temp sensor is initialized.
-    if (isInitialized())
-    {
-        // Calculate the input voltage with the ADC.
-        const double inputVoltage{myAdc.inputVoltage(myPin)};
+    // Read the temperature if the temp sensor is initialized, otherwise return 0.
+    return isInitialized() ? toTemperature(myAdc.read(myPin)) : 0;
+}
+
+// -----------------------------------------------------------------------------
+bool Smart::startRead(const ReadCallback callback) noexcept
+{
+    // Return false if initialization failed, a read is ongoing or if the ADC is busy.
+    if (!isInitialized() || myReading) { return false; }
+    myCallback = callback;
+    if (!myAdc.startConversion(myPin)) { return false; }
+    myReading = true;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+bool Smart::isReading() const noexcept { return myReading; }
+
+// -----------------------------------------------------------------------------
+bool Smart::poll(int16_t& temperature) noexcept
+{
+    // Return false if no read is ongoing or if the conversion isn't complete.
+    uint16_t adcValue{};
+    if (!myReading || !myAdc.readConversion(adcValue)) { return false; }
+
+    // Predict the temperature, then notify the callback (if any).
+    myReading   = false;
+    temperature = toTemperature(adcValue);
+    if (nullptr != myCallback) { myCallback(temperature); }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+int16_t Smart::toTemperature(const uint16_t adcValue) const noexcept
+{
+    // Predict the temperature directly from the ADC value if the model is quantized.
+    if (nullptr != myQuantizedLinReg) { return myQuantizedLinReg->predict(adcValue); }
+
+    // Calculate the input voltage of the ADC value.
+    const double inputVoltage{
+        adcValue / static_cast<double>(myAdc.maxValue()) * myAdc.supplyVoltage()};
 
-        // Predict the temperature based on the input voltage.
-        const double predictedTemp{myLinReg.predict(inputVoltage)};
+    // Predict the temperature based on the input voltage.
+    const double predictedTemp{myLinReg->predict(inputVoltage)};
 
-        // Return the temperature rounded to the nearest integer.
-        return utils::round<int16_t>(predictedTemp);
-    }
-    // Return 0 if the temp sensor isn't initialized.
-    return 0;
+    // Return the temperature rounded to the nearest integer.
+    return utils::round<int16_t>(predictedTemp);
 }
 } // namespace tempsensor
 } // namespace driver
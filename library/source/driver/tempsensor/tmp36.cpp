@@ -3,18 +3,32 @@
  */
 #include <stdint.h>
 
+#include "arch/avr/hw_platform.h"
 #include "driver/adc/interface.h"
 #include "driver/tempsensor/tmp36.h"
-#include "utils/utils.h"
 
 namespace driver
 {
 namespace tempsensor
 {
+namespace
+{
+/** Temperature coefficient in millivolts per degree Celsius. */
+constexpr uint16_t MilliVoltsPerDegree{10U};
+
+/** Temperature offset in degrees Celsius (0 mV corresponds to -50 degrees Celsius). */
+constexpr int16_t TempOffset{50};
+
+/** Lookup table mapping ADC values to temperature, stored in program memory. */
+constexpr Tmp36::Table TempTable PROGMEM{Tmp36::Table::generate()};
+} // namespace
+
 // -----------------------------------------------------------------------------
 Tmp36::Tmp36(const uint8_t pin, adc::Interface& adc) noexcept
     : myAdc{adc}
+    , myCallback{nullptr}
     , myPin{pin}
+    , myReading{false}
 {
     // Enable the ADC if the initialization succeeded.
     if (isInitialized()) { myAdc.setEnabled(true); }
@@ -31,11 +45,53 @@ bool Tmp36::isInitialized() const noexcept
 int16_t Tmp36::read() const noexcept
 {
     // Return 0 if initialization failed.
-    if (!isInitialized()) { return 0; }
+    return isInitialized() ? toTemperature(myAdc.read(myPin)) : 0;
+}
+
+// -----------------------------------------------------------------------------
+bool Tmp36::startRead(const ReadCallback callback) noexcept
+{
+    // Return false if initialization failed, a read is ongoing or if the ADC is busy.
+    if (!isInitialized() || myReading) { return false; }
+    myCallback = callback;
+    if (!myAdc.startConversion(myPin)) { return false; }
+    myReading = true;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+bool Tmp36::isReading() const noexcept { return myReading; }
+
+// -----------------------------------------------------------------------------
+bool Tmp36::poll(int16_t& temperature) noexcept
+{
+    // Return false if no read is ongoing or if the conversion isn't complete.
+    uint16_t adcValue{};
+    if (!myReading || !myAdc.readConversion(adcValue)) { return false; }
+
+    // Convert the reading, then notify the callback (if any).
+    myReading   = false;
+    temperature = toTemperature(adcValue);
+    if (nullptr != myCallback) { myCallback(temperature); }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+int16_t Tmp36::toTemperature(const uint16_t adcValue) const noexcept
+{
+    // Look up the temperature if the table matches the ADC.
+    if ((Table::AdcResolution == myAdc.resolution()) && 
+        (Table::AdcSupplyVoltage_mV == myAdc.supplyVoltage_mV()))
+    {
+        return TempTable.read(adcValue);
+    }
 
-    // Return the temperature, rounded to the nearest integer.
-    const double temperature{100.0 * myAdc.inputVoltage(myPin) - 50.0};
-    return utils::round<int16_t>(temperature);
+    // Otherwise scale the input to the full-scale temperature with integer arithmetic only, 
+    // then return the temperature rounded to the nearest integer.
+    const uint16_t fullScale{
+        static_cast<uint16_t>(myAdc.supplyVoltage_mV() / MilliVoltsPerDegree)};
+    return static_cast<int16_t>(adc::scale(adcValue, fullScale, myAdc.resolution())) 
+        - TempOffset;
 }
 } // namespace tempsensor
 } // namespace driver
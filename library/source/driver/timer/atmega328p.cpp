@@ -19,6 +19,9 @@ struct Atmega328p::Hardware
     /** Hardware counter. */
 	volatile uint32_t counter;
 
+    /** Number of interrupts since the timer was created, never reset. */
+	volatile uint32_t ticks;
+
     /** Pointer to mask register. */
 	volatile uint8_t* maskReg;
 
@@ -60,6 +63,9 @@ constexpr uint8_t CircuitCount{3U};
 /** Time between each timer interrupt in ms. */
 constexpr double InterruptIntervalMs{0.128};
 
+/** Time between each timer interrupt in us. */
+constexpr uint32_t InterruptInterval_us{128U};
+
 /** Array holding pointers to timers. */
 Atmega328p* myTimers[CircuitCount]{};  
 
@@ -126,6 +132,17 @@ uint32_t Atmega328p::timeout_ms() const noexcept
 	return utils::round<uint32_t>(myMaxCount * InterruptIntervalMs);
 }
 
+// -----------------------------------------------------------------------------
+uint32_t Atmega328p::elapsed_us() const noexcept
+{
+	// Read the tick count with interrupts disabled, since the read isn't atomic.
+	const uint8_t sreg{SREG};
+	utils::globalInterruptDisable();
+	const uint32_t ticks{myHw->ticks};
+	SREG = sreg;
+	return ticks * InterruptInterval_us;
+}
+
 // -----------------------------------------------------------------------------
 void Atmega328p::setTimeout_ms(const uint32_t timeout_ms) noexcept
 {
@@ -191,6 +208,7 @@ bool Atmega328p::increment() noexcept
 {
 	if (!myEnabled) { return false; }
 	myHw->counter++; 
+	myHw->ticks++;
 	return true;
 }
 
@@ -270,6 +288,7 @@ Atmega328p::Hardware* Atmega328p::Hardware::init(const uint8_t timerIndex) noexc
 	}
 	// Return the initialized circuit.
     hw->counter = 0U;
+	hw->ticks   = 0U;
 	hw->index   = timerIndex;
 	return hw;
 }
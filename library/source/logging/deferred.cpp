@@ -0,0 +1,93 @@
+/**
+ * @brief Implementation details of deferred logging.
+ */
+#include "arch/avr/hw_platform.h"
+#include "logging/deferred.h"
+#include "utils/codec.h"
+#include "utils/utils.h"
+
+namespace logging
+{
+namespace
+{
+/** Maximum size of an encoded record in bytes, excluding the record size. */
+constexpr size_t MaxRecordSize{(Deferred::MaxArgCount + 1U) * utils::varint::MaxSize};
+} // namespace
+
+// -----------------------------------------------------------------------------
+Deferred::Deferred(const driver::serial::Protocol& protocol) noexcept
+    : myProtocol{protocol}
+    , myBuffer{}
+    , myDroppedRecords{}
+{}
+
+// -----------------------------------------------------------------------------
+uint16_t Deferred::flush(const uint16_t maxRecords) noexcept
+{
+    uint16_t recordCount{};
+
+    // Transmit one record at a time, the buffer only holds complete records.
+    while ((recordCount < maxRecords) && !myBuffer.empty())
+    {
+        uint8_t size{};
+        uint8_t record[MaxRecordSize]{};
+        myBuffer.pop(size);
+        for (uint8_t i{}; i < size; ++i) { myBuffer.pop(record[i]); }
+
+        // Decode the id and the arguments, then transmit them as a log message.
+        int32_t values[driver::serial::Message::MaxValueCount]{};
+        uint8_t valueCount{};
+
+        for (uint8_t i{}; (i < size) && (driver::serial::Message::MaxValueCount > valueCount);)
+        {
+            uint32_t value{};
+            const uint8_t consumed{utils::varint::decode(record + i, size - i, value)};
+            if (0U == consumed) { break; }
+            values[valueCount++] = utils::varint::unzigzag(value);
+            i += consumed;
+        }
+        myProtocol.send(driver::serial::MessageType::Log, values, valueCount);
+        recordCount++;
+    }
+    return recordCount;
+}
+
+// -----------------------------------------------------------------------------
+size_t Deferred::pendingBytes() const noexcept { return myBuffer.size(); }
+
+// -----------------------------------------------------------------------------
+uint16_t Deferred::droppedRecords() const noexcept { return myDroppedRecords; }
+
+// -----------------------------------------------------------------------------
+bool Deferred::store(const Id id, const int32_t* args, const uint8_t argCount) noexcept
+{
+    // Check the input parameters, return false if invalid.
+    if ((Id::Count <= id) || (MaxArgCount < argCount)) { return false; }
+
+    // Encode the id followed by the arguments.
+    uint8_t record[MaxRecordSize]{};
+    uint8_t size{utils::varint::encode(utils::varint::zigzag(static_cast<int32_t>(id)), record,
+                                       sizeof(record))};
+
+    for (uint8_t i{}; i < argCount; ++i)
+    {
+        size += utils::varint::encode(utils::varint::zigzag(args[i]), record + size, 
+                                      sizeof(record) - size);
+    }
+
+    // Store the record with interrupts disabled, since log statements may be issued from 
+    // interrupt service routines. Restore the interrupt state afterwards.
+    const uint8_t sreg{SREG};
+    utils::globalInterruptDisable();
+    const bool stored{size < myBuffer.freeSpace()};
+
+    if (stored)
+    {
+        myBuffer.push(size);
+        for (uint8_t i{}; i < size; ++i) { myBuffer.push(record[i]); }
+    }
+    else { myDroppedRecords = myDroppedRecords + 1U; }
+    SREG = sreg;
+    return stored;
+}
+} // namespace logging
@@ -0,0 +1,73 @@
+/**
+ * @brief Implementation details of the serial command interpreter.
+ */
+#include "logic/command.h"
+
+namespace logic
+{
+namespace command
+{
+namespace
+{
+// -----------------------------------------------------------------------------
+constexpr bool isWhitespace(const char character) noexcept
+{
+    return (' ' == character) || ('\t' == character);
+}
+
+// -----------------------------------------------------------------------------
+constexpr bool isDigit(const char character) noexcept
+{
+    return ('0' <= character) && ('9' >= character);
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+bool Args::toUint(const uint8_t index, uint32_t& value) const noexcept
+{
+    // Check the input parameters, return false if invalid.
+    if ((count <= index) || (nullptr == values[index]) || ('\0' == *values[index])) 
+    { 
+        return false; 
+    }
+    uint32_t result{};
+
+    // Parse the argument digit by digit, return false on invalid digits or overflow.
+    for (const char* c{values[index]}; '\0' != *c; ++c)
+    {
+        const uint8_t digit{static_cast<uint8_t>(*c - '0')};
+        if (!isDigit(*c) || ((UINT32_MAX - digit) / 10U < result)) { return false; }
+        result = result * 10U + digit;
+    }
+    value = result;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+uint8_t tokenize(char* line, const char** tokens, const uint8_t maxTokens) noexcept
+{
+    // Check the input parameters, return 0 if invalid.
+    if ((nullptr == line) || (nullptr == tokens)) { return 0U; }
+    uint8_t count{};
+
+    for (char* c{line}; '\0' != *c;)
+    {
+        // Skip whitespace preceding the token.
+        if (isWhitespace(*c)) 
+        { 
+            ++c; 
+            continue; 
+        }
+
+        // Return maxTokens + 1 if the line holds too many tokens.
+        if (maxTokens <= count) { return maxTokens + 1U; }
+        tokens[count++] = c;
+
+        // Find the end of the token, then terminate it in place.
+        while (('\0' != *c) && !isWhitespace(*c)) { ++c; }
+        if ('\0' != *c) { *c++ = '\0'; }
+    }
+    return count;
+}
+} // namespace command
+} // namespace logic
@@ -11,9 +11,19 @@
 #include "driver/timer/interface.h"
 #include "driver/watchdog/interface.h"
 #include "logic/logic.h"
+#include "utils/utils.h"
 
 namespace logic
 {
+// -----------------------------------------------------------------------------
+constexpr command::Entry<Logic> Logic::Commands[CommandCount]
+{
+    {"toggle", &Logic::setToggleTimeout},
+    {"temp",   &Logic::setTempPeriod},
+    {"eeprom", &Logic::readEeprom},
+    {"stats",  &Logic::dumpStats},
+};
+
 // -----------------------------------------------------------------------------
 Logic::Logic(driver::gpio::Interface& led,
              driver::gpio::Interface& toggleButton,
@@ -35,7 +45,15 @@ Logic::Logic(driver::gpio::Interface& led,
     , myWatchdog{watchdog}
     , myEeprom{eeprom}
     , myTempSensor{tempSensor}
+    , myProtocol{serial}
+    , myLogger{myProtocol}
+    , myCommands{Commands}
+    , myOutputFormat{OutputFormat::Text}
+    , myToggleStateChanged{false}
 {
+    // Generate a compiler error if the command table is invalid.
+    static_assert(command::isUnique(Commands), "Command names must be unique!");
+
     // Enable system if all hardware drivers were initialized correctly.
     if (isInitialized())
     {
@@ -88,18 +106,25 @@ void Logic::run(const bool& stop) noexcept
         { 
             const bool enabled{mySerial.isEnabled()};
             mySerial.setEnabled(true);
-            mySerial.printf("Failed to run the system: initialization failed!\n");
+            print(logging::Id::InitFailed);
+            myLogger.flush();
             mySerial.setEnabled(enabled);
         }
         return;
     }
 
     // Run the system continuously.
-    mySerial.printf("Running the system!\n");
+    print(logging::Id::SystemRunning);
 
     while (!stop) 
     { 
-        // Regularly reset the watchdog to avoid system reset.
+        // Print toggle state changes and completed temperature readings, handle received 
+        // commands and transmit pending log records. Regularly reset the watchdog to avoid 
+        // system reset.
+        pollToggleState();
+        pollTemperature();
+        pollCommands();
+        myLogger.flush();
         myWatchdog.reset(); 
     }
 }
@@ -142,14 +167,47 @@ void Logic::handleToggleTimerTimeout() noexcept
 // -----------------------------------------------------------------------------
 void Logic::handleTempTimerTimeout() noexcept 
 { 
-    // Read and print the temperature on temperature timer timeout.
-    if (myTempTimer.hasTimedOut()) { printTemperature(); }
+    // Start reading the temperature on temperature timer timeout, the reading is printed 
+    // from the main loop once complete.
+    if (myTempTimer.hasTimedOut()) { myTempSensor.startRead(); }
+}
+
+// -----------------------------------------------------------------------------
+OutputFormat Logic::outputFormat() const noexcept { return myOutputFormat; }
+
+// -----------------------------------------------------------------------------
+void Logic::setOutputFormat(const OutputFormat format) noexcept
+{
+    // Update the output format if valid.
+    if (OutputFormat::Count > format) { myOutputFormat = format; }
 }
 
+// -----------------------------------------------------------------------------
+command::Status Logic::executeCommand(char* line) noexcept
+{
+    const command::Status status{myCommands.execute(*this, line)};
+    printCommandStatus(status);
+    return status;
+}
+
+// -----------------------------------------------------------------------------
+const command::Statistics* Logic::commandStatistics(const uint8_t index) const noexcept
+{
+    return myCommands.statistics(index);
+}
+
+// -----------------------------------------------------------------------------
+void Logic::setCommandClock(const command::Clock clock) noexcept { myCommands.setClock(clock); }
+
 // -----------------------------------------------------------------------------
 void Logic::writeToggleStateToEeprom(const bool enable) noexcept
 { 
-    myEeprom.write(ToggleStateAddr, static_cast<uint8_t>(enable));
+    // Queue the write to not block the button handling, write right away if the queue is full.
+    const uint8_t state{static_cast<uint8_t>(enable)};
+    if (!myEeprom.writeAsync(ToggleStateAddr, &state, sizeof(state)))
+    {
+        myEeprom.write(ToggleStateAddr, state);
+    }
 }
 
 // -----------------------------------------------------------------------------
@@ -160,36 +218,32 @@ bool Logic::readToggleStateFromEeprom() const noexcept
 }
 
 // -----------------------------------------------------------------------------
-void Logic::printTemperature() noexcept
+void Logic::printTemperature(const int16_t temperature) noexcept
 {
-    // Read and print the temperature.
-    const int16_t temperature{myTempSensor.read()};
-    mySerial.printf("Temperature: %d Celsius\n", temperature);
+    if (OutputFormat::Binary == myOutputFormat) { myProtocol.sendTemperature(temperature); }
+    else { print(logging::Id::Temperature, temperature); }
 }
 
 // -----------------------------------------------------------------------------
 void Logic::handleToggleButtonPressed() noexcept
 {
     // Toggle the toggle timer on pressdown, safe the current LED state in EEPROM.
+    // The new state is printed from the main loop, since this is called from an interrupt.
     myToggleTimer.toggle();
     writeToggleStateToEeprom(myToggleTimer.isEnabled());
+    myToggleStateChanged = true;
 
-    if (myToggleTimer.isEnabled()) { mySerial.printf("Toggle timer enabled!\n"); }
-    else
-    {
-        // Immediately disable the LED if the toggle timer is disabled to ensure that the LED
-        // isn't stuck in an enabled state.
-        mySerial.printf("Toggle timer disabled!\n");
-        myLed.write(false);
-    }
+    // Immediately disable the LED if the toggle timer is disabled to ensure that the LED
+    // isn't stuck in an enabled state.
+    if (!myToggleTimer.isEnabled()) { myLed.write(false); }
 }
 
 // -----------------------------------------------------------------------------
 void Logic::handleTempButtonPressed() noexcept
 {
-    // Read and print the temperature on pressdown.
+    // Start reading the temperature on pressdown, the reading is printed from the main loop.
     // Restart the temperature timer.
-    printTemperature();
+    myTempSensor.startRead();
     myTempTimer.restart();
 }
 
@@ -200,7 +254,139 @@ void Logic::restoreToggleStateFromEeprom() noexcept
     if (readToggleStateFromEeprom())
     {
         myToggleTimer.start();
-        mySerial.printf("Toggle timer enabled!\n");
+        printToggleState(true);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void Logic::printToggleState(const bool enabled) noexcept
+{
+    if (OutputFormat::Binary == myOutputFormat) { myProtocol.sendToggleState(enabled); }
+    else { print(enabled ? logging::Id::ToggleEnabled : logging::Id::ToggleDisabled); }
+}
+
+// -----------------------------------------------------------------------------
+void Logic::pollToggleState() noexcept
+{
+    // Print the current toggle state if it has changed. Clear the flag first, so that a 
+    // change made by the button interrupt meanwhile is printed in the next iteration.
+    if (!myToggleStateChanged) { return; }
+    myToggleStateChanged = false;
+    printToggleState(myToggleTimer.isEnabled());
+}
+
+// -----------------------------------------------------------------------------
+void Logic::pollTemperature() noexcept
+{
+    // Print the temperature once the ongoing read is complete.
+    int16_t temperature{};
+    if (myTempSensor.poll(temperature)) { printTemperature(temperature); }
+}
+
+// -----------------------------------------------------------------------------
+void Logic::pollCommands() noexcept
+{
+    // Execute the next command if a complete line has been received.
+    command::Status status{};
+    if (myCommands.poll(mySerial, *this, status)) { printCommandStatus(status); }
+}
+
+// -----------------------------------------------------------------------------
+void Logic::printCommandStatus(const command::Status status) noexcept
+{
+    // Print an error message if the command failed.
+    switch (status)
+    {
+        case command::Status::Unknown:
+            print(logging::Id::CommandUnknown);
+            break;
+        case command::Status::InvalidArgs:
+            print(logging::Id::CommandInvalid);
+            break;
+        case command::Status::Overflow:
+            print(logging::Id::CommandTooLong);
+            break;
+        default:
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+command::Status Logic::setToggleTimeout(Logic& logic, const command::Args& args) noexcept
+{
+    // Update the timeout if specified, the timeout must exceed 0.
+    uint32_t timeout_ms{};
+    if (1U < args.count) { return command::Status::InvalidArgs; }
+    if (1U == args.count)
+    {
+        if (!args.toUint(0U, timeout_ms) || (0U == timeout_ms)) 
+        { 
+            return command::Status::InvalidArgs; 
+        }
+        logic.myToggleTimer.setTimeout_ms(timeout_ms);
+    }
+    // Print the current timeout.
+    logic.print(logging::Id::ToggleTimeout, logic.myToggleTimer.timeout_ms());
+    return command::Status::Ok;
+}
+
+// -----------------------------------------------------------------------------
+command::Status Logic::setTempPeriod(Logic& logic, const command::Args& args) noexcept
+{
+    // Update the period if specified, the period must exceed 0.
+    uint32_t period_ms{};
+    if (1U < args.count) { return command::Status::InvalidArgs; }
+    if (1U == args.count)
+    {
+        if (!args.toUint(0U, period_ms) || (0U == period_ms)) 
+        { 
+            return command::Status::InvalidArgs; 
+        }
+        logic.myTempTimer.setTimeout_ms(period_ms);
+    }
+    // Print the current period.
+    logic.print(logging::Id::TempPeriod, logic.myTempTimer.timeout_ms());
+    return command::Status::Ok;
+}
+
+// -----------------------------------------------------------------------------
+command::Status Logic::readEeprom(Logic& logic, const command::Args& args) noexcept
+{
+    // Parse the address and the number of bytes to read (default = 1).
+    uint32_t address{};
+    uint32_t count{1U};
+
+    if ((1U > args.count) || (2U < args.count) || !args.toUint(0U, address) || 
+        ((2U == args.count) && !args.toUint(1U, count)) ||
+        !utils::inRange<uint32_t>(count, 1U, MaxEepromReadCount) || 
+        (logic.myEeprom.size() < address + count))
+    {
+        return command::Status::InvalidArgs;
+    }
+
+    // Read and print the bytes one by one.
+    for (uint16_t i{}; i < count; ++i)
+    {
+        const uint16_t byteAddress{static_cast<uint16_t>(address + i)};
+        uint8_t value{};
+        if (!logic.myEeprom.read(byteAddress, value)) { return command::Status::InvalidArgs; }
+        logic.print(logging::Id::EepromValue, byteAddress, value);
+    }
+    return command::Status::Ok;
+}
+
+// -----------------------------------------------------------------------------
+command::Status Logic::dumpStats(Logic& logic, const command::Args& args) noexcept
+{
+    // Print the statistics of each command, no arguments are expected.
+    if (0U < args.count) { return command::Status::InvalidArgs; }
+
+    for (uint8_t i{}; i < CommandCount; ++i)
+    {
+        const command::Statistics& statistics{*logic.myCommands.statistics(i)};
+        logic.print(logging::Id::CommandStats, i, statistics.callCount, 
+                    statistics.lastLatency_us, statistics.maxLatency_us);
     }
+    return command::Status::Ok;
 }
 } // namespace logic
\ No newline at end of file
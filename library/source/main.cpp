@@ -5,24 +5,30 @@
  *            - A button to toggle a blink timer.
  *            - A button to read the surrounding temperature.
  *            - A blink timer to toggle an LED when enabled.
- *            - A temperature timer to print the temperature on timeout.
+ *            - A temperature timer to print the temperature on timeout. This timer runs 
+ *              continuously, so it's also used as clock for measuring command latency.
  *            - A debounce timer to reduce the effect of contact bounces after pushing the buttons.
  *            - A serial device to print serial data via UART.
  *            - A watchdog timer to restart the program if it gets stuck somewhere.
  *            - An EEPROM stream to store the LED state. On startup, this value is read; if the
  *              last stored state before power down was "on," the LED will automatically blink.
- *            - A temperature sensor to read the surrounding temperature.
+ *            - A temperature sensor to read the surrounding temperature, filtered to suppress
+ *              noise from the ADC.
  */
 #include "driver/adc/atmega328p.h"
 #include "driver/eeprom/atmega328p.h"
 #include "driver/gpio/atmega328p.h"
 #include "driver/serial/atmega328p.h"
+#include "driver/tempsensor/filtered.h"
 #include "driver/tempsensor/smart.h"
 #include "driver/timer/atmega328p.h"
 #include "driver/watchdog/atmega328p.h"
+#include "filter/chain.h"
+#include "filter/median.h"
+#include "filter/moving_average.h"
 #include "logic/logic.h"
 #include "ml/lin_reg/fixed.h"
-#include "ml/types.h"
+#include "ml/lin_reg/quantized.h"
 
 using namespace driver;
 
@@ -31,6 +37,9 @@ namespace
 /** Pointer to the logic implementation. */
 logic::Interface* myLogic{nullptr};
 
+/** Pointer to the timer used as clock for measuring command latency. */
+const timer::Atmega328p* myClockTimer{nullptr};
+
 namespace callback
 {
 /**
@@ -64,29 +73,24 @@ void tempTimer() noexcept { myLogic->handleTempTimerTimeout(); }
 } // namespace callback
 
 /**
- * @brief Train fixed linear regression model to predict temperature based on the input voltage.
- * 
- * @param[in] model The model to train.
+ * @brief Clock for measuring command latency.
  * 
- * @return True on success, false on failure.
+ * @return The time elapsed since the clock timer was created in microseconds.
  */
-bool trainModel(ml::lin_reg::Fixed& model) noexcept
-{
-    // Training parameters.
-    constexpr size_t epochCount{100U};
-    constexpr double learningRate{0.01};
-
-    // Training data to teach the model to predict T = 100 * Uin - 50.
-    const ml::Matrix1d trainIn{0.0, 0.1, 0.2, 0.3, 0.4, 
-                               0.5, 0.6, 0.7, 0.8, 0.9, 
-                               1.0, 1.1, 1.2, 1.3, 1.4};
-    const ml::Matrix2d trainOut{-50.0, -40.0, -30.0, -20.0, -10.0, 
-                                0.0, 10.0, 20.0, 30.0, 40.0, 50.0, 
-                                60.0, 70.0, 80.0, 90.0, 100.0};
-
-    // Train the model, return the result.
-    return model.train(trainIn, trainOut, epochCount, learningRate);
-}
+uint32_t commandClock_us() noexcept { return myClockTimer->elapsed_us(); }
+
+/** Training data input values, the input voltage of the temperature sensor in Volts. */
+constexpr double TempTrainIn[]{0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 
+                               0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5};
+
+/** Training data output values, teaching the model to predict T = 100 * Uin - 50. */
+constexpr double TempTrainOut[]{-50.0, -40.0, -30.0, -20.0, -10.0, 0.0, 10.0, 20.0, 
+                                30.0, 40.0, 50.0, 60.0, 70.0, 80.0, 90.0, 100.0};
+
+/** Temperature model parameters, trained by the compiler so no training runs at boot. */
+constexpr ml::lin_reg::Parameters TempModel{ml::lin_reg::leastSquares(TempTrainIn, 
+                                                                      TempTrainOut)};
+static_assert(TempModel.valid, "Invalid temperature training data!");
 } // namespace
 
 /**
@@ -133,18 +137,29 @@ int main()
     // Obtain a reference to the singleton ADC instance.
     auto& adc{adc::Atmega328p::getInstance()};
 
-    // Create a linear regression model that predicts temperature based on input voltage.
-    ml::lin_reg::Fixed linReg{};
+    // Create the pre-trained linear regression model that predicts temperature based on 
+    // input voltage.
+    ml::lin_reg::Fixed linReg{TempModel};
 
-    // Train the model and print the result.
-    if (trainModel(linReg))
+    // Quantize the model, so that the temperature is predicted from the raw ADC value with
+    // integer arithmetic only. Fall back on the floating-point model on failure.
+    ml::lin_reg::Quantized<> quantizedLinReg{};
+    double maxError{};
+    if (quantizedLinReg.quantize(linReg, adc.maxValue(), adc.supplyVoltage(), maxError))
     {
-        serial.printf("Temperature prediction training succeeded!\n");
+        serial.printf("Temperature prediction model quantized, max error %d milli-degrees!\n", 
+                      static_cast<int>(maxError * 1000.0));
     }
-    else { serial.printf("Temperature prediction training failed!\n"; )}
 
     // Initialize the smart temperature sensor.
-    tempsensor::Smart tempSensor{tempSensorPin, adc, linReg};
+    tempsensor::Smart smartSensor{
+        quantizedLinReg.isTrained() ? tempsensor::Smart{tempSensorPin, adc, quantizedLinReg}
+                                    : tempsensor::Smart{tempSensorPin, adc, linReg}};
+
+    // Remove spikes from the temperature readings, then average the remaining noise.
+    using TempFilter = filter::Chain<filter::Median<int16_t, 3U>, 
+                                     filter::MovingAverage<int16_t, 4U>>;
+    tempsensor::Filtered<TempFilter> tempSensor{smartSensor};
 
     // Initialize the logic implementation with the given hardware.
     logic::Logic logic{led, 
@@ -159,6 +174,10 @@ int main()
                        tempSensor};
     myLogic = &logic;
 
+    // Measure the command latency with the continuously running temperature timer.
+    myClockTimer = &tempTimer;
+    logic.setCommandClock(commandClock_us);
+
     // Run the application on the target MCU.
     const bool stop{false};
     myLogic->run(stop);
@@ -0,0 +1,110 @@
+/**
+ * @brief Implementation details of the batch kernels for regression models.
+ */
+#include <string.h>
+
+#include "ml/batch.h"
+
+namespace ml
+{
+namespace batch
+{
+namespace
+{
+#if defined(__GNUC__) && !defined(__AVR__)
+
+/** The number of inputs processed per vector operation, the width of SSE2 and NEON. */
+constexpr size_t LaneCount{2U};
+
+/** Vector of doubles, mapped to SSE2 or NEON registers by the compiler. */
+using Lanes = double __attribute__((vector_size(LaneCount * sizeof(double))));
+
+// -----------------------------------------------------------------------------
+inline Lanes load(const double* data) noexcept
+{
+    // Copy to support unaligned data, which compiles to a single unaligned load.
+    Lanes lanes;
+    memcpy(&lanes, data, sizeof(lanes));
+    return lanes;
+}
+
+// -----------------------------------------------------------------------------
+inline void store(double* data, const Lanes& lanes) noexcept
+{
+    memcpy(data, &lanes, sizeof(lanes));
+}
+
+// -----------------------------------------------------------------------------
+inline Lanes broadcast(const double value) noexcept
+{
+    return Lanes{} + value;
+}
+
+#endif /** defined(__GNUC__) && !defined(__AVR__) */
+
+// -----------------------------------------------------------------------------
+inline double evaluate(const double input, const double* coefficients, const uint8_t degree, 
+                       const double inputOffset, const double inputScale) noexcept
+{
+    const double normalized{(input - inputOffset) * inputScale};
+    double output{coefficients[degree]};
+    for (uint8_t k{degree}; 0U < k--;) { output = output * normalized + coefficients[k]; }
+    return output;
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+bool affine(const double* input, double* output, const size_t count, const double scale, 
+            const double offset) noexcept
+{
+    if ((0U < count) && ((nullptr == input) || (nullptr == output))) { return false; }
+    size_t i{};
+
+#if defined(__GNUC__) && !defined(__AVR__)
+    // Process full blocks of lanes, the same operations as the scalar loop give equal results.
+    const Lanes scales{broadcast(scale)};
+    const Lanes offsets{broadcast(offset)};
+    for (; i + LaneCount <= count; i += LaneCount)
+    {
+        store(&output[i], scales * load(&input[i]) + offsets);
+    }
+#endif /** defined(__GNUC__) && !defined(__AVR__) */
+
+    // Process the remaining inputs one at a time.
+    for (; i < count; ++i) { output[i] = scale * input[i] + offset; }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+bool polynomial(const double* input, double* output, const size_t count, 
+                const double* coefficients, const uint8_t degree, const double inputOffset, 
+                const double inputScale) noexcept
+{
+    if ((0U < count) && ((nullptr == input) || (nullptr == output) || (nullptr == coefficients)))
+    {
+        return false;
+    }
+    size_t i{};
+
+#if defined(__GNUC__) && !defined(__AVR__)
+    // Run Horner's method on full blocks of lanes.
+    const Lanes offsets{broadcast(inputOffset)};
+    const Lanes scales{broadcast(inputScale)};
+    for (; i + LaneCount <= count; i += LaneCount)
+    {
+        const Lanes normalized{(load(&input[i]) - offsets) * scales};
+        Lanes lanes{broadcast(coefficients[degree])};
+        for (uint8_t k{degree}; 0U < k--;) { lanes = lanes * normalized + coefficients[k]; }
+        store(&output[i], lanes);
+    }
+#endif /** defined(__GNUC__) && !defined(__AVR__) */
+
+    // Process the remaining inputs one at a time.
+    for (; i < count; ++i)
+    {
+        output[i] = evaluate(input[i], coefficients, degree, inputOffset, inputScale); 
+    }
+    return true;
+}
+} // namespace batch
+} // namespace ml
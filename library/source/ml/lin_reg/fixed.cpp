@@ -1,8 +1,15 @@
 /**
  * @brief Fixed linear regression implementation details.
  */
+#include <math.h>
+#include <string.h>
+
+#include "ml/batch.h"
 #include "ml/lin_reg/fixed.h"
+#include "ml/lin_reg/least_squares.h"
+#include "ml/lin_reg/training.h"
 #include "ml/types.h"
+#include "utils/random.h"
 
 namespace ml
 {
@@ -16,11 +23,31 @@ constexpr size_t min(const size_t x, const size_t y) noexcept
     return x < y ? x : y;
 }
 
+/** The size of the serialized weight and bias in bytes. */
+constexpr uint8_t SerializedSize{2U * sizeof(double)};
+
 // -----------------------------------------------------------------------------
 constexpr bool isLearningRateValid(const double learningRate) noexcept
 {
     return (0.0 < learningRate) && (1.0 >= learningRate);
 }
+
+// -----------------------------------------------------------------------------
+void shuffle(Matrix1d& trainIn, Matrix2d& trainOut, const size_t setCount, 
+             utils::Random& random) noexcept
+{
+    // Swap each training set with a randomly selected set at or before it (Fisher-Yates).
+    for (size_t i{setCount - 1U}; 0U < i; --i)
+    {
+        const size_t j{random.below(static_cast<uint32_t>(i + 1U))};
+        const double input{trainIn[i]};
+        const double output{trainOut[i]};
+        trainIn[i]  = trainIn[j];
+        trainOut[i] = trainOut[j];
+        trainIn[j]  = input;
+        trainOut[j] = output;
+    }
+}
 } // namespace
 
 // -----------------------------------------------------------------------------
@@ -30,12 +57,53 @@ Fixed::Fixed() noexcept
     , myTrained{false}
 {}
 
+// -----------------------------------------------------------------------------
+Fixed::Fixed(const Parameters& parameters) noexcept
+    : myWeight{parameters.valid ? parameters.weight : 0.0}
+    , myBias{parameters.valid ? parameters.bias : 0.0}
+    , myTrained{parameters.valid}
+{}
+
 // -----------------------------------------------------------------------------
 bool Fixed::isTrained() const noexcept { return myTrained; }
 
 // -----------------------------------------------------------------------------
 double Fixed::predict(const double input) const noexcept { return myWeight * input + myBias; }
 
+// -----------------------------------------------------------------------------
+bool Fixed::predictBatch(const double* input, double* output, const size_t count) const noexcept
+{
+    return batch::affine(input, output, count, myWeight, myBias);
+}
+
+// -----------------------------------------------------------------------------
+uint8_t Fixed::serializedSize() const noexcept { return SerializedSize; }
+
+// -----------------------------------------------------------------------------
+bool Fixed::serialize(uint8_t* data, const uint8_t size) const noexcept
+{
+    // Check the parameters, return false if invalid or if the model isn't trained.
+    if ((nullptr == data) || (SerializedSize > size) || !myTrained) { return false; }
+
+    // Copy the weight followed by the bias in the native floating-point format.
+    memcpy(data, &myWeight, sizeof(myWeight));
+    memcpy(data + sizeof(myWeight), &myBias, sizeof(myBias));
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+bool Fixed::deserialize(const uint8_t* data, const uint8_t size) noexcept
+{
+    // Check the parameters, return false if invalid.
+    if ((nullptr == data) || (SerializedSize != size)) { return false; }
+
+    // Restore the weight and bias, the model is trained afterwards.
+    memcpy(&myWeight, data, sizeof(myWeight));
+    memcpy(&myBias, data + sizeof(myWeight), sizeof(myBias));
+    myTrained = true;
+    return true;
+}
+
 // -----------------------------------------------------------------------------
 bool Fixed::train(const Matrix1d& trainIn, const Matrix2d& trainOut, const size_t epochCount, 
                    const double learningRate) noexcept
@@ -54,29 +122,102 @@ bool Fixed::train(const Matrix1d& trainIn, const Matrix2d& trainOut, const size_
     // Train the model the specified number of epochs.
     for (size_t epoch{}; epoch < epochCount; ++epoch)
     {
-        // Iterate through all training sets, skip randomization for simplicity.
-        for (size_t i{}; i < setCount; ++i)
+        trainEpoch(trainIn, trainOut, setCount, learningRate);
+    }
+    // Return true to indicate success.
+    myTrained = true;
+    return myTrained;
+}
+
+// -----------------------------------------------------------------------------
+TrainingReport Fixed::train(Matrix1d& trainIn, Matrix2d& trainOut, 
+                            const TrainingOptions& options) noexcept
+{
+    TrainingReport report{0U, 0.0, false, false};
+
+    // Check the options, return an invalid report if invalid.
+    if ((0U == options.epochCount) || !isLearningRateValid(options.learningRate) || 
+        (0.0 > options.minLossDelta)) 
+    { 
+        return report; 
+    }
+
+    // Check the training set count, return an invalid report if invalid.
+    const size_t setCount{min(trainIn.size(), trainOut.size())};
+    if (0U == setCount) { return report; }
+
+    // Clear the trainable parameters before starting training.
+    utils::Random random{options.seed};
+    myWeight = 0.0;
+    myBias   = 0.0;
+
+    // Train the model until the loss stops improving or the maximum epoch count is reached.
+    while (report.epochCount < options.epochCount)
+    {
+        if (options.shuffle) { shuffle(trainIn, trainOut, setCount, random); }
+        const double loss{trainEpoch(trainIn, trainOut, setCount, options.learningRate)};
+        const double lossDelta{fabs(report.loss - loss)};
+        report.loss = loss;
+
+        if ((0U < report.epochCount++) && (options.minLossDelta > lossDelta))
         {
-            optimize(trainIn[i], trainOut[i], learningRate);
+            report.converged = true;
+            break;
         }
     }
-    // Return true to indicate success.
+    myTrained    = true;
+    report.valid = myTrained;
+    return report;
+}
+
+// -----------------------------------------------------------------------------
+bool Fixed::trainLeastSquares(const Matrix1d& trainIn, const Matrix2d& trainOut) noexcept
+{
+    // Check the training set count, return false if invalid.
+    const size_t setCount{min(trainIn.size(), trainOut.size())};
+    if (0U == setCount) { return false; }
+
+    // Accumulate the training sets, then solve for the weight and bias.
+    LeastSquares accumulator{};
+    for (size_t i{}; i < setCount; ++i) { accumulator.add(trainIn[i], trainOut[i]); }
+    const Parameters parameters{accumulator.solve()};
+
+    // Return false if all inputs are equal, since the weight is undefined.
+    if (!parameters.valid) { return false; }
+    myWeight  = parameters.weight;
+    myBias    = parameters.bias;
     myTrained = true;
     return myTrained;
 }
 
 // -----------------------------------------------------------------------------
-void Fixed::optimize(const double input, const double output, const double learningRate) noexcept
+double Fixed::trainEpoch(const Matrix1d& trainIn, const Matrix2d& trainOut, 
+                         const size_t setCount, const double learningRate) noexcept
+{
+    // Iterate through all training sets, accumulating the squared error of each prediction.
+    double squaredErrorSum{};
+    for (size_t i{}; i < setCount; ++i)
+    {
+        const double error{optimize(trainIn[i], trainOut[i], learningRate)};
+        squaredErrorSum += error * error;
+    }
+    return squaredErrorSum / static_cast<double>(setCount);
+}
+
+// -----------------------------------------------------------------------------
+double Fixed::optimize(const double input, const double output, const double learningRate) noexcept
 {
     // Check the input, directly set bias to output if 0.0 (special case).
     // Otherwise, apply gradient descent to update both weight and bias.
+    const double error{output - predict(input)};
     if (0.0 == input) { myBias = output; }
     else
     {
-        const double error{output - predict(input)};
         myBias   += error * learningRate;
         myWeight += error * learningRate * input;
     }
+    // Return the error before the update.
+    return error;
 }
 } // namespace lin_reg
 } // namespace ml
\ No newline at end of file
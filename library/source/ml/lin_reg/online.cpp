@@ -0,0 +1,143 @@
+/**
+ * @brief Online linear regression implementation details.
+ */
+#include <string.h>
+
+#include "ml/batch.h"
+#include "ml/lin_reg/online.h"
+#include "ml/types.h"
+
+namespace ml
+{
+namespace lin_reg
+{
+namespace
+{
+/** The number of measurements required to determine both weight and bias. */
+constexpr uint8_t MinUpdateCount{2U};
+
+/** The number of serialized parameters: weight, bias and the three covariance elements. */
+constexpr uint8_t SerializedCount{5U};
+
+/** The size of the serialized parameters in bytes. */
+constexpr uint8_t SerializedSize{SerializedCount * sizeof(double)};
+
+// -----------------------------------------------------------------------------
+constexpr size_t min(const size_t x, const size_t y) noexcept { return x < y ? x : y; }
+} // namespace
+
+// -----------------------------------------------------------------------------
+Online::Online(const double forgettingFactor, const double initialCovariance) noexcept
+    : myWeight{}
+    , myBias{}
+    , myWeightVariance{}
+    , myCovariance{}
+    , myBiasVariance{}
+    , myForgettingFactor{(0.0 < forgettingFactor) && (1.0 >= forgettingFactor) 
+                         ? forgettingFactor : 1.0}
+    , myInitialCovariance{0.0 < initialCovariance ? initialCovariance : 1000.0}
+    , myUpdateCount{}
+{
+    reset();
+}
+
+// -----------------------------------------------------------------------------
+bool Online::isTrained() const noexcept { return MinUpdateCount <= myUpdateCount; }
+
+// -----------------------------------------------------------------------------
+double Online::predict(const double input) const noexcept { return myWeight * input + myBias; }
+
+// -----------------------------------------------------------------------------
+bool Online::predictBatch(const double* input, double* output, const size_t count) const noexcept
+{
+    return batch::affine(input, output, count, myWeight, myBias);
+}
+
+// -----------------------------------------------------------------------------
+uint8_t Online::serializedSize() const noexcept { return SerializedSize; }
+
+// -----------------------------------------------------------------------------
+bool Online::serialize(uint8_t* data, const uint8_t size) const noexcept
+{
+    // Check the parameters, return false if invalid or if the model isn't trained.
+    if ((nullptr == data) || (SerializedSize > size) || !isTrained()) { return false; }
+
+    // Copy the parameters followed by the covariance in the native floating-point format.
+    const double parameters[SerializedCount]{
+        myWeight, myBias, myWeightVariance, myCovariance, myBiasVariance};
+    memcpy(data, parameters, SerializedSize);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+bool Online::deserialize(const uint8_t* data, const uint8_t size) noexcept
+{
+    // Check the parameters, return false if invalid.
+    if ((nullptr == data) || (SerializedSize != size)) { return false; }
+
+    // Restore the parameters and the covariance, the model is trained afterwards.
+    double parameters[SerializedCount]{};
+    memcpy(parameters, data, SerializedSize);
+    myWeight         = parameters[0U];
+    myBias           = parameters[1U];
+    myWeightVariance = parameters[2U];
+    myCovariance     = parameters[3U];
+    myBiasVariance   = parameters[4U];
+    myUpdateCount    = MinUpdateCount;
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+bool Online::update(const double input, const double output) noexcept
+{
+    // Compute P * x for the measurement vector x = [input, 1].
+    const double gainWeight{myWeightVariance * input + myCovariance};
+    const double gainBias{myCovariance * input + myBiasVariance};
+
+    // Return false if the innovation variance is invalid, which only occurs due to rounding.
+    const double denominator{myForgettingFactor + input * gainWeight + gainBias};
+    if (!(0.0 < denominator)) { return false; }
+
+    // Move the parameters towards the measurement, weighted by the gain P * x / denominator.
+    const double error{output - predict(input)};
+    myWeight += gainWeight / denominator * error;
+    myBias   += gainBias / denominator * error;
+
+    // Update the covariance, P = (P - P * x * x^T * P / denominator) / forgetting factor.
+    const double scale{1.0 / myForgettingFactor};
+    myWeightVariance = (myWeightVariance - gainWeight * gainWeight / denominator) * scale;
+    myCovariance     = (myCovariance - gainWeight * gainBias / denominator) * scale;
+    myBiasVariance   = (myBiasVariance - gainBias * gainBias / denominator) * scale;
+
+    if (MinUpdateCount > myUpdateCount) { ++myUpdateCount; }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+bool Online::train(const Matrix1d& trainIn, const Matrix2d& trainOut) noexcept
+{
+    // Check the training set count, return false if invalid.
+    const size_t setCount{min(trainIn.size(), trainOut.size())};
+    if (MinUpdateCount > setCount) { return false; }
+
+    // Add each training set as a measurement, starting from scratch.
+    reset();
+    for (size_t i{}; i < setCount; ++i)
+    {
+        if (!update(trainIn[i], trainOut[i])) { return false; }
+    }
+    return isTrained();
+}
+
+// -----------------------------------------------------------------------------
+void Online::reset() noexcept
+{
+    myWeight         = 0.0;
+    myBias           = 0.0;
+    myWeightVariance = myInitialCovariance;
+    myCovariance     = 0.0;
+    myBiasVariance   = myInitialCovariance;
+    myUpdateCount    = 0U;
+}
+} // namespace lin_reg
+} // namespace ml
@@ -0,0 +1,85 @@
+/**
+ * @brief Persistent storage of linear regression models implementation details.
+ */
+#include <stdint.h>
+
+#include "driver/eeprom/interface.h"
+#include "ml/lin_reg/interface.h"
+#include "ml/lin_reg/storage.h"
+#include "utils/codec.h"
+
+namespace ml
+{
+namespace lin_reg
+{
+namespace storage
+{
+namespace
+{
+/** The size of the record header (version and parameter size) in bytes. */
+constexpr uint8_t HeaderSize{2U};
+
+/** Maximum size of the record, excluding the checksum, in bytes. */
+constexpr uint8_t MaxDataSize{HeaderSize + MaxParameterSize};
+} // namespace
+
+// -----------------------------------------------------------------------------
+uint16_t recordSize(const Interface& model) noexcept
+{
+    return model.serializedSize() + RecordOverhead;
+}
+
+// -----------------------------------------------------------------------------
+bool save(const Interface& model, driver::eeprom::Interface& eeprom, 
+          const uint16_t address) noexcept
+{
+    // Check the model, return false if the parameters are too large.
+    const uint8_t parameterSize{model.serializedSize()};
+    if (MaxParameterSize < parameterSize) { return false; }
+
+    // Create the record in RAM, return false if the model isn't trained.
+    uint8_t data[MaxDataSize]{Version, parameterSize};
+    if (!model.serialize(data + HeaderSize, parameterSize)) { return false; }
+    const uint8_t dataSize{static_cast<uint8_t>(HeaderSize + parameterSize)};
+    const uint16_t checksum{utils::crc::crc16(data, dataSize)};
+
+    // Write the record followed by the checksum, return false if any write fails.
+    for (uint8_t i{}; i < dataSize; ++i)
+    {
+        if (!eeprom.write(address + i, data[i])) { return false; }
+    }
+    return eeprom.write(address + dataSize, checksum);
+}
+
+// -----------------------------------------------------------------------------
+bool load(Interface& model, const driver::eeprom::Interface& eeprom, 
+          const uint16_t address) noexcept
+{
+    // Read the header, return false if the version or the parameter size doesn't match.
+    uint8_t data[MaxDataSize]{};
+    if (!eeprom.read(address, data[0U]) || !eeprom.read(address + 1U, data[1U]) ||
+        (Version != data[0U]) || (model.serializedSize() != data[1U]) || 
+        (MaxParameterSize < data[1U]))
+    {
+        return false;
+    }
+
+    // Read the parameters and the checksum, return false if the record is corrupt.
+    const uint8_t dataSize{static_cast<uint8_t>(HeaderSize + data[1U])};
+    for (uint8_t i{HeaderSize}; i < dataSize; ++i)
+    {
+        if (!eeprom.read(address + i, data[i])) { return false; }
+    }
+    uint16_t checksum{};
+    if (!eeprom.read(address + dataSize, checksum) || 
+        (utils::crc::crc16(data, dataSize) != checksum))
+    {
+        return false;
+    }
+
+    // Restore the model parameters.
+    return model.deserialize(data + HeaderSize, data[1U]);
+}
+} // namespace storage
+} // namespace lin_reg
+} // namespace ml
@@ -0,0 +1,71 @@
+/**
+ * @brief Implementation details of fixed-point activation functions.
+ */
+#include "arch/avr/hw_platform.h"
+#include "ml/nn/activation.h"
+
+namespace ml
+{
+namespace nn
+{
+namespace
+{
+/** The number of low-order input bits between two table entries, which are 1/32 apart. */
+constexpr uint8_t TanhStepBits{ActivationFracBits - 5U};
+
+/** The largest input of the hyperbolic tangent table in Q12 format (4.0). */
+constexpr int16_t TanhMaxInput{4 << ActivationFracBits};
+
+/** The index of the last hyperbolic tangent table entry. */
+constexpr uint8_t TanhLastIndex{TanhMaxInput >> TanhStepBits};
+
+/** tanh(i / 32) in Q12 format for i in [0, 128]. */
+constexpr uint16_t TanhTable[TanhLastIndex + 1U] PROGMEM{
+       0,  128,  256,  383,  509,  635,  759,  882, 1003, 1123, 1240, 1355,
+    1468, 1578, 1686, 1791, 1893, 1992, 2088, 2181, 2272, 2359, 2443, 2524,
+    2602, 2676, 2748, 2817, 2883, 2946, 3007, 3064, 3119, 3172, 3222, 3270,
+    3315, 3358, 3399, 3438, 3475, 3510, 3543, 3574, 3604, 3632, 3659, 3684,
+    3707, 3730, 3751, 3771, 3790, 3808, 3825, 3841, 3856, 3870, 3883, 3896,
+    3908, 3919, 3929, 3939, 3949, 3957, 3966, 3973, 3981, 3988, 3994, 4000,
+    4006, 4011, 4016, 4021, 4026, 4030, 4034, 4038, 4041, 4044, 4048, 4050,
+    4053, 4056, 4058, 4061, 4063, 4065, 4067, 4068, 4070, 4072, 4073, 4074,
+    4076, 4077, 4078, 4079, 4080, 4081, 4082, 4083, 4084, 4084, 4085, 4086,
+    4086, 4087, 4088, 4088, 4089, 4089, 4089, 4090, 4090, 4091, 4091, 4091,
+    4091, 4092, 4092, 4092, 4092, 4093, 4093, 4093, 4093,
+};
+
+// -----------------------------------------------------------------------------
+int16_t tanh(const int16_t value) noexcept
+{
+    // Saturate beyond the end of the table.
+    const int16_t max{static_cast<int16_t>(pgm_read_word(&TanhTable[TanhLastIndex]))};
+    if (TanhMaxInput <= value) { return max; }
+    if (-TanhMaxInput >= value) { return static_cast<int16_t>(-max); }
+
+    // Interpolate linearly between the two table entries surrounding the absolute value.
+    const int16_t magnitude{0 <= value ? value : static_cast<int16_t>(-value)};
+    constexpr int16_t stepMask{(1 << TanhStepBits) - 1};
+    const uint8_t index{static_cast<uint8_t>(magnitude >> TanhStepBits)};
+    const int16_t lower{static_cast<int16_t>(pgm_read_word(&TanhTable[index]))};
+    const int16_t upper{static_cast<int16_t>(pgm_read_word(&TanhTable[index + 1U]))};
+    const int16_t result{static_cast<int16_t>(
+        lower + (((upper - lower) * (magnitude & stepMask)) >> TanhStepBits))};
+    return 0 <= value ? result : static_cast<int16_t>(-result);
+}
+} // namespace
+
+// -----------------------------------------------------------------------------
+int16_t activate(const Activation activation, const int16_t value) noexcept
+{
+    switch (activation)
+    {
+        case Activation::Relu:
+            return 0 < value ? value : 0;
+        case Activation::Tanh:
+            return tanh(value);
+        default:
+            return value;
+    }
+}
+} // namespace nn
+} // namespace ml
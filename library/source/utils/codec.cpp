@@ -0,0 +1,167 @@
+/**
+ * @brief Implementation details of byte-level encoding utilities.
+ */
+#include "utils/codec.h"
+
+namespace utils
+{
+namespace crc
+{
+// -----------------------------------------------------------------------------
+uint16_t crc16(const uint8_t* data, const size_t size, uint16_t crc) noexcept
+{
+    // Return the initial value if no data is given.
+    if (nullptr == data) { return crc; }
+
+    // Calculate the checksum bit by bit to avoid storing a lookup table in flash.
+    constexpr uint16_t polynomial{0x1021U};
+    constexpr uint16_t msb{0x8000U};
+
+    for (size_t i{}; i < size; ++i)
+    {
+        crc ^= static_cast<uint16_t>(data[i] << 8U);
+
+        for (uint8_t bit{}; bit < 8U; ++bit)
+        {
+            crc = (crc & msb) ? static_cast<uint16_t>((crc << 1U) ^ polynomial)
+                              : static_cast<uint16_t>(crc << 1U);
+        }
+    }
+    return crc;
+}
+} // namespace crc
+
+namespace cobs
+{
+// -----------------------------------------------------------------------------
+size_t encode(const uint8_t* source, const size_t size, uint8_t* destination,
+              const size_t destinationSize) noexcept
+{
+    // Check the input parameters, return 0 if invalid.
+    if ((nullptr == source) || (nullptr == destination) ||
+        (maxEncodedSize(size) > destinationSize)) { return 0U; }
+
+    // Maximum distance between two code bytes.
+    constexpr uint8_t maxCode{0xFFU};
+
+    size_t codeIndex{0U};
+    size_t writeIndex{1U};
+    uint8_t code{1U};
+
+    for (size_t i{}; i < size; ++i)
+    {
+        // Replace each zero byte with the distance to the next zero byte.
+        if (Delimiter == source[i])
+        {
+            destination[codeIndex] = code;
+            codeIndex              = writeIndex++;
+            code                   = 1U;
+        }
+        else
+        {
+            destination[writeIndex++] = source[i];
+
+            // Insert a new code byte when the maximum block length has been reached.
+            if (maxCode == ++code)
+            {
+                destination[codeIndex] = code;
+                codeIndex              = writeIndex++;
+                code                   = 1U;
+            }
+        }
+    }
+    // Write the final code byte, return the size of the encoded data.
+    destination[codeIndex] = code;
+    return writeIndex;
+}
+
+// -----------------------------------------------------------------------------
+size_t decode(const uint8_t* source, const size_t size, uint8_t* destination,
+              const size_t destinationSize) noexcept
+{
+    // Check the input parameters, return 0 if invalid.
+    if ((nullptr == source) || (nullptr == destination) || (0U == size)) { return 0U; }
+
+    // Maximum distance between two code bytes.
+    constexpr uint8_t maxCode{0xFFU};
+
+    size_t readIndex{0U};
+    size_t writeIndex{0U};
+
+    while (readIndex < size)
+    {
+        // Each code byte holds the distance to the next zero byte, return 0 if corrupt.
+        const uint8_t code{source[readIndex++]};
+        if ((Delimiter == code) || (readIndex + code - 1U > size)) { return 0U; }
+
+        // Copy the data bytes following the code byte.
+        for (uint8_t i{1U}; i < code; ++i)
+        {
+            if ((destinationSize <= writeIndex) || (Delimiter == source[readIndex]))
+            {
+                return 0U;
+            }
+            destination[writeIndex++] = source[readIndex++];
+        }
+
+        // Restore the replaced zero byte unless this is the end of a maximum-length block
+        // or the end of the data.
+        if ((maxCode != code) && (readIndex < size))
+        {
+            if (destinationSize <= writeIndex) { return 0U; }
+            destination[writeIndex++] = Delimiter;
+        }
+    }
+    // Return the size of the decoded data.
+    return writeIndex;
+}
+} // namespace cobs
+
+namespace varint
+{
+// -----------------------------------------------------------------------------
+uint8_t encode(uint32_t value, uint8_t* destination, const size_t destinationSize) noexcept
+{
+    // Check the input parameters, return 0 if invalid.
+    if (nullptr == destination) { return 0U; }
+
+    constexpr uint8_t dataMask{0x7FU};
+    constexpr uint8_t continueFlag{0x80U};
+    uint8_t bytesWritten{};
+
+    // Write seven bits at a time, set the continue flag if more bits remain.
+    do
+    {
+        if (destinationSize <= bytesWritten) { return 0U; }
+        uint8_t byte{static_cast<uint8_t>(value & dataMask)};
+        value >>= 7U;
+        if (0U != value) { byte |= continueFlag; }
+        destination[bytesWritten++] = byte;
+    } while (0U != value);
+
+    // Return the number of bytes written.
+    return bytesWritten;
+}
+
+// -----------------------------------------------------------------------------
+uint8_t decode(const uint8_t* source, const size_t size, uint32_t& value) noexcept
+{
+    // Check the input parameters, return 0 if invalid.
+    if (nullptr == source) { return 0U; }
+
+    constexpr uint8_t dataMask{0x7FU};
+    constexpr uint8_t continueFlag{0x80U};
+    value = 0U;
+
+    // Read seven bits at a time until a byte without the continue flag is found.
+    for (uint8_t i{}; (i < size) && (i < MaxSize); ++i)
+    {
+        value |= static_cast<uint32_t>(source[i] & dataMask) << (7U * i);
+        if (!(source[i] & continueFlag)) { return i + 1U; }
+    }
+    // Return 0 if the varint is truncated or too long.
+    value = 0U;
+    return 0U;
+}
+} // namespace varint
+} // namespace utils
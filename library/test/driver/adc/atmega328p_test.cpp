@@ -7,12 +7,19 @@
 
 #include "arch/avr/hw_platform.h"
 #include "driver/adc/atmega328p.h"
+#include "driver/adc/sequencer.h"
 #include "utils/utils.h"
 
 #ifdef TESTSUITE
 
 namespace driver
 {
+namespace adc
+{
+/** ADC conversion-complete interrupt service routine. */
+void ADC_vect() noexcept;
+} // namespace adc
+
 namespace
 {
 // -----------------------------------------------------------------------------
@@ -108,6 +115,10 @@ TEST(Adc_Atmega328p, Read)
                 EXPECT_EQ(adc.read(pin), adcVal); 
                 EXPECT_EQ(adc.dutyCycle(pin), computeDutyCycle(adcVal));
                 EXPECT_EQ(adc.inputVoltage(pin), computeInputVoltage(adcVal));
+                EXPECT_EQ(adc.inputVoltage_mV(pin), 
+                          utils::round<std::uint16_t>(computeInputVoltage(adcVal) * 1000.0));
+                EXPECT_EQ(adc.readScaled(pin, 50000U), 
+                          utils::round<std::uint16_t>(computeInputVoltage(adcVal) * 10000.0));
             }
             else 
             { 
@@ -116,10 +127,410 @@ TEST(Adc_Atmega328p, Read)
                 EXPECT_EQ(adc.read(pin), defaultAdcVal); 
                 EXPECT_EQ(adc.dutyCycle(pin), defaultAdcVal);
                 EXPECT_EQ(adc.inputVoltage(pin), defaultAdcVal);
+                EXPECT_EQ(adc.inputVoltage_mV(pin), defaultAdcVal);
+                EXPECT_EQ(adc.readScaled(pin, 50000U), defaultAdcVal);
             }
         }
     }
 }
+
+/**
+ * @brief ADC sampling test.
+ * 
+ *        Verify that continuous sampling configures auto triggering, and that the samples 
+ *        stored by the conversion-complete interrupt can be consumed without blocking.
+ */
+TEST(Adc_Atmega328p, Sampling)
+{
+    // Set up the ADC.
+    adc::Interface& adc{setupAdc()};
+    using Pin = adc::Atmega328p::Pin;
+
+    // Case 1 - Expect sampling to be rejected for invalid channels and triggers.
+    {
+        EXPECT_FALSE(adc.startSampling(6U));
+        EXPECT_FALSE(adc.startSampling(Pin::A1, adc::Trigger::Count));
+        EXPECT_FALSE(adc.isSampling());
+    }
+
+    // Case 2 - Start free running sampling, expect auto triggering and the interrupt to be 
+    // enabled and the first conversion to be started. Expect global interrupts to stay 
+    // enabled.
+    {
+        utils::globalInterruptEnable();
+        EXPECT_TRUE(adc.startSampling(Pin::A1));
+        EXPECT_TRUE(adc.isSampling());
+        EXPECT_EQ(ADMUX, (1U << REFS0) | Pin::A1);
+        EXPECT_EQ(ADCSRB, 0U);
+        EXPECT_TRUE(utils::read(ADCSRA, ADEN, ADATE, ADIE, ADSC));
+        EXPECT_TRUE(utils::read(SREG, I_FLAG));
+
+        // Expect blocking reads to be unavailable while sampling.
+        ADC = 100U;
+        EXPECT_EQ(adc.read(Pin::A1), 0U);
+    }
+
+    // Case 3 - Simulate conversions, expect the samples to be consumed in order.
+    {
+        std::uint16_t sample{};
+        EXPECT_FALSE(adc.readSample(sample));
+
+        for (std::uint16_t i{}; i < 10U; ++i)
+        {
+            ADC = i * 100U;
+            adc::ADC_vect();
+        }
+        EXPECT_EQ(adc.pendingSamples(), 10U);
+
+        for (std::uint16_t i{}; i < 10U; ++i)
+        {
+            EXPECT_TRUE(adc.readSample(sample));
+            EXPECT_EQ(sample, i * 100U);
+        }
+        EXPECT_EQ(adc.pendingSamples(), 0U);
+    }
+
+    // Case 4 - Simulate more conversions than the sample buffer can hold, expect the 
+    // surplus samples to be dropped.
+    {
+        for (std::uint16_t i{}; i < 40U; ++i) { adc::ADC_vect(); }
+        EXPECT_EQ(adc.pendingSamples(), 32U);
+        EXPECT_EQ(adc.droppedSamples(), 8U);
+    }
+
+    // Case 5 - Restart sampling with a timer trigger, expect the trigger source to be 
+    // selected and the sample buffer to be cleared. Start with global interrupts disabled, 
+    // expect them to stay disabled.
+    {
+        ADCSRA = 0U;
+        utils::globalInterruptDisable();
+        EXPECT_TRUE(adc.startSampling(adc::Atmega328p::Port::C2, adc::Trigger::Timer0Overflow));
+        EXPECT_FALSE(utils::read(SREG, I_FLAG));
+        utils::globalInterruptEnable();
+        EXPECT_EQ(ADMUX, (1U << REFS0) | Pin::A2);
+        EXPECT_TRUE(utils::read(ADCSRB, ADTS2));
+        EXPECT_FALSE(utils::read(ADCSRB, ADTS0));
+        EXPECT_FALSE(utils::read(ADCSRB, ADTS1));
+        EXPECT_FALSE(utils::read(ADCSRA, ADSC));
+        EXPECT_EQ(adc.pendingSamples(), 0U);
+        EXPECT_EQ(adc.droppedSamples(), 0U);
+    }
+
+    // Case 6 - Stop sampling, expect auto triggering to be disabled and blocking reads to 
+    // be available again.
+    {
+        adc.stopSampling();
+        EXPECT_FALSE(adc.isSampling());
+        EXPECT_FALSE(utils::read(ADCSRA, ADATE));
+        EXPECT_FALSE(utils::read(ADCSRA, ADIE));
+
+        utils::set(ADCSRA, ADIF);
+        ADC = 100U;
+        EXPECT_EQ(adc.read(Pin::A1), 100U);
+    }
+}
+
+/**
+ * @brief ADC scan test.
+ * 
+ *        Verify that the conversion-complete interrupt cycles the multiplexer through the 
+ *        channels of a sequencer and that a snapshot is published once per complete scan.
+ */
+TEST(Adc_Atmega328p, Scan)
+{
+    // Set up the ADC and a sequencer scanning A0, C3 and A5.
+    adc::Interface& adc{setupAdc()};
+    using Pin = adc::Atmega328p::Pin;
+    adc::Sequencer sequencer{adc};
+    constexpr std::uint8_t channels[]{Pin::A0, adc::Atmega328p::Port::C3, Pin::A5};
+
+    // Case 1 - Expect scanning to be rejected without channels.
+    {
+        EXPECT_FALSE(adc.startScan(sequencer));
+        EXPECT_FALSE(adc.isSampling());
+    }
+
+    // Case 2 - Start free running scanning, expect the first channel to be selected.
+    {
+        EXPECT_TRUE(sequencer.setChannels(channels, 3U));
+        EXPECT_TRUE(adc.startScan(sequencer));
+        EXPECT_TRUE(adc.isSampling());
+        EXPECT_EQ(ADMUX, (1U << REFS0) | Pin::A0);
+        EXPECT_TRUE(utils::read(ADCSRA, ADEN, ADATE, ADIE, ADSC));
+    }
+
+    // Case 3 - Simulate conversions, expect the multiplexer to cycle through the channels, 
+    // the first conversion after each switch to be discarded and a snapshot to be published
+    // once all channels have been converted.
+    {
+        constexpr std::uint8_t expected[]{Pin::A3, Pin::A3, Pin::A5, Pin::A5, Pin::A0};
+        adc::Sequencer::Snapshot snapshot{};
+
+        for (std::uint8_t i{}; i < 5U; ++i)
+        {
+            EXPECT_FALSE(sequencer.snapshot(snapshot));
+            ADC = 100U * (i + 1U);
+            adc::ADC_vect();
+            EXPECT_EQ(ADMUX, (1U << REFS0) | expected[i]);
+        }
+        EXPECT_TRUE(sequencer.snapshot(snapshot));
+        EXPECT_EQ(snapshot.channelCount, 3U);
+        EXPECT_EQ(snapshot.sequence, 1U);
+        EXPECT_EQ(snapshot.values[0U], 100U);
+        EXPECT_EQ(snapshot.values[1U], 300U);
+        EXPECT_EQ(snapshot.values[2U], 500U);
+
+        // Expect the sample buffer to be bypassed while scanning.
+        EXPECT_EQ(adc.pendingSamples(), 0U);
+    }
+
+    // Case 4 - Stop scanning, expect conversions to be stored in the sample buffer again 
+    // when sampling is restarted.
+    {
+        adc.stopSampling();
+        EXPECT_FALSE(adc.isSampling());
+        EXPECT_TRUE(adc.startSampling(Pin::A1));
+        adc::ADC_vect();
+        EXPECT_EQ(adc.pendingSamples(), 1U);
+        adc.stopSampling();
+    }
+}
+
+/**
+ * @brief ADC oversampling test.
+ * 
+ *        Verify that 4^n conversions are accumulated and decimated by n bits, both for 
+ *        blocking reads and continuous sampling, and that the effective resolution is reported.
+ */
+TEST(Adc_Atmega328p, Oversampling)
+{
+    // Set up the ADC.
+    adc::Interface& adc{setupAdc()};
+    using Pin = adc::Atmega328p::Pin;
+
+    // Case 1 - Expect unsupported numbers of extra bits to be rejected.
+    {
+        EXPECT_FALSE(adc.setOversampling(adc::Atmega328p::MaxOversampling + 1U));
+        EXPECT_EQ(adc.oversampling(), 0U);
+        EXPECT_EQ(adc.resolution(), 10U);
+        EXPECT_EQ(adc.maxValue(), 1023U);
+    }
+
+    // Case 2 - Add two extra bits, expect a 12-bit resolution to be reported.
+    {
+        EXPECT_TRUE(adc.setOversampling(2U));
+        EXPECT_EQ(adc.oversampling(), 2U);
+        EXPECT_EQ(adc.resolution(), 12U);
+        EXPECT_EQ(adc.maxValue(), 4095U);
+    }
+
+    // Case 3 - Expect blocking reads to return the decimated sum of 16 conversions.
+    {
+        utils::set(ADCSRA, ADIF);
+        ADC = 1023U;
+        EXPECT_EQ(adc.read(Pin::A0), 4092U);
+        ADC = 500U;
+        EXPECT_EQ(adc.read(Pin::A0), 2000U);
+        EXPECT_DOUBLE_EQ(adc.dutyCycle(Pin::A0), 2000.0 / 4095.0);
+    }
+
+    // Case 4 - Start sampling, expect one sample to be stored per 16 conversions and 
+    // oversampling to be locked while sampling.
+    {
+        EXPECT_TRUE(adc.startSampling(Pin::A0));
+        EXPECT_FALSE(adc.setOversampling(0U));
+
+        for (std::uint16_t i{}; i < 16U; ++i)
+        {
+            EXPECT_EQ(adc.pendingSamples(), 0U);
+            ADC = i % 2U ? 101U : 100U;
+            adc::ADC_vect();
+        }
+        std::uint16_t sample{};
+        EXPECT_EQ(adc.pendingSamples(), 1U);
+        EXPECT_TRUE(adc.readSample(sample));
+        EXPECT_EQ(sample, 402U);
+        adc.stopSampling();
+    }
+
+    // Case 5 - Add the maximum number of extra bits, expect a 14-bit full scale value.
+    {
+        EXPECT_TRUE(adc.setOversampling(adc::Atmega328p::MaxOversampling));
+        EXPECT_EQ(adc.resolution(), 14U);
+        EXPECT_EQ(adc.maxValue(), 16383U);
+        ADC = 1023U;
+        EXPECT_EQ(adc.read(Pin::A0), 16368U);
+    }
+
+    // Case 6 - Disable oversampling, expect the native resolution to be restored.
+    {
+        EXPECT_TRUE(adc.setOversampling(0U));
+        EXPECT_EQ(adc.resolution(), 10U);
+        EXPECT_EQ(adc.maxValue(), 1023U);
+        EXPECT_EQ(adc.read(Pin::A0), 1023U);
+    }
+}
+
+/**
+ * @brief ADC noise reduction test.
+ * 
+ *        Verify that blocking reads in noise reduction mode sleep in ADC noise reduction mode
+ *        until woken up by the conversion-complete interrupt.
+ */
+TEST(Adc_Atmega328p, NoiseReduction)
+{
+    // Set up the ADC, let the simulated conversions run the conversion-complete interrupt.
+    adc::Interface& adc{setupAdc()};
+    using Pin = adc::Atmega328p::Pin;
+    test::setAdcInterrupt(adc::ADC_vect);
+    SMCR = 0U;
+
+    // Case 1 - Expect invalid read modes to be rejected.
+    {
+        EXPECT_EQ(adc.readMode(), adc::ReadMode::Polling);
+        EXPECT_FALSE(adc.setReadMode(adc::ReadMode::Count));
+        EXPECT_EQ(adc.readMode(), adc::ReadMode::Polling);
+    }
+
+    // Case 2 - Expect polling reads not to sleep.
+    {
+        const std::uint32_t sleepCount{test::sleepCount()};
+        ADC = 256U;
+        EXPECT_EQ(adc.read(Pin::A2), 256U);
+        EXPECT_EQ(test::sleepCount(), sleepCount);
+    }
+
+    // Case 3 - Read in noise reduction mode, expect the CPU to sleep once in ADC noise 
+    // reduction mode and sleep and the interrupt to be disabled afterwards. Expect global 
+    // interrupts to stay enabled.
+    {
+        const std::uint32_t sleepCount{test::sleepCount()};
+        utils::globalInterruptEnable();
+        EXPECT_TRUE(adc.setReadMode(adc::ReadMode::NoiseReduction));
+        EXPECT_EQ(adc.readMode(), adc::ReadMode::NoiseReduction);
+
+        ADC = 512U;
+        EXPECT_EQ(adc.read(Pin::A2), 512U);
+        EXPECT_EQ(ADMUX, (1U << REFS0) | Pin::A2);
+        EXPECT_EQ(test::sleepCount(), sleepCount + 1U);
+        EXPECT_TRUE(utils::read(SMCR, SM0));
+        EXPECT_FALSE(utils::read(SMCR, SE, SM1, SM2));
+        EXPECT_FALSE(utils::read(ADCSRA, ADIE));
+        EXPECT_TRUE(utils::read(SREG, I_FLAG));
+    }
+
+    // Case 4 - Read with global interrupts disabled, expect the CPU to sleep once and global 
+    // interrupts to be disabled again afterwards.
+    {
+        const std::uint32_t sleepCount{test::sleepCount()};
+        utils::globalInterruptDisable();
+        ADC = 384U;
+        EXPECT_EQ(adc.read(Pin::A2), 384U);
+        EXPECT_EQ(test::sleepCount(), sleepCount + 1U);
+        EXPECT_FALSE(utils::read(SREG, I_FLAG));
+        utils::globalInterruptEnable();
+        ADC = 512U;
+    }
+
+    // Case 5 - Expect one sleep per conversion when oversampling.
+    {
+        const std::uint32_t sleepCount{test::sleepCount()};
+        EXPECT_TRUE(adc.setOversampling(1U));
+        EXPECT_EQ(adc.read(Pin::A2), 1024U);
+        EXPECT_EQ(test::sleepCount(), sleepCount + 4U);
+        EXPECT_TRUE(adc.setOversampling(0U));
+    }
+
+    // Case 6 - Restore polling reads.
+    {
+        EXPECT_TRUE(adc.setReadMode(adc::ReadMode::Polling));
+        test::setAdcInterrupt(nullptr);
+        utils::set(ADCSRA, ADIF);
+        EXPECT_EQ(adc.read(Pin::A2), 512U);
+    }
+}
+
+/**
+ * @brief ADC non-blocking conversion test.
+ * 
+ *        Verify that single conversions are started without blocking, that the result is 
+ *        stored by the conversion-complete interrupt, that each result can only be read once 
+ *        and that the ADC rejects other operations during the conversion.
+ */
+TEST(Adc_Atmega328p, NonBlockingConversion)
+{
+    // Set up the ADC.
+    adc::Interface& adc{setupAdc()};
+    using Pin = adc::Atmega328p::Pin;
+    std::uint16_t value{};
+
+    // Case 1 - Expect conversions of invalid channels to be rejected.
+    {
+        EXPECT_FALSE(adc.startConversion(Pin::A5 + 1U));
+        EXPECT_FALSE(adc.isConverting());
+        EXPECT_FALSE(adc.readConversion(value));
+    }
+
+    // Case 2 - Start a conversion, expect the interrupt to be enabled and the conversion 
+    // to be started without waiting for the result. Start with global interrupts disabled, 
+    // as in an interrupt service routine, expect them to stay disabled.
+    {
+        utils::globalInterruptDisable();
+        EXPECT_TRUE(adc.startConversion(Pin::A3));
+        EXPECT_FALSE(utils::read(SREG, SREG_I));
+        utils::globalInterruptEnable();
+        EXPECT_TRUE(adc.isConverting());
+        EXPECT_EQ(ADMUX, (1U << REFS0) | Pin::A3);
+        EXPECT_TRUE(utils::read(ADCSRA, ADIE, ADSC));
+        EXPECT_FALSE(utils::read(ADCSRA, ADATE));
+        EXPECT_FALSE(adc.readConversion(value));
+    }
+
+    // Case 3 - Expect the ADC to be busy until the conversion is complete.
+    {
+        EXPECT_FALSE(adc.startConversion(Pin::A3));
+        EXPECT_FALSE(adc.startSampling(Pin::A3));
+        EXPECT_FALSE(adc.setOversampling(1U));
+        EXPECT_EQ(adc.read(Pin::A3), 0U);
+    }
+
+    // Case 4 - Complete the conversion, expect the result to be read once.
+    {
+        ADC = 321U;
+        adc::ADC_vect();
+        EXPECT_FALSE(adc.isConverting());
+        EXPECT_FALSE(utils::read(ADCSRA, ADIE));
+        EXPECT_TRUE(adc.readConversion(value));
+        EXPECT_EQ(value, 321U);
+        EXPECT_FALSE(adc.readConversion(value));
+    }
+
+    // Case 5 - Convert with oversampling, expect the interrupt to start the next conversion 
+    // until four conversions have been accumulated.
+    {
+        EXPECT_TRUE(adc.setOversampling(1U));
+        EXPECT_TRUE(adc.startConversion(Pin::A1));
+
+        for (std::uint8_t i{}; i < 4U; ++i)
+        {
+            EXPECT_TRUE(adc.isConverting());
+            ADC = 100U + i;
+            utils::clear(ADCSRA, ADSC);
+            adc::ADC_vect();
+            EXPECT_EQ(utils::read(ADCSRA, ADSC), 3U > i);
+        }
+        EXPECT_TRUE(adc.readConversion(value));
+        EXPECT_EQ(value, 203U);
+        EXPECT_TRUE(adc.setOversampling(0U));
+    }
+
+    // Case 6 - Disable the ADC, expect conversions to be rejected.
+    {
+        adc.setEnabled(false);
+        EXPECT_FALSE(adc.startConversion(Pin::A0));
+        adc.setEnabled(true);
+    }
+}
 } // namespace
 } // namespace driver
 
@@ -0,0 +1,63 @@
+/**
+ * @brief Unit tests for the ADC interface.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "driver/adc/interface.h"
+
+#ifdef TESTSUITE
+
+namespace driver
+{
+namespace
+{
+// -----------------------------------------------------------------------------
+std::uint16_t expectedScale(const std::uint16_t value, const std::uint16_t fullScale, 
+                            const std::uint8_t resolution) noexcept
+{
+    const std::uint64_t maxValue{(1ULL << resolution) - 1U};
+    return static_cast<std::uint16_t>((value * fullScale + maxValue / 2U) / maxValue);
+}
+
+/**
+ * @brief ADC scale test.
+ * 
+ *        Verify that ADC values are scaled exactly as with a division for all supported 
+ *        resolutions, including 16 bits.
+ */
+TEST(Adc_Interface, Scale)
+{
+    constexpr std::uint16_t fullScales[]{1100U, 5000U, 32767U};
+
+    // Case 1 - Scale every value of each resolution, expect the rounded quotient.
+    for (std::uint8_t resolution{8U}; resolution <= 16U; ++resolution)
+    {
+        const std::uint32_t maxValue{(1U << resolution) - 1U};
+
+        for (const std::uint16_t fullScale : fullScales)
+        {
+            // Skip full-scale values exceeding the supported product.
+            if (maxValue * fullScale >= (1U << 31U)) { continue; }
+
+            for (std::uint32_t value{}; value <= maxValue; ++value)
+            {
+                const std::uint16_t input{static_cast<std::uint16_t>(value)};
+                ASSERT_EQ(expectedScale(input, fullScale, resolution), 
+                          adc::scale(input, fullScale, resolution));
+            }
+        }
+    }
+
+    // Case 2 - Scale the extremes of a 16-bit value, expect 0 and the full-scale value.
+    {
+        EXPECT_EQ(0U, adc::scale(0U, 5000U, 16U));
+        EXPECT_EQ(5000U, adc::scale(65535U, 5000U, 16U));
+        EXPECT_EQ(2500U, adc::scale(32768U, 5000U, 16U));
+    }
+}
+} // namespace
+} // namespace driver
+
+#endif /** TESTSUITE */
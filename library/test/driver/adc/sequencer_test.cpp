@@ -0,0 +1,164 @@
+/**
+ * @brief Unit tests for the multi-channel ADC scan sequencer.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "driver/adc/sequencer.h"
+#include "driver/adc/stub.h"
+
+#ifdef TESTSUITE
+
+namespace driver
+{
+namespace
+{
+// -----------------------------------------------------------------------------
+void convert(adc::Stub& adc, const std::uint16_t value) noexcept
+{
+    // Simulate a conversion of given value.
+    adc.setValue(value);
+    adc.convert();
+}
+
+/**
+ * @brief Verify that invalid channel lists are rejected.
+ */
+TEST(Adc_Sequencer, InvalidChannels)
+{
+    adc::Stub adc{};
+    adc::Sequencer sequencer{adc};
+    constexpr std::uint8_t channels[adc::Sequencer::MaxChannelCount + 1U]{};
+
+    // Case 1 - Expect empty and oversized channel lists to be rejected.
+    {
+        EXPECT_FALSE(sequencer.setChannels(nullptr, 1U));
+        EXPECT_FALSE(sequencer.setChannels(channels, 0U));
+        EXPECT_FALSE(sequencer.setChannels(channels, adc::Sequencer::MaxChannelCount + 1U));
+        EXPECT_EQ(sequencer.channelCount(), 0U);
+        EXPECT_FALSE(adc.startScan(sequencer));
+    }
+
+    // Case 2 - Expect channels rejected by the ADC to be rejected.
+    {
+        adc.setChannelValidity(false);
+        EXPECT_FALSE(sequencer.setChannels(channels, 2U));
+        EXPECT_EQ(sequencer.channelCount(), 0U);
+    }
+
+    // Case 3 - Expect valid channel lists to be accepted.
+    {
+        adc.setChannelValidity(true);
+        EXPECT_TRUE(sequencer.setChannels(channels, adc::Sequencer::MaxChannelCount));
+        EXPECT_EQ(sequencer.channelCount(), adc::Sequencer::MaxChannelCount);
+    }
+}
+
+/**
+ * @brief Verify that the channels are scanned in order with one discarded conversion 
+ *        after each multiplexer switch.
+ */
+TEST(Adc_Sequencer, Scan)
+{
+    adc::Stub adc{};
+    adc::Sequencer sequencer{adc};
+    constexpr std::uint8_t channels[]{2U, 4U, 1U};
+    adc::Sequencer::Snapshot snapshot{};
+
+    // Case 1 - Start scanning, expect the first channel to be selected and no snapshot 
+    // to be published.
+    {
+        EXPECT_TRUE(sequencer.setChannels(channels, 3U));
+        EXPECT_TRUE(adc.startScan(sequencer));
+        EXPECT_EQ(adc.selectedChannel(), 2U);
+        EXPECT_FALSE(sequencer.snapshot(snapshot));
+    }
+
+    // Case 2 - Convert one value per channel and a settling value after each switch, 
+    // expect the settling values to be discarded.
+    {
+        convert(adc, 10U);
+        EXPECT_EQ(adc.selectedChannel(), 4U);
+        convert(adc, 999U);
+        convert(adc, 20U);
+        EXPECT_EQ(adc.selectedChannel(), 1U);
+        convert(adc, 999U);
+        EXPECT_FALSE(sequencer.snapshot(snapshot));
+        convert(adc, 30U);
+        EXPECT_EQ(adc.selectedChannel(), 2U);
+
+        EXPECT_TRUE(sequencer.snapshot(snapshot));
+        EXPECT_EQ(snapshot.channelCount, 3U);
+        EXPECT_EQ(snapshot.sequence, 1U);
+        EXPECT_EQ(snapshot.values[0U], 10U);
+        EXPECT_EQ(snapshot.values[1U], 20U);
+        EXPECT_EQ(snapshot.values[2U], 30U);
+    }
+
+    // Case 3 - Start the next scan, expect the published snapshot to stay coherent until 
+    // the scan is complete.
+    {
+        convert(adc, 999U);
+        convert(adc, 11U);
+        convert(adc, 999U);
+        convert(adc, 21U);
+        EXPECT_TRUE(sequencer.snapshot(snapshot));
+        EXPECT_EQ(snapshot.sequence, 1U);
+        EXPECT_EQ(snapshot.values[0U], 10U);
+        EXPECT_EQ(snapshot.values[1U], 20U);
+
+        convert(adc, 999U);
+        convert(adc, 31U);
+        EXPECT_TRUE(sequencer.snapshot(snapshot));
+        EXPECT_EQ(snapshot.sequence, 2U);
+        EXPECT_EQ(snapshot.values[0U], 11U);
+        EXPECT_EQ(snapshot.values[1U], 21U);
+        EXPECT_EQ(snapshot.values[2U], 31U);
+    }
+
+    // Case 4 - Stop scanning, expect conversions to be ignored by the sequencer.
+    {
+        adc.stopSampling();
+        convert(adc, 999U);
+        EXPECT_TRUE(sequencer.snapshot(snapshot));
+        EXPECT_EQ(snapshot.sequence, 2U);
+    }
+}
+
+/**
+ * @brief Verify that no conversions are discarded when scanning a single channel.
+ */
+TEST(Adc_Sequencer, SingleChannel)
+{
+    adc::Stub adc{};
+    adc::Sequencer sequencer{adc};
+    constexpr std::uint8_t channel{3U};
+    adc::Sequencer::Snapshot snapshot{};
+
+    // Case 1 - Expect a snapshot to be published for every conversion.
+    {
+        EXPECT_TRUE(sequencer.setChannels(&channel, 1U));
+        EXPECT_TRUE(adc.startScan(sequencer));
+
+        for (std::uint16_t i{1U}; i <= 5U; ++i)
+        {
+            convert(adc, i);
+            EXPECT_EQ(adc.selectedChannel(), channel);
+            EXPECT_TRUE(sequencer.snapshot(snapshot));
+            EXPECT_EQ(snapshot.sequence, i);
+            EXPECT_EQ(snapshot.values[0U], i);
+        }
+    }
+
+    // Case 2 - Restart scanning, expect the published snapshot to be discarded.
+    {
+        adc.stopSampling();
+        EXPECT_TRUE(adc.startScan(sequencer));
+        EXPECT_FALSE(sequencer.snapshot(snapshot));
+    }
+}
+} // namespace
+} // namespace driver
+
+#endif /** TESTSUITE */
@@ -14,11 +14,23 @@
 
 namespace driver
 {
+namespace eeprom
+{
+/** EEPROM ready interrupt service routine. */
+void EE_READY_vect() noexcept;
+} // namespace eeprom
+
 namespace
 {
 /** EEPROM size in bytes. */
 constexpr std::uint16_t EepromSize{1024U};
 
+/** The number of completed asynchronous writes. */
+std::uint8_t completedWrites{};
+
+// -----------------------------------------------------------------------------
+void onWriteComplete() noexcept { ++completedWrites; }
+
 // -----------------------------------------------------------------------------
 constexpr bool isAddrValid(const std::uint16_t addr) noexcept { return EepromSize > addr; }
 
@@ -43,7 +55,9 @@ void writeToEeprom(eeprom::Interface& eeprom, const std::uint16_t addr) noexcept
         if(isAddrValid(addr))
         {
             // Expect the given address and data to be written to the corresponding registers.
-            constexpr std::uint8_t expectedEecrOnWrite{(1U << EEMPE) | (1U << EEPE)};
+            // The stored byte is read before the write, which sets EERE.
+            constexpr std::uint8_t expectedEecrOnWrite{
+                (1U << EERE) | (1U << EEMPE) | (1U << EEPE)};
             EXPECT_TRUE(success);
             EXPECT_EQ(EEAR, addr);
             EXPECT_EQ(EEDR, expectedData);
@@ -159,6 +173,196 @@ TEST(Eeprom_Atmega328p, Write)
 }
 
 
+/**
+ * @brief EEPROM write-if-changed test.
+ * 
+ *        Verify that only changed bytes are programmed, with the fastest programming mode.
+ */
+TEST(Eeprom_Atmega328p, WriteIfChanged)
+{
+    eeprom::Interface& eeprom{eeprom::Atmega328p::getInstance()};
+    eeprom.setEnabled(true);
+    constexpr std::uint16_t addr{100U};
+    constexpr std::uint8_t eecrOnWrite{(1U << EERE) | (1U << EEMPE) | (1U << EEPE)};
+
+    // Case 1 - Write the stored value, expect nothing to be programmed.
+    {
+        EECR = 0U;
+        EEDR = 0x5AU;
+        std::uint8_t programmedCount{1U};
+        EXPECT_TRUE(eeprom.write(addr, static_cast<std::uint8_t>(0x5AU), programmedCount));
+        EXPECT_EQ(0U, programmedCount);
+        EXPECT_EQ(1U << EERE, EECR);
+    }
+
+    // Case 2 - Clear bits of the stored value, expect write-only mode.
+    {
+        EECR = 0U;
+        EEDR = 0xFFU;
+        std::uint8_t programmedCount{};
+        EXPECT_TRUE(eeprom.write(addr, static_cast<std::uint8_t>(0x5AU), programmedCount));
+        EXPECT_EQ(1U, programmedCount);
+        EXPECT_EQ(0x5AU, EEDR);
+        EXPECT_EQ(eecrOnWrite | (1U << EEPM1), EECR);
+    }
+
+    // Case 3 - Set all bits of the stored value, expect erase-only mode.
+    {
+        EECR = 0U;
+        EEDR = 0x5AU;
+        std::uint8_t programmedCount{};
+        EXPECT_TRUE(eeprom.write(addr, static_cast<std::uint8_t>(0xFFU), programmedCount));
+        EXPECT_EQ(1U, programmedCount);
+        EXPECT_EQ(eecrOnWrite | (1U << EEPM0), EECR);
+    }
+
+    // Case 4 - Set some bits of the stored value, expect atomic erase and write mode.
+    {
+        EECR = (1U << EEPM0) | (1U << EEPM1);
+        EEDR = 0x0FU;
+        std::uint8_t programmedCount{};
+        EXPECT_TRUE(eeprom.write(addr, static_cast<std::uint8_t>(0xF0U), programmedCount));
+        EXPECT_EQ(1U, programmedCount);
+        EXPECT_EQ(eecrOnWrite, EECR);
+    }
+
+    // Case 5 - Write two bytes where only the last one changes, expect one byte programmed.
+    {
+        EECR = 0U;
+        EEDR = 0x12U;
+        std::uint8_t programmedCount{};
+        EXPECT_TRUE(eeprom.write(addr, static_cast<std::uint16_t>(0x3412U), programmedCount));
+        EXPECT_EQ(1U, programmedCount);
+        EXPECT_EQ(addr + 1U, EEAR);
+        EXPECT_EQ(0x34U, EEDR);
+    }
+
+    // Case 6 - Write with the EEPROM disabled, expect failure and nothing to be programmed.
+    {
+        eeprom.setEnabled(false);
+        std::uint8_t programmedCount{1U};
+        EXPECT_FALSE(eeprom.write(addr, static_cast<std::uint8_t>(0U), programmedCount));
+        EXPECT_EQ(0U, programmedCount);
+    }
+}
+
+/**
+ * @brief EEPROM asynchronous write test.
+ * 
+ *        Verify that queued bytes are written one at a time by the EEPROM ready interrupt, 
+ *        that pending bytes are read from the queue and that completion is signaled.
+ */
+TEST(Eeprom_Atmega328p, AsyncWrite)
+{
+    eeprom::Interface& eeprom{eeprom::Atmega328p::getInstance()};
+    test::setEepromInterrupt(eeprom::EE_READY_vect);
+    utils::globalInterruptEnable();
+    eeprom.setEnabled(true);
+    completedWrites = 0U;
+    EECR            = 0U;
+    EEDR            = 0U;
+
+    constexpr std::uint16_t addr{200U};
+    constexpr std::uint8_t data[]{1U, 2U, 3U};
+
+    // Case 1 - Queue three bytes, expect the call to return before anything is programmed.
+    {
+        EXPECT_TRUE(eeprom.writeAsync(addr, data, sizeof(data), onWriteComplete));
+        EXPECT_TRUE(eeprom.isWritePending());
+        EXPECT_TRUE(utils::read(EECR, EERIE));
+        EXPECT_FALSE(utils::read(EECR, EEPE));
+        EXPECT_EQ(0U, completedWrites);
+    }
+
+    // Case 2 - Read the pending addresses, expect the queued data.
+    {
+        std::uint16_t value{};
+        EXPECT_TRUE(eeprom.read(addr + 1U, value));
+        EXPECT_EQ(0x0302U, value);
+        EXPECT_TRUE(utils::read(EECR, EERIE));
+    }
+
+    // Case 3 - Run the interrupt, expect the first byte to be programmed.
+    {
+        eeprom::EE_READY_vect();
+        EXPECT_EQ(addr, EEAR);
+        EXPECT_EQ(data[0U], EEDR);
+        EXPECT_TRUE(utils::read(EECR, EEPE));
+        EXPECT_TRUE(eeprom.isWritePending());
+        EXPECT_EQ(0U, completedWrites);
+    }
+
+    // Case 4 - Flush the queue, expect the remaining bytes to be programmed and the 
+    //          callback to be invoked once.
+    {
+        eeprom.flush();
+        EXPECT_FALSE(eeprom.isWritePending());
+        EXPECT_FALSE(utils::read(EECR, EERIE));
+        EXPECT_EQ(addr + 2U, EEAR);
+        EXPECT_EQ(data[2U], EEDR);
+        EXPECT_EQ(1U, completedWrites);
+    }
+
+    // Case 5 - Queue bytes matching the stored data, expect nothing to be programmed.
+    {
+        constexpr std::uint8_t stored[]{3U, 3U};
+        EECR = 0U;
+        EXPECT_TRUE(eeprom.writeAsync(addr, stored, sizeof(stored), onWriteComplete));
+        eeprom::EE_READY_vect();
+        EXPECT_FALSE(utils::read(EECR, EEMPE));
+        EXPECT_FALSE(eeprom.isWritePending());
+        EXPECT_EQ(2U, completedWrites);
+    }
+
+    // Case 6 - Fill the queue, expect writes not fitting in the queue to be rejected.
+    {
+        std::uint8_t block[16U]{};
+        for (std::uint8_t i{}; i < sizeof(block); ++i) { block[i] = 0xA0U + i; }
+        EXPECT_TRUE(eeprom.writeAsync(addr, block, sizeof(block)));
+        EXPECT_FALSE(eeprom.writeAsync(addr, data, 1U));
+        eeprom.flush();
+        EXPECT_FALSE(eeprom.isWritePending());
+        EXPECT_TRUE(eeprom.writeAsync(addr, data, 1U));
+    }
+
+    // Case 7 - Perform a blocking write, expect the pending writes to be completed first.
+    {
+        EXPECT_TRUE(eeprom.write(addr + 1U, static_cast<std::uint8_t>(0x55U)));
+        EXPECT_FALSE(eeprom.isWritePending());
+        EXPECT_EQ(addr + 1U, EEAR);
+        EXPECT_EQ(0x55U, EEDR);
+    }
+
+    // Case 8 - Flush with global interrupts disabled, as done in an interrupt service 
+    //          routine, expect the queue to be emptied by polling without sleeping.
+    {
+        constexpr std::uint8_t stored[]{0x55U};
+        EECR = 0U;
+        EXPECT_TRUE(eeprom.writeAsync(addr + 1U, stored, sizeof(stored), onWriteComplete));
+        const std::uint8_t writeCount{completedWrites};
+        const std::uint32_t sleepCount{test::sleepCount()};
+
+        utils::globalInterruptDisable();
+        eeprom.flush();
+        EXPECT_FALSE(eeprom.isWritePending());
+        EXPECT_FALSE(utils::read(SREG, I_FLAG));
+        EXPECT_EQ(sleepCount, test::sleepCount());
+        EXPECT_EQ(writeCount + 1U, completedWrites);
+        utils::globalInterruptEnable();
+    }
+
+    // Case 9 - Pass invalid parameters or disable the EEPROM, expect the writes to be rejected.
+    {
+        EXPECT_FALSE(eeprom.writeAsync(addr, nullptr, 1U));
+        EXPECT_FALSE(eeprom.writeAsync(addr, data, 0U));
+        EXPECT_FALSE(eeprom.writeAsync(EepromSize - 1U, data, sizeof(data)));
+        eeprom.setEnabled(false);
+        EXPECT_FALSE(eeprom.writeAsync(addr, data, sizeof(data)));
+        EXPECT_FALSE(eeprom.isWritePending());
+    }
+    test::setEepromInterrupt(nullptr);
+}
+
 /**
  * @brief EEPROM read test.
  * 
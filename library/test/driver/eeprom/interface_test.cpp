@@ -0,0 +1,101 @@
+/**
+ * @brief Unit tests for the EEPROM interface.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "driver/eeprom/interface.h"
+#include "driver/eeprom/stub.h"
+
+#ifdef TESTSUITE
+
+namespace driver
+{
+namespace
+{
+/**
+ * @brief EEPROM programming mode test.
+ * 
+ *        Verify that the fastest programming mode is selected for each change of a byte.
+ */
+TEST(Eeprom_Interface, ProgramMode)
+{
+    // Case 1 - Set all bits, expect erase only.
+    EXPECT_EQ(eeprom::ProgramMode::EraseOnly, eeprom::programMode(0x00U, 0xFFU));
+    EXPECT_EQ(eeprom::ProgramMode::EraseOnly, eeprom::programMode(0x5AU, 0xFFU));
+
+    // Case 2 - Only clear bits, expect write only.
+    EXPECT_EQ(eeprom::ProgramMode::WriteOnly, eeprom::programMode(0xFFU, 0x00U));
+    EXPECT_EQ(eeprom::ProgramMode::WriteOnly, eeprom::programMode(0x5AU, 0x42U));
+
+    // Case 3 - Set some bits, expect atomic erase and write.
+    EXPECT_EQ(eeprom::ProgramMode::EraseWrite, eeprom::programMode(0x00U, 0x01U));
+    EXPECT_EQ(eeprom::ProgramMode::EraseWrite, eeprom::programMode(0x0FU, 0xF0U));
+}
+
+/**
+ * @brief EEPROM write-if-changed test.
+ * 
+ *        Verify that writes only program changed bytes, that the stored data is correct in 
+ *        each programming mode and that the number of programmed bytes is reported.
+ */
+TEST(Eeprom_Interface, WriteIfChanged)
+{
+    eeprom::Stub<16U> eeprom{};
+    constexpr std::uint16_t addr{4U};
+
+    // Case 1 - Write a value over the cleared memory, expect all non-zero bytes programmed.
+    {
+        std::uint8_t programmedCount{};
+        EXPECT_TRUE(eeprom.write(addr, static_cast<std::uint32_t>(0x00FF1200U), programmedCount));
+        EXPECT_EQ(2U, programmedCount);
+        EXPECT_EQ(1U, eeprom.programCount(eeprom::ProgramMode::EraseOnly));
+        EXPECT_EQ(1U, eeprom.programCount(eeprom::ProgramMode::EraseWrite));
+
+        std::uint32_t data{};
+        EXPECT_TRUE(eeprom.read(addr, data));
+        EXPECT_EQ(0x00FF1200U, data);
+    }
+
+    // Case 2 - Write the same value again, expect nothing to be programmed.
+    {
+        std::uint8_t programmedCount{1U};
+        EXPECT_TRUE(eeprom.write(addr, static_cast<std::uint32_t>(0x00FF1200U), programmedCount));
+        EXPECT_EQ(0U, programmedCount);
+    }
+
+    // Case 3 - Clear bits only, expect the bytes to be written without erasing.
+    {
+        std::uint8_t programmedCount{};
+        EXPECT_TRUE(eeprom.write(addr, static_cast<std::uint32_t>(0x000F1000U), programmedCount));
+        EXPECT_EQ(2U, programmedCount);
+        EXPECT_EQ(2U, eeprom.programCount(eeprom::ProgramMode::WriteOnly));
+
+        std::uint32_t data{};
+        EXPECT_TRUE(eeprom.read(addr, data));
+        EXPECT_EQ(0x000F1000U, data);
+    }
+
+    // Case 4 - Toggle a state twice and write the same state, as done by the logic.
+    {
+        std::uint8_t programmedCount{};
+        EXPECT_TRUE(eeprom.write(0U, static_cast<std::uint8_t>(1U), programmedCount));
+        EXPECT_EQ(1U, programmedCount);
+        EXPECT_TRUE(eeprom.write(0U, static_cast<std::uint8_t>(0U), programmedCount));
+        EXPECT_EQ(1U, programmedCount);
+        EXPECT_TRUE(eeprom.write(0U, static_cast<std::uint8_t>(0U), programmedCount));
+        EXPECT_EQ(0U, programmedCount);
+    }
+
+    // Case 5 - Write to an invalid address, expect failure and nothing to be programmed.
+    {
+        std::uint8_t programmedCount{1U};
+        EXPECT_FALSE(eeprom.write(15U, static_cast<std::uint16_t>(0xFFFFU), programmedCount));
+        EXPECT_EQ(0U, programmedCount);
+    }
+}
+} // namespace
+} // namespace driver
+
+#endif /** TESTSUITE */
@@ -0,0 +1,215 @@
+/**
+ * @brief Unit tests for the binary framed serial protocol.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "driver/serial/protocol.h"
+#include "driver/serial/stub.h"
+#include "utils/codec.h"
+
+#ifdef TESTSUITE
+
+namespace driver
+{
+namespace
+{
+// -----------------------------------------------------------------------------
+bool containsDelimiter(const std::uint8_t* data, const std::size_t size) noexcept
+{
+    for (std::size_t i{}; i < size; ++i)
+    {
+        if (utils::cobs::Delimiter == data[i]) { return true; }
+    }
+    return false;
+}
+
+/**
+ * @brief Codec test.
+ * 
+ *        Verify that the CRC16, COBS and varint utilities behave as expected.
+ */
+TEST(Serial_Protocol, Codec)
+{
+    // Case 1 - Verify the CRC16 check value ("123456789" => 0x29B1 for CRC-16/CCITT-FALSE).
+    {
+        const std::uint8_t data[]{'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+        EXPECT_EQ(utils::crc::crc16(data, sizeof(data)), 0x29B1U);
+
+        // Expect the same result when calculating the checksum in two steps.
+        const std::uint16_t crc{utils::crc::crc16(data, 4U)};
+        EXPECT_EQ(utils::crc::crc16(data + 4U, sizeof(data) - 4U, crc), 0x29B1U);
+    }
+
+    // Case 2 - Verify that COBS encoded data contains no zero bytes and decodes correctly,
+    // including blocks longer than the maximum block length.
+    {
+        std::uint8_t data[600U]{};
+        for (std::size_t i{}; i < sizeof(data); ++i) 
+        { 
+            data[i] = (0U == i % 7U) || (i > 300U) ? static_cast<std::uint8_t>(i) : 0U;
+        }
+        std::uint8_t encoded[utils::cobs::maxEncodedSize(sizeof(data))]{};
+        std::uint8_t decoded[sizeof(data)]{};
+
+        const std::size_t encodedSize{
+            utils::cobs::encode(data, sizeof(data), encoded, sizeof(encoded))};
+        EXPECT_LT(0U, encodedSize);
+        EXPECT_FALSE(containsDelimiter(encoded, encodedSize));
+
+        EXPECT_EQ(utils::cobs::decode(encoded, encodedSize, decoded, sizeof(decoded)), 
+                  sizeof(data));
+        for (std::size_t i{}; i < sizeof(data); ++i) { EXPECT_EQ(data[i], decoded[i]); }
+
+        // Expect encoding to fail if the destination buffer is too small.
+        EXPECT_EQ(utils::cobs::encode(data, sizeof(data), encoded, sizeof(data)), 0U);
+    }
+
+    // Case 3 - Verify that varints and zigzag encoding round-trip.
+    {
+        const std::int32_t values[]{0, 1, -1, 63, -64, 64, 300, -300, INT32_MAX, INT32_MIN};
+
+        for (const auto& value : values)
+        {
+            std::uint8_t buffer[utils::varint::MaxSize]{};
+            const std::uint8_t size{
+                utils::varint::encode(utils::varint::zigzag(value), buffer, sizeof(buffer))};
+            EXPECT_LT(0U, size);
+
+            std::uint32_t decoded{};
+            EXPECT_EQ(utils::varint::decode(buffer, size, decoded), size);
+            EXPECT_EQ(utils::varint::unzigzag(decoded), value);
+        }
+
+        // Expect small values to be encoded in a single byte.
+        std::uint8_t buffer[utils::varint::MaxSize]{};
+        EXPECT_EQ(utils::varint::encode(utils::varint::zigzag(-50), buffer, sizeof(buffer)), 1U);
+
+        // Expect decoding of a truncated varint to fail.
+        const std::uint8_t truncated[]{0x80U, 0x80U};
+        std::uint32_t decoded{};
+        EXPECT_EQ(utils::varint::decode(truncated, sizeof(truncated), decoded), 0U);
+    }
+}
+
+/**
+ * @brief Protocol send test.
+ * 
+ *        Verify that messages are transmitted as compact, delimited frames that can be decoded.
+ */
+TEST(Serial_Protocol, Send)
+{
+    serial::Stub serial{};
+    serial::Protocol protocol{serial};
+
+    // Case 1 - Send a temperature message, expect a six byte frame.
+    {
+        EXPECT_TRUE(protocol.sendTemperature(25));
+        const auto& frame{serial.writeBuffer()};
+        EXPECT_EQ(frame.size(), 6U);
+
+        // Expect the frame to be terminated by a delimiter, and no other delimiters.
+        EXPECT_EQ(frame[frame.size() - 1U], utils::cobs::Delimiter);
+        EXPECT_FALSE(containsDelimiter(frame.data(), frame.size() - 1U));
+
+        // Decode the frame, expect the original message.
+        serial::Message message{};
+        EXPECT_TRUE(serial::Protocol::decode(frame.data(), frame.size() - 1U, message));
+        EXPECT_EQ(message.type, serial::MessageType::Temperature);
+        EXPECT_EQ(message.valueCount, 1U);
+        EXPECT_EQ(message.values[0U], 25);
+        serial.clearWriteBuffer();
+    }
+
+    // Case 2 - Send a message with the maximum number of values, including large values.
+    {
+        std::int32_t values[serial::Message::MaxValueCount]{};
+        for (std::uint8_t i{}; i < serial::Message::MaxValueCount; ++i) 
+        { 
+            values[i] = (i % 2U) ? INT32_MIN + i : INT32_MAX - i;
+        }
+        EXPECT_TRUE(protocol.send(serial::MessageType::ToggleState, values, 
+                                  serial::Message::MaxValueCount));
+        const auto& frame{serial.writeBuffer()};
+        EXPECT_GE(serial::Protocol::MaxFrameSize, frame.size());
+
+        serial::Message message{};
+        EXPECT_TRUE(serial::Protocol::decode(frame.data(), frame.size() - 1U, message));
+        EXPECT_EQ(message.valueCount, serial::Message::MaxValueCount);
+        for (std::uint8_t i{}; i < message.valueCount; ++i) 
+        { 
+            EXPECT_EQ(message.values[i], values[i]); 
+        }
+        serial.clearWriteBuffer();
+    }
+
+    // Case 3 - Try to send too many values, expect failure and no transmission.
+    {
+        const std::int32_t values[serial::Message::MaxValueCount + 1U]{};
+        constexpr std::uint8_t valueCount{serial::Message::MaxValueCount + 1U};
+        EXPECT_FALSE(protocol.send(serial::MessageType::Temperature, values, valueCount));
+        EXPECT_TRUE(serial.writeBuffer().empty());
+    }
+
+    // Case 4 - Send a message while the serial device is disabled, expect failure.
+    {
+        serial.setEnabled(false);
+        EXPECT_FALSE(protocol.sendTemperature(25));
+        EXPECT_TRUE(serial.writeBuffer().empty());
+        serial.setEnabled(true);
+    }
+}
+
+/**
+ * @brief Protocol receive test.
+ * 
+ *        Verify that valid frames are received and that corrupt frames are dropped.
+ */
+TEST(Serial_Protocol, Receive)
+{
+    serial::Stub sender{};
+    serial::Protocol senderProtocol{sender};
+
+    // Create a stream: the tail of a partially received frame, a valid frame, a corrupted 
+    // frame and another valid frame.
+    const std::uint8_t garbage[]{0x12U, 0x34U, 0x56U, utils::cobs::Delimiter};
+    container::Vector<std::uint8_t> stream{};
+    for (const auto& byte : garbage) { stream.pushBack(byte); }
+    
+    EXPECT_TRUE(senderProtocol.sendTemperature(-12));
+    stream += sender.writeBuffer();
+    sender.clearWriteBuffer();
+
+    EXPECT_TRUE(senderProtocol.sendTemperature(100));
+    const std::size_t corruptIndex{stream.size() + 1U};
+    stream += sender.writeBuffer();
+    stream[corruptIndex] ^= 0x01U;
+    sender.clearWriteBuffer();
+
+    EXPECT_TRUE(senderProtocol.sendToggleState(true));
+    stream += sender.writeBuffer();
+
+    // Feed the stream to the receiver.
+    serial::Stub receiver{};
+    serial::Protocol receiverProtocol{receiver};
+    receiver.setReadBuffer(stream.data(), static_cast<std::uint16_t>(stream.size()));
+
+    // Expect the partial frame to be dropped and the first valid frame to be received.
+    serial::Message message{};
+    EXPECT_TRUE(receiverProtocol.receive(message, 1U));
+    EXPECT_EQ(message.type, serial::MessageType::Temperature);
+    EXPECT_EQ(message.values[0U], -12);
+
+    // Expect the corrupt frame to be dropped and the last frame to be received.
+    EXPECT_TRUE(receiverProtocol.receive(message, 1U));
+    EXPECT_EQ(message.type, serial::MessageType::ToggleState);
+    EXPECT_EQ(message.values[0U], 1);
+
+    // Expect no more messages.
+    EXPECT_FALSE(receiverProtocol.receive(message, 1U));
+}
+} // namespace
+} // namespace driver
+
+#endif /** TESTSUITE */
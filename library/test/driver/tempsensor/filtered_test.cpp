@@ -0,0 +1,104 @@
+/**
+ * @brief Unit tests for the filtered temp sensor.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "driver/tempsensor/filtered.h"
+#include "driver/tempsensor/stub.h"
+#include "filter/chain.h"
+#include "filter/median.h"
+#include "filter/moving_average.h"
+
+#ifdef TESTSUITE
+
+namespace driver
+{
+namespace
+{
+/** Filter chain removing outliers before averaging. */
+using Filter = filter::Chain<filter::Median<std::int16_t, 3U>, 
+                             filter::MovingAverage<std::int16_t, 4U>>;
+
+/**
+ * @brief Filtered temp sensor test.
+ * 
+ *        Verify that:
+ *            - The initialization state of the underlying sensor is forwarded.
+ *            - Readings of uninitialized sensors return 0 and are not fed to the filter.
+ *            - Readings are passed through the filter chain.
+ *            - Resetting the sensor clears the filter state.
+ */
+TEST(TempSensor_Filtered, Read)
+{
+    tempsensor::Stub sensor{};
+    tempsensor::Filtered<Filter> filtered{sensor};
+
+    // Case 1 - Read an uninitialized sensor, expect 0 to be returned.
+    {
+        sensor.setInitialized(false);
+        sensor.setTemp(100);
+        EXPECT_FALSE(filtered.isInitialized());
+        EXPECT_EQ(filtered.read(), 0);
+    }
+
+    // Case 2 - Read an initialized sensor, expect spikes to be filtered out.
+    {
+        sensor.setInitialized(true);
+        EXPECT_TRUE(filtered.isInitialized());
+        sensor.setTemp(20);
+        EXPECT_EQ(filtered.read(), 20);
+        EXPECT_EQ(filtered.read(), 20);
+        sensor.setTemp(85);
+        EXPECT_EQ(filtered.read(), 20);
+        sensor.setTemp(24);
+        EXPECT_EQ(filtered.read(), 21);
+    }
+
+    // Case 3 - Reset the sensor, expect the next reading to be unfiltered.
+    {
+        filtered.reset();
+        sensor.setTemp(-10);
+        EXPECT_EQ(filtered.read(), -10);
+    }
+}
+
+/**
+ * @brief Filtered temp sensor non-blocking read test.
+ * 
+ *        Verify that non-blocking reads are forwarded to the underlying sensor and that the 
+ *        completed readings are passed through the filter chain.
+ */
+TEST(TempSensor_Filtered, NonBlockingRead)
+{
+    tempsensor::Stub sensor{};
+    tempsensor::Filtered<Filter> filtered{sensor};
+    std::int16_t temperature{};
+
+    // Case 1 - Poll without starting a read, expect no reading.
+    {
+        EXPECT_FALSE(filtered.isReading());
+        EXPECT_FALSE(filtered.poll(temperature));
+    }
+
+    // Case 2 - Read a spike between regular readings, expect it to be filtered out.
+    {
+        const std::int16_t temps[]{20, 20, 85, 24};
+        const std::int16_t expected[]{20, 20, 20, 21};
+
+        for (std::uint8_t i{}; i < 4U; ++i)
+        {
+            sensor.setTemp(temps[i]);
+            EXPECT_TRUE(filtered.startRead());
+            EXPECT_TRUE(filtered.isReading());
+            EXPECT_TRUE(filtered.poll(temperature));
+            EXPECT_EQ(temperature, expected[i]);
+            EXPECT_FALSE(filtered.isReading());
+        }
+    }
+}
+} // namespace
+} // namespace driver
+
+#endif /** TESTSUITE */
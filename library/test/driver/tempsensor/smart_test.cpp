@@ -1,6 +1,7 @@
 /**
  * @brief Unit tests for the smart temperature sensor.
  */
+#include <cmath>
 #include <cstdint>
 #include <memory>
 
@@ -9,6 +10,11 @@
 #include "driver/adc/stub.h"
 #include "driver/tempsensor/smart.h"
 #include "ml/lin_reg/fixed.h"
+#include "ml/lin_reg/online.h"
+#include "ml/lin_reg/piecewise.h"
+#include "ml/lin_reg/quantized.h"
+#include "ml/nn/network.h"
+#include "ml/poly_reg/fixed.h"
 #include "ml/types.h"
 #include "utils/utils.h"
 
@@ -204,6 +210,211 @@ TEST(TempSensor_Smart, HappyPath)
         EXPECT_EQ(tempSensor->read(), expectedTemp);
     }
 }
+
+/**
+ * @brief Smart temp sensor non-blocking read test.
+ * 
+ *        Verify that non-blocking reads predict the same temperature as blocking reads once 
+ *        the conversion of the interrupt-driven ADC is complete.
+ */
+TEST(TempSensor_Smart, NonBlockingRead)
+{
+    constexpr std::uint8_t tempSensorPin{0U};
+    adc::Stub adc{};
+    ml::lin_reg::Fixed linReg{};
+    std::int16_t temperature{};
+
+    // Case 1 - Expect reads to be rejected while the model is untrained.
+    {
+        tempsensor::Smart tempSensor{tempSensorPin, adc, linReg};
+        EXPECT_FALSE(tempSensor.startRead());
+        EXPECT_FALSE(adc.isConverting());
+    }
+
+    // Case 2 - Train the model, expect each reading to match a blocking read.
+    {
+        EXPECT_TRUE(trainModel(linReg));
+        tempsensor::Smart tempSensor{tempSensorPin, adc, linReg};
+
+        for (std::uint16_t adcVal{}; adcVal <= 1000U; adcVal += 100U)
+        {
+            adc.setValue(adcVal);
+            EXPECT_TRUE(tempSensor.startRead());
+            EXPECT_FALSE(tempSensor.poll(temperature));
+            EXPECT_TRUE(adc.convert());
+            EXPECT_TRUE(tempSensor.poll(temperature));
+            EXPECT_EQ(temperature, tempSensor.read());
+        }
+    }
+}
+
+/**
+ * @brief Smart temp sensor quantized model test.
+ * 
+ *        Verify that the sensor predicts with a quantized model as with the floating-point 
+ *        model it was quantized from.
+ */
+TEST(TempSensor_Smart, QuantizedModel)
+{
+    constexpr std::uint8_t tempSensorPin{0U};
+    adc::Stub adc{};
+    ml::lin_reg::Fixed linReg{ml::lin_reg::Parameters{100.0, -50.0, true}};
+    ml::lin_reg::Quantized<> quantizedLinReg{};
+
+    // Case 1 - Expect the sensor not to be initialized while the model is untrained.
+    {
+        tempsensor::Smart tempSensor{tempSensorPin, adc, quantizedLinReg};
+        EXPECT_FALSE(tempSensor.isInitialized());
+        EXPECT_EQ(0, tempSensor.read());
+    }
+
+    // Case 2 - Quantize the model, expect each reading to match the floating-point model.
+    {
+        double maxError{};
+        EXPECT_TRUE(quantizedLinReg.quantize(linReg, adc.maxValue(), adc.supplyVoltage(), 
+                                             maxError));
+        tempsensor::Smart tempSensor{tempSensorPin, adc, quantizedLinReg};
+        tempsensor::Smart reference{tempSensorPin, adc, linReg};
+        EXPECT_TRUE(tempSensor.isInitialized());
+
+        for (std::uint16_t adcVal{}; adcVal <= adc.maxValue(); ++adcVal)
+        {
+            adc.setValue(adcVal);
+            EXPECT_NEAR(reference.read(), tempSensor.read(), 1);
+        }
+    }
+
+    // Case 3 - Expect non-blocking reads to use the quantized model.
+    {
+        tempsensor::Smart tempSensor{tempSensorPin, adc, quantizedLinReg};
+        std::int16_t temperature{};
+        adc.setValue(adc.maxValue());
+        EXPECT_TRUE(tempSensor.startRead());
+        EXPECT_TRUE(adc.convert());
+        EXPECT_TRUE(tempSensor.poll(temperature));
+        EXPECT_EQ(quantizedLinReg.predict(adc.maxValue()), temperature);
+        EXPECT_EQ(450, temperature);
+    }
+}
+
+/**
+ * @brief Online model test.
+ * 
+ *        Verify that the smart sensor can use an online model, which keeps learning while
+ *        the sensor is in use.
+ */
+TEST(TempSensor_Smart, OnlineModel)
+{
+    constexpr std::uint8_t tempSensorPin{0U};
+    adc::Stub adc{};
+    ml::lin_reg::Fixed linReg{ml::lin_reg::Parameters{100.0, -50.0, true}};
+    ml::lin_reg::Online onlineLinReg{0.9};
+    tempsensor::Smart tempSensor{tempSensorPin, adc, onlineLinReg};
+    tempsensor::Smart reference{tempSensorPin, adc, linReg};
+
+    // Case 1 - Expect the sensor not to be initialized while the model is untrained.
+    {
+        EXPECT_FALSE(tempSensor.isInitialized());
+        EXPECT_EQ(0, tempSensor.read());
+    }
+
+    // Case 2 - Add measurements, expect each reading to match the fixed model.
+    {
+        for (double input{0.0}; input <= 1.5; input += 0.1)
+        {
+            EXPECT_TRUE(onlineLinReg.update(input, linReg.predict(input)));
+        }
+        EXPECT_TRUE(tempSensor.isInitialized());
+
+        for (std::uint16_t adcVal{}; adcVal <= adc.maxValue(); adcVal += 16U)
+        {
+            adc.setValue(adcVal);
+            EXPECT_NEAR(reference.read(), tempSensor.read(), 1);
+        }
+    }
+
+    // Case 3 - Add measurements of a drifted sensor, expect the readings to follow the drift.
+    {
+        for (std::uint8_t i{}; i < 100U; ++i)
+        {
+            const double input{0.1 * static_cast<double>(i % 16U)};
+            EXPECT_TRUE(onlineLinReg.update(input, linReg.predict(input) + 5.0));
+        }
+
+        for (std::uint16_t adcVal{}; adcVal <= adc.maxValue(); adcVal += 16U)
+        {
+            adc.setValue(adcVal);
+            EXPECT_NEAR(reference.read() + 5, tempSensor.read(), 1);
+        }
+    }
+}
+
+/**
+ * @brief Nonlinear model test.
+ * 
+ *        Verify that the smart sensor can use polynomial and piecewise linear models, both 
+ *        in floating-point and in quantized form.
+ */
+TEST(TempSensor_Smart, NonlinearModel)
+{
+    constexpr std::uint8_t tempSensorPin{0U};
+    adc::Stub adc{};
+    const double voltageStep{adc.supplyVoltage() / adc.maxValue()};
+
+    // Case 1 - Expect readings of a polynomial model to match its predictions.
+    {
+        ml::poly_reg::Fixed<2U> polyReg{{-20.0, 10.0, 4.0}};
+        tempsensor::Smart tempSensor{tempSensorPin, adc, polyReg};
+        EXPECT_TRUE(tempSensor.isInitialized());
+
+        for (std::uint16_t adcVal{}; adcVal <= adc.maxValue(); adcVal += 16U)
+        {
+            adc.setValue(adcVal);
+            EXPECT_NEAR(polyReg.predict(adcVal * voltageStep), tempSensor.read(), 1);
+        }
+    }
+
+    // Case 2 - Expect readings of a quantized piecewise linear model to match the model.
+    {
+        const ml::lin_reg::Piecewise<3U> piecewise{{0.0, 1.0, 2.5, 5.0}, 
+                                                   {-40.0, 0.0, 30.0, 120.0}};
+        ml::lin_reg::QuantizedPiecewise<3U> quantized{};
+        double maxError{};
+        EXPECT_TRUE(quantized.quantize(piecewise, adc.maxValue(), adc.supplyVoltage(), 
+                                       maxError));
+        tempsensor::Smart tempSensor{tempSensorPin, adc, quantized};
+        EXPECT_TRUE(tempSensor.isInitialized());
+
+        for (std::uint16_t adcVal{}; adcVal <= adc.maxValue(); adcVal += 16U)
+        {
+            adc.setValue(adcVal);
+            EXPECT_NEAR(piecewise.predict(adcVal * voltageStep), tempSensor.read(), 1);
+        }
+    }
+
+    // Case 3 - Expect readings of a neural network to match its predictions.
+    {
+        // Network predicting T = 20 + 30 * |x|, where x = (ADC value - 512) / 512.
+        constexpr std::int8_t hiddenWeights[]{64, -64};
+        constexpr std::int32_t hiddenBiases[]{0, 0};
+        constexpr std::int8_t outputWeights[]{30, 30};
+        constexpr std::int32_t outputBiases[]{20L << ml::nn::ActivationFracBits};
+        const ml::nn::Dense<std::int8_t> layers[]{
+            {hiddenWeights, hiddenBiases, 1U, 2U, 6U, ml::nn::Activation::Relu},
+            {outputWeights, outputBiases, 2U, 1U, 8U, ml::nn::Activation::Linear},
+        };
+        const ml::nn::Network<std::int8_t, 2U, 2U> network{layers, 512U, 32768U, 4U};
+        tempsensor::Smart tempSensor{tempSensorPin, adc, network};
+        EXPECT_TRUE(tempSensor.isInitialized());
+
+        for (std::uint16_t adcVal{}; adcVal <= adc.maxValue(); adcVal += 16U)
+        {
+            adc.setValue(adcVal);
+            EXPECT_EQ(network.predict(adcVal), tempSensor.read());
+            EXPECT_NEAR(20.0 + 30.0 * std::abs(adcVal - 512.0) / 512.0, tempSensor.read(), 1);
+        }
+    }
+}
 } // namespace
 } // namespace driver.
 
@@ -131,6 +131,165 @@ TEST(TempSensor_Tmp36, Accuracy)
         EXPECT_EQ(tempSensor->read(), expectedTemp);
     }
 }
+
+/**
+ * @brief Temp sensor lookup table test.
+ * 
+ *        Verify that the lookup table matches the conversion formula for every ADC value, 
+ *        that the configured range and resolution are respected, that only the ADC values 
+ *        within the range are stored and that temperatures are computed for ADC resolutions 
+ *        the table doesn't cover.
+ */
+TEST(TempSensor_Tmp36, LookupTable)
+{
+    constexpr std::uint8_t tempSensorPin{0U};
+
+    // Case 1 - Expect the default table to match the conversion formula for every ADC value.
+    {
+        adc::Stub adc{};
+        tempsensor::Tmp36 tempSensor{tempSensorPin, adc};
+        constexpr tempsensor::Tmp36::Table table{tempsensor::Tmp36::Table::generate()};
+
+        for (std::uint16_t adcVal{}; adcVal <= 1023U; ++adcVal)
+        {
+            adc.setValue(adcVal);
+            EXPECT_EQ(table.read(adcVal), convertToTemp(adcVal));
+            EXPECT_EQ(tempSensor.read(), convertToTemp(adcVal));
+        }
+    }
+
+    // Case 2 - Expect temperatures outside the configured range to be clamped.
+    {
+        using Table = tempsensor::tmp36::LookupTable<10U, 0U, -40, 125>;
+        constexpr Table table{Table::generate()};
+        EXPECT_EQ(table.read(0U), -40);
+        EXPECT_EQ(table.read(100U), convertToTemp(static_cast<std::uint16_t>(100U)));
+        EXPECT_EQ(table.read(1023U), 125);
+
+        // Expect values exceeding the ADC range to be clamped as well.
+        EXPECT_EQ(table.read(2000U), 125);
+
+        // Expect only the ADC values between -40 and 125 degrees to be stored.
+        EXPECT_EQ(Table::MinAdcValue, 21U);
+        EXPECT_EQ(Table::MaxAdcValue, 358U);
+        EXPECT_EQ(Table::Size, 338U);
+        EXPECT_EQ(sizeof(Table), Table::Size * sizeof(std::int16_t));
+
+        // Expect every ADC value to match the clamped conversion formula.
+        for (std::uint16_t adcVal{}; adcVal <= 1023U; ++adcVal)
+        {
+            const std::int16_t temp{convertToTemp(adcVal)};
+            EXPECT_EQ(table.read(adcVal), -40 > temp ? -40 : (125 < temp ? 125 : temp));
+        }
+    }
+
+    // Case 3 - Expect temperatures to be stored with the configured number of fraction bits.
+    {
+        using Table = tempsensor::tmp36::LookupTable<10U, 4U>;
+        constexpr Table table{Table::generate()};
+
+        for (std::uint16_t adcVal{Table::MinAdcValue}; adcVal <= Table::MaxAdcValue; 
+             adcVal += 31U)
+        {
+            const double temp{100.0 * computeInputVoltage(adcVal) - 50.0};
+            EXPECT_NEAR(table.values[adcVal - Table::MinAdcValue] / 16.0, temp, 1.0 / 32.0);
+
+            // Expect whole degrees to be read, rounded from the stored fixed-point value.
+            EXPECT_NEAR(table.read(adcVal), temp, 0.5 + 1.0 / 32.0);
+        }
+    }
+
+    // Case 4 - Expect temperatures to be computed if the ADC resolution doesn't match.
+    {
+        adc::Stub adc{12U};
+        tempsensor::Tmp36 tempSensor{tempSensorPin, adc};
+
+        for (std::uint16_t adcVal{}; adcVal <= 4095U; adcVal += 45U)
+        {
+            adc.setValue(adcVal);
+            const double temp{100.0 * adcVal / 4095.0 * 5.0 - 50.0};
+            EXPECT_EQ(tempSensor.read(), utils::round<std::int16_t>(temp));
+        }
+    }
+}
+
+/** Temperature passed to the read callback. */
+std::int16_t myCallbackTemp{};
+
+/** The number of read callback invocations. */
+std::uint16_t myCallbackCount{};
+
+// -----------------------------------------------------------------------------
+void readCallback(const std::int16_t temperature) noexcept
+{
+    myCallbackTemp = temperature;
+    ++myCallbackCount;
+}
+
+/**
+ * @brief Temp sensor non-blocking read test.
+ * 
+ *        Verify that non-blocking reads are started via the interrupt-driven ADC, that the 
+ *        reading is fetched via poll() once the conversion is complete and that the callback 
+ *        is invoked with the same temperature as a blocking read.
+ */
+TEST(TempSensor_Tmp36, NonBlockingRead)
+{
+    constexpr std::uint8_t tempSensorPin{0U};
+    constexpr std::uint16_t adcVal{300U};
+    adc::Stub adc{};
+    tempsensor::Tmp36 tempSensor{tempSensorPin, adc};
+    std::int16_t temperature{};
+
+    // Case 1 - Poll without starting a read, expect no reading.
+    {
+        EXPECT_FALSE(tempSensor.isReading());
+        EXPECT_FALSE(tempSensor.poll(temperature));
+    }
+
+    // Case 2 - Start a read, expect no reading until the conversion is complete.
+    {
+        adc.setValue(adcVal);
+        EXPECT_TRUE(tempSensor.startRead());
+        EXPECT_TRUE(tempSensor.isReading());
+        EXPECT_TRUE(adc.isConverting());
+        EXPECT_FALSE(tempSensor.startRead());
+        EXPECT_FALSE(tempSensor.poll(temperature));
+    }
+
+    // Case 3 - Complete the conversion, expect the temperature to be fetched once.
+    {
+        EXPECT_TRUE(adc.convert());
+        EXPECT_TRUE(tempSensor.poll(temperature));
+        EXPECT_EQ(temperature, convertToTemp(adcVal));
+        EXPECT_FALSE(tempSensor.isReading());
+        EXPECT_FALSE(tempSensor.poll(temperature));
+    }
+
+    // Case 4 - Start a read with a callback, expect the callback to be invoked from poll().
+    {
+        myCallbackCount = 0U;
+        adc.setValue(adcVal + 100U);
+        EXPECT_TRUE(tempSensor.startRead(readCallback));
+        EXPECT_TRUE(adc.convert());
+        EXPECT_EQ(myCallbackCount, 0U);
+        EXPECT_TRUE(tempSensor.poll(temperature));
+        EXPECT_EQ(myCallbackCount, 1U);
+        EXPECT_EQ(myCallbackTemp, temperature);
+        EXPECT_EQ(temperature, tempSensor.read());
+    }
+
+    // Case 5 - Expect reads to be rejected if the ADC is busy or the sensor uninitialized.
+    {
+        EXPECT_TRUE(adc.startSampling(tempSensorPin));
+        EXPECT_FALSE(tempSensor.startRead());
+        EXPECT_FALSE(tempSensor.isReading());
+        adc.stopSampling();
+
+        adc.setInitialized(false);
+        EXPECT_FALSE(tempSensor.startRead());
+    }
+}
 } // namespace
 } // namespace driver
 
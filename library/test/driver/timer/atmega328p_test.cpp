@@ -222,6 +222,48 @@ TEST(Timer_Atmega328p, Restart)
         EXPECT_TRUE(callbackInvoked);
 }
 
+/**
+ * @brief Timer elapsed time test.
+ * 
+ *        Verify that the elapsed time increases with each interrupt while the timer is 
+ *        enabled, and that it isn't reset on timeout or restart.
+ */
+TEST(Timer_Atmega328p, ElapsedTime)
+{
+    constexpr std::uint32_t interruptInterval_us{128U};
+    constexpr std::uint32_t timeoutMs{10U};
+    const std::uint32_t maxCount{getMaxCount(timeoutMs)};
+    timer::Atmega328p timer{timeoutMs};
+
+    // Case 1 - Verify that no time elapses while the timer is disabled.
+    {
+        EXPECT_EQ(0U, timer.elapsed_us());
+        timer.handleCallback();
+        EXPECT_EQ(0U, timer.elapsed_us());
+    }
+
+    // Case 2 - Verify that the elapsed time increases by the interrupt interval.
+    {
+        timer.start();
+        timer.handleCallback();
+        EXPECT_EQ(interruptInterval_us, timer.elapsed_us());
+    }
+
+    // Case 3 - Verify that the elapsed time keeps increasing after timeout.
+    {
+        for (std::uint32_t count{1U}; count < maxCount + 1U; ++count) { timer.handleCallback(); }
+        EXPECT_FALSE(timer.hasTimedOut());
+        EXPECT_EQ((maxCount + 1U) * interruptInterval_us, timer.elapsed_us());
+    }
+
+    // Case 4 - Verify that the elapsed time isn't reset on restart.
+    {
+        timer.restart();
+        timer.handleCallback();
+        EXPECT_EQ((maxCount + 2U) * interruptInterval_us, timer.elapsed_us());
+    }
+}
+
 //! @todo Add more tests here (e.g., register verification, multiple timers running simultaneously).
 
 } // namespace
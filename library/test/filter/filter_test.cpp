@@ -0,0 +1,186 @@
+/**
+ * @brief Unit tests for the streaming filters.
+ */
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "filter/chain.h"
+#include "filter/ema.h"
+#include "filter/median.h"
+#include "filter/moving_average.h"
+
+#ifdef TESTSUITE
+
+namespace filter
+{
+namespace
+{
+// -----------------------------------------------------------------------------
+std::int16_t referenceMedian(std::vector<std::int16_t> window)
+{
+    std::sort(window.begin(), window.end());
+    return window[window.size() / 2U];
+}
+
+/**
+ * @brief Moving average filter test.
+ * 
+ *        Verify that the filter averages the samples received so far until the window is 
+ *        filled, that the oldest sample is replaced afterwards and that averages are rounded 
+ *        to the nearest integer for both positive and negative samples.
+ */
+TEST(Filter_MovingAverage, Update)
+{
+    MovingAverage<std::int16_t, 4U> filter{};
+
+    // Case 1 - Fill the window, expect the average of the samples received so far.
+    {
+        EXPECT_EQ(filter.update(10), 10);
+        EXPECT_EQ(filter.update(20), 15);
+        EXPECT_EQ(filter.update(30), 20);
+        EXPECT_EQ(filter.update(40), 25);
+    }
+
+    // Case 2 - Add more samples, expect the oldest samples to be replaced.
+    {
+        EXPECT_EQ(filter.update(50), 35);
+        EXPECT_EQ(filter.update(-100), 5);
+    }
+
+    // Case 3 - Reset the filter, expect averages to be rounded away from zero on ties.
+    {
+        filter.reset();
+        EXPECT_EQ(filter.update(1), 1);
+        EXPECT_EQ(filter.update(2), 2);
+        filter.reset();
+        EXPECT_EQ(filter.update(-1), -1);
+        EXPECT_EQ(filter.update(-2), -2);
+        EXPECT_EQ(filter.update(0), -1);
+    }
+
+    // Case 4 - Feed full-scale samples, expect the running sum not to overflow.
+    {
+        MovingAverage<std::uint16_t, 255U> wideFilter{};
+        std::uint16_t average{};
+        for (std::uint16_t i{}; i < 300U; ++i) { average = wideFilter.update(UINT16_MAX); }
+        EXPECT_EQ(average, UINT16_MAX);
+    }
+}
+
+/**
+ * @brief Median filter test.
+ * 
+ *        Verify that the filter suppresses single outliers and that it returns the same 
+ *        median as sorting the window, including duplicate samples.
+ */
+TEST(Filter_Median, Update)
+{
+    // Case 1 - Add an outlier, expect it to be suppressed.
+    {
+        Median<std::int16_t, 3U> filter{};
+        EXPECT_EQ(filter.update(20), 20);
+        EXPECT_EQ(filter.update(21), 21);
+        EXPECT_EQ(filter.update(500), 21);
+        EXPECT_EQ(filter.update(22), 22);
+        EXPECT_EQ(filter.update(-300), 22);
+        EXPECT_EQ(filter.update(23), 22);
+    }
+
+    // Case 2 - Feed a pseudo-random sequence with duplicates, compare with a sorted window.
+    {
+        constexpr std::size_t windowSize{7U};
+        Median<std::int16_t, windowSize> filter{};
+        std::vector<std::int16_t> window{};
+        std::uint16_t seed{0xACE1U};
+
+        for (std::uint16_t i{}; i < 200U; ++i)
+        {
+            // Generate samples between -8 and 7 to get plenty of duplicates.
+            seed = static_cast<std::uint16_t>(seed * 25173U + 13849U);
+            const auto sample{static_cast<std::int16_t>((seed >> 8U) % 16U - 8)};
+
+            window.push_back(sample);
+            if (windowSize < window.size()) { window.erase(window.begin()); }
+            EXPECT_EQ(filter.update(sample), referenceMedian(window));
+        }
+    }
+}
+
+/**
+ * @brief Exponential moving average filter test.
+ * 
+ *        Verify that the first sample initializes the average, that the average converges 
+ *        to a constant input and that it moves by a fraction of each step.
+ */
+TEST(Filter_Ema, Update)
+{
+    Ema<std::int16_t, 2U> filter{};
+
+    // Case 1 - Add the first sample, expect it to initialize the average.
+    {
+        EXPECT_EQ(filter.update(100), 100);
+        EXPECT_EQ(filter.update(100), 100);
+    }
+
+    // Case 2 - Step the input, expect the average to move by a quarter of the difference.
+    {
+        EXPECT_EQ(filter.update(200), 125);
+        EXPECT_EQ(filter.update(200), 144);
+    }
+
+    // Case 3 - Hold the input, expect the average to converge to it exactly.
+    {
+        std::int16_t average{};
+        for (std::uint8_t i{}; i < 50U; ++i) { average = filter.update(200); }
+        EXPECT_EQ(average, 200);
+        for (std::uint8_t i{}; i < 50U; ++i) { average = filter.update(-37); }
+        EXPECT_EQ(average, -37);
+    }
+
+    // Case 4 - Reset the filter, expect the next sample to initialize the average.
+    {
+        filter.reset();
+        EXPECT_EQ(filter.update(-5), -5);
+    }
+}
+
+/**
+ * @brief Filter chain test.
+ * 
+ *        Verify that an empty chain passes samples through unchanged and that samples are 
+ *        passed through the filters of a chain in order.
+ */
+TEST(Filter_Chain, Update)
+{
+    // Case 1 - Use an empty chain, expect the samples to be unchanged.
+    {
+        Chain<> chain{};
+        EXPECT_EQ(chain.update(static_cast<std::int16_t>(-42)), -42);
+    }
+
+    // Case 2 - Chain a median and a moving average filter, expect the outlier to be removed
+    //          before averaging.
+    {
+        Chain<Median<std::int16_t, 3U>, MovingAverage<std::int16_t, 2U>> chain{};
+        EXPECT_EQ(chain.update(10), 10);
+        EXPECT_EQ(chain.update(10), 10);
+        EXPECT_EQ(chain.update(1000), 10);
+        EXPECT_EQ(chain.update(20), 15);
+    }
+
+    // Case 3 - Reset the chain, expect all filters to be reset.
+    {
+        Chain<Median<std::int16_t, 3U>, Ema<std::int16_t, 1U>> chain{};
+        chain.update(10);
+        chain.update(30);
+        chain.reset();
+        EXPECT_EQ(chain.update(-20), -20);
+    }
+}
+} // namespace
+} // namespace filter
+
+#endif /** TESTSUITE */
@@ -0,0 +1,108 @@
+/**
+ * @brief Unit tests for the host-side work-stealing thread pool.
+ */
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "concurrency/thread_pool.h"
+
+#ifdef TESTSUITE
+
+namespace host
+{
+namespace
+{
+/**
+ * @brief Thread pool happy path test.
+ * 
+ *        Verify that all submitted tasks run exactly once before wait() returns, also when 
+ *        tasks submit further tasks.
+ */
+TEST(Host_ThreadPool, HappyPath)
+{
+    concurrency::ThreadPool pool{4U};
+    EXPECT_EQ(4U, pool.threadCount());
+
+    // Case 1 - Expect each task to run exactly once.
+    {
+        std::vector<std::atomic<int>> counters(1000U);
+        for (auto& counter : counters) 
+        { 
+            pool.submit([&counter]() { counter++; }); 
+        }
+        pool.wait();
+        for (const auto& counter : counters) { EXPECT_EQ(1, counter); }
+    }
+
+    // Case 2 - Expect tasks submitted by tasks to complete before wait() returns.
+    {
+        std::atomic<int> count{};
+        for (int i{}; i < 10; ++i)
+        {
+            pool.submit([&pool, &count]()
+            {
+                for (int j{}; j < 10; ++j) { pool.submit([&count]() { count++; }); }
+                count++;
+            });
+        }
+        pool.wait();
+        EXPECT_EQ(110, count);
+    }
+
+    // Case 3 - Expect the first exception thrown by a task to be rethrown by wait() once all 
+    //          tasks have completed, and to be cleared afterwards.
+    {
+        std::atomic<int> count{};
+        pool.submit([]() { throw 1; });
+        pool.submit([&count]() { count++; });
+        EXPECT_THROW(pool.wait(), int);
+        EXPECT_EQ(1, count);
+        EXPECT_NO_THROW(pool.wait());
+    }
+
+    // Case 4 - Expect the default pool to use at least one thread, and wait() to return 
+    //          immediately without tasks.
+    {
+        concurrency::ThreadPool defaultPool{};
+        EXPECT_LE(1U, defaultPool.threadCount());
+        defaultPool.wait();
+    }
+}
+
+/**
+ * @brief Work stealing test.
+ * 
+ *        Verify that tasks queued on a busy worker are stolen and run by the other workers.
+ */
+TEST(Host_ThreadPool, WorkStealing)
+{
+    concurrency::ThreadPool pool{2U};
+    std::atomic<bool> release{false};
+    std::atomic<int> count{};
+
+    // Block the first worker with a task queuing more tasks in its own queue, expect the 
+    // second worker to steal and run them while the first worker is blocked.
+    pool.submit([&pool, &release, &count]()
+    {
+        for (int i{}; i < 10; ++i) { pool.submit([&count]() { count++; }); }
+        while (!release) { std::this_thread::yield(); }
+    });
+
+    const auto deadline{std::chrono::steady_clock::now() + std::chrono::seconds{5}};
+    while ((10 > count) && (std::chrono::steady_clock::now() < deadline)) 
+    { 
+        std::this_thread::yield(); 
+    }
+    EXPECT_EQ(10, count);
+    release = true;
+    pool.wait();
+}
+} // namespace
+} // namespace host
+
+#endif /** TESTSUITE */
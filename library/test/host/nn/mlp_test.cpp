@@ -0,0 +1,212 @@
+/**
+ * @brief Unit tests for the host-side multilayer perceptron.
+ */
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "ml/nn/network.h"
+#include "nn/mlp.h"
+
+#ifdef TESTSUITE
+
+namespace host
+{
+namespace
+{
+/** Max value of a 10-bit ADC. */
+constexpr std::uint16_t AdcMax{1023U};
+
+/** The number of layers of a 1-8-1 network. */
+constexpr std::uint8_t LayerCount{2U};
+
+/** The number of hidden neurons of a 1-8-1 network. */
+constexpr std::uint8_t HiddenWidth{8U};
+
+// -----------------------------------------------------------------------------
+double thermistor(const std::uint16_t adcValue) noexcept
+{
+    // NTC thermistor (10 kOhm, B = 3950) in a voltage divider with 10 kOhm at 5 V.
+    const double voltage{5.0 * adcValue / AdcMax};
+    const double resistanceRatio{voltage / (5.0 - voltage)};
+    return 1.0 / (1.0 / 298.15 + std::log(resistanceRatio) / 3950.0) - 273.15;
+}
+
+/**
+ * @brief Storage of the weights and layer descriptors of a quantized 1-8-1 network.
+ * 
+ * @tparam Weight The weight type.
+ */
+template <typename Weight>
+struct Layers
+{
+    // -----------------------------------------------------------------------------
+    explicit Layers(const nn::QuantizedMlp& network)
+    {
+        for (std::uint8_t i{}; i < LayerCount; ++i)
+        {
+            const nn::QuantizedLayer& layer{network.layers[i]};
+            weights[i].assign(layer.weights.begin(), layer.weights.end());
+            dense[i] = {weights[i].data(), layer.biases.data(), layer.inputCount, 
+                        layer.outputCount, layer.shift, layer.activation};
+        }
+    }
+
+    /** Weights of each layer. */
+    std::vector<Weight> weights[LayerCount];
+
+    /** Layer descriptors referencing the weights and the biases of the quantized network. */
+    ml::nn::Dense<Weight> dense[LayerCount];
+};
+
+// -----------------------------------------------------------------------------
+template <typename Weight>
+double maxQuantizationError(const nn::Mlp& mlp, const nn::QuantizedMlp& quantized)
+{
+    const Layers<Weight> layers{quantized};
+    const ml::nn::Network<Weight, LayerCount, HiddenWidth> network{
+        layers.dense, quantized.inputOffset, quantized.inputScale, quantized.outputFracBits};
+    EXPECT_TRUE(network.isTrained());
+
+    // Compare the predictions over the training range, excluding rounding to integers.
+    double result{};
+    for (std::uint16_t adcValue{100U}; adcValue <= 920U; ++adcValue)
+    {
+        const double expected{mlp.predict(adcValue)};
+        EXPECT_NEAR(expected, network.predict(adcValue), 0.5 + 1.0);
+        const double difference{static_cast<double>(adcValue) - quantized.inputOffset};
+        const std::int16_t input{static_cast<std::int16_t>(std::floor(std::ldexp(
+            difference * quantized.inputScale, ml::nn::ActivationFracBits - 24)))};
+        std::int16_t output{};
+        EXPECT_TRUE(network.infer(&input, &output));
+        const double error{std::fabs(std::ldexp(output, -quantized.outputFracBits) - expected)};
+        result = error > result ? error : result;
+    }
+    return result;
+}
+
+/**
+ * @brief Thermistor calibration test.
+ * 
+ *        Verify that a 1-8-1 network fits a thermistor much better than a linear model and 
+ *        that the quantized networks predict as the floating-point reference.
+ */
+TEST(Host_Mlp, Thermistor)
+{
+    std::vector<double> trainIn{};
+    std::vector<double> trainOut{};
+    for (std::uint16_t adcValue{100U}; adcValue <= 920U; adcValue += 8U)
+    {
+        trainIn.push_back(adcValue);
+        trainOut.push_back(thermistor(adcValue));
+    }
+
+    nn::Mlp mlp{{HiddenWidth}};
+    EXPECT_FALSE(mlp.isTrained());
+    EXPECT_EQ(LayerCount, mlp.layerCount());
+
+    // Train the network, expect a max error of a few tenths of a degree over a range where 
+    // the max error of a linear model exceeds ten degrees.
+    const double meanSquaredError{mlp.train(trainIn, trainOut, 2000U, 0.2)};
+    EXPECT_TRUE(mlp.isTrained());
+    EXPECT_LE(0.0, meanSquaredError);
+    EXPECT_GT(0.5, meanSquaredError);
+    for (std::size_t i{}; i < trainIn.size(); ++i)
+    {
+        EXPECT_NEAR(trainOut[i], mlp.predict(trainIn[i]), 1.5);
+    }
+
+    // Quantize with 8-bit and 16-bit weights, expect 16-bit weights to be far more accurate.
+    nn::QuantizedMlp quantized8{};
+    nn::QuantizedMlp quantized16{};
+    EXPECT_TRUE(mlp.quantize(8U, 6U, quantized8));
+    EXPECT_TRUE(mlp.quantize(16U, 6U, quantized16));
+    ASSERT_EQ(LayerCount, quantized8.layers.size());
+    ASSERT_EQ(LayerCount, quantized16.layers.size());
+
+    const double error8{maxQuantizationError<std::int8_t>(mlp, quantized8)};
+    const double error16{maxQuantizationError<std::int16_t>(mlp, quantized16)};
+    EXPECT_GT(1.0, error8);
+    EXPECT_GT(0.1, error16);
+    EXPECT_GT(error8, error16);
+}
+
+/**
+ * @brief Invalid parameters test.
+ * 
+ *        Verify that training and quantization fail with invalid parameters.
+ */
+TEST(Host_Mlp, Invalid)
+{
+    const std::vector<double> trainIn{0.0, 512.0, 1023.0};
+    const std::vector<double> trainOut{-10.0, 0.0, 10.0};
+    nn::QuantizedMlp quantized{};
+
+    // Case 1 - Expect an untrained network to predict 0 and not to be quantized.
+    {
+        nn::Mlp mlp{{4U}, nn::Activation::Relu};
+        EXPECT_EQ(0.0, mlp.predict(512.0));
+        EXPECT_FALSE(mlp.quantize(8U, 6U, quantized));
+    }
+
+    // Case 2 - Expect training to fail with invalid parameters or invalid layer widths.
+    {
+        nn::Mlp mlp{{4U}};
+        EXPECT_GT(0.0, mlp.train({}, {}, 10U));
+        EXPECT_GT(0.0, mlp.train(trainIn, trainOut, 0U));
+        EXPECT_GT(0.0, mlp.train(trainIn, trainOut, 10U, 0.0));
+        EXPECT_GT(0.0, mlp.train(trainIn, trainOut, 10U, 1.5));
+        EXPECT_FALSE(mlp.isTrained());
+
+        nn::Mlp empty{{0U}};
+        nn::Mlp wide{{256U}};
+        EXPECT_GT(0.0, empty.train(trainIn, trainOut, 10U));
+        EXPECT_GT(0.0, wide.train(trainIn, trainOut, 10U));
+    }
+
+    // Case 3 - Expect quantization to fail with invalid weight or output fraction bits.
+    {
+        nn::Mlp mlp{{4U}};
+        EXPECT_LE(0.0, mlp.train(trainIn, trainOut, 10U));
+        EXPECT_FALSE(mlp.quantize(4U, 6U, quantized));
+        EXPECT_FALSE(mlp.quantize(8U, 16U, quantized));
+        EXPECT_TRUE(mlp.quantize(16U, 6U, quantized));
+    }
+}
+
+/**
+ * @brief Source export test.
+ * 
+ *        Verify that the generated source code defines the weights, the biases, the layers 
+ *        and the network parameters.
+ */
+TEST(Host_Mlp, ExportSource)
+{
+    nn::QuantizedMlp network{};
+    network.layers.push_back({{64, -64}, {0, 4096}, 1U, 2U, 6U, nn::Activation::Tanh});
+    network.layers.push_back({{100, 100}, {81920}, 2U, 1U, 8U, nn::Activation::Linear});
+    network.inputOffset    = 512U;
+    network.inputScale     = 32768U;
+    network.outputFracBits = 4U;
+    network.weightBits     = 8U;
+
+    const std::string source{nn::exportSource(network, "Calibration")};
+    EXPECT_NE(std::string::npos, 
+              source.find("constexpr int8_t CalibrationWeights0[] PROGMEM{64, -64, };"));
+    EXPECT_NE(std::string::npos, 
+              source.find("constexpr int32_t CalibrationBiases1[] PROGMEM{81920L, };"));
+    EXPECT_NE(std::string::npos, 
+              source.find("constexpr ml::nn::Dense<int8_t> CalibrationLayers[]{"));
+    EXPECT_NE(std::string::npos, source.find("    {CalibrationWeights0, CalibrationBiases0, "
+                                             "1U, 2U, 6U, ml::nn::Activation::Tanh},"));
+    EXPECT_NE(std::string::npos, source.find("constexpr uint16_t CalibrationInputOffset{512U};"));
+    EXPECT_NE(std::string::npos, source.find("constexpr uint16_t CalibrationInputScale{32768U};"));
+    EXPECT_NE(std::string::npos, source.find("constexpr uint8_t CalibrationOutputFracBits{4U};"));
+}
+} // namespace
+} // namespace host
+
+#endif /** TESTSUITE */
@@ -0,0 +1,86 @@
+/**
+ * @brief Unit tests for the host-side protocol decoder.
+ */
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "driver/serial/stub.h"
+#include "protocol/decoder.h"
+
+#ifdef TESTSUITE
+
+namespace host
+{
+namespace
+{
+// -----------------------------------------------------------------------------
+std::vector<std::uint8_t> toVector(const container::Vector<std::uint8_t>& data)
+{
+    return std::vector<std::uint8_t>(data.data(), data.data() + data.size());
+}
+
+/**
+ * @brief Decoder stream test.
+ * 
+ *        Verify that frames fed in arbitrary chunks are decoded, and that the decoder
+ *        resynchronizes after dropped bytes.
+ */
+TEST(Host_Decoder, Stream)
+{
+    driver::serial::Stub serial{};
+    driver::serial::Protocol protocol{serial};
+
+    // Transmit a temperature message and a toggle state message.
+    EXPECT_TRUE(protocol.sendTemperature(23));
+    EXPECT_TRUE(protocol.sendToggleState(false));
+    const std::vector<std::uint8_t> stream{toVector(serial.writeBuffer())};
+
+    // Case 1 - Feed the stream one byte at a time, expect both messages to be decoded.
+    {
+        protocol::Decoder decoder{};
+        std::size_t decoded{};
+        for (const auto& byte : stream) { decoded += decoder.feed(&byte, 1U); }
+        EXPECT_EQ(decoded, 2U);
+
+        protocol::Message message{};
+        EXPECT_TRUE(decoder.next(message));
+        EXPECT_EQ(protocol::format(message), "Temperature: 23 Celsius");
+        EXPECT_TRUE(decoder.next(message));
+        EXPECT_EQ(protocol::format(message), "Toggle timer disabled!");
+        EXPECT_FALSE(decoder.hasMessage());
+    }
+
+    // Case 2 - Drop the second byte of the stream, expect the first frame to be dropped
+    // and the second frame to be decoded.
+    {
+        std::vector<std::uint8_t> damaged{stream};
+        damaged.erase(damaged.begin() + 1U);
+
+        protocol::Decoder decoder{};
+        EXPECT_EQ(decoder.feed(damaged), 1U);
+        EXPECT_EQ(decoder.statistics().corruptFrames, 1U);
+        EXPECT_EQ(decoder.statistics().validFrames, 1U);
+
+        protocol::Message message{};
+        EXPECT_TRUE(decoder.next(message));
+        EXPECT_EQ(message.type, protocol::MessageType::ToggleState);
+    }
+
+    // Case 3 - Feed a long run of non-zero bytes, expect an oversized frame to be dropped
+    // and decoding to resume afterwards.
+    {
+        std::vector<std::uint8_t> data(1000U, 0xAAU);
+        data.push_back(0U);
+        data.insert(data.end(), stream.begin(), stream.end());
+
+        protocol::Decoder decoder{};
+        EXPECT_EQ(decoder.feed(data), 2U);
+        EXPECT_EQ(decoder.statistics().oversizedFrames, 1U);
+    }
+}
+} // namespace
+} // namespace host
+
+#endif /** TESTSUITE */
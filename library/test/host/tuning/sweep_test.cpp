@@ -0,0 +1,211 @@
+/**
+ * @brief Unit tests for the host-side hyperparameter sweep.
+ */
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "concurrency/thread_pool.h"
+#include "tuning/sweep.h"
+
+#ifdef TESTSUITE
+
+namespace host
+{
+namespace
+{
+// -----------------------------------------------------------------------------
+void createTrainingData(std::vector<double>& trainIn, std::vector<double>& trainOut)
+{
+    // Training data following T = 10 * Uin^2 - 20 over [0, 2] with a small deterministic 
+    // disturbance.
+    for (std::size_t i{}; i <= 40U; ++i)
+    {
+        const double voltage{0.05 * i};
+        trainIn.push_back(voltage);
+        trainOut.push_back(10.0 * voltage * voltage - 20.0 + 0.1 * std::sin(7.0 * i));
+    }
+}
+
+/**
+ * @brief Cross-validation test.
+ * 
+ *        Verify that cross-validation ranks models by how well they generalize and rejects
+ *        invalid configurations.
+ */
+TEST(Host_Sweep, CrossValidate)
+{
+    std::vector<double> trainIn{};
+    std::vector<double> trainOut{};
+    createTrainingData(trainIn, trainOut);
+
+    // Case 1 - Expect a quadratic model to validate far better than a linear model.
+    {
+        const tuning::Result linear{tuning::crossValidate(
+            {tuning::ModelType::LeastSquares}, trainIn, trainOut, 5U)};
+        const tuning::Result quadratic{tuning::crossValidate(
+            {tuning::ModelType::Quadratic}, trainIn, trainOut, 5U)};
+        EXPECT_TRUE(linear.valid);
+        EXPECT_TRUE(quadratic.valid);
+        EXPECT_GT(0.05, quadratic.meanError);
+        EXPECT_LT(10.0 * quadratic.meanError, linear.meanError);
+        EXPECT_LE(0.0, quadratic.errorDeviation);
+    }
+
+    // Case 2 - Expect gradient descent to be valid with a small learning rate, but never 
+    //          better than least squares, and to fail when diverging.
+    {
+        const tuning::Result leastSquares{tuning::crossValidate(
+            {tuning::ModelType::LeastSquares}, trainIn, trainOut, 5U)};
+        const tuning::Result gradientDescent{tuning::crossValidate(
+            {tuning::ModelType::GradientDescent, 0.01, 100U}, trainIn, trainOut, 5U)};
+        const tuning::Result diverging{tuning::crossValidate(
+            {tuning::ModelType::GradientDescent, 1.0, 100U}, trainIn, trainOut, 5U)};
+        EXPECT_TRUE(gradientDescent.valid);
+        EXPECT_LT(leastSquares.meanError, gradientDescent.meanError);
+        EXPECT_GT(3.0 * leastSquares.meanError, gradientDescent.meanError);
+        EXPECT_FALSE(diverging.valid);
+    }
+
+    // Case 3 - Expect invalid fold counts and training parameters to be rejected.
+    {
+        EXPECT_FALSE(tuning::crossValidate({tuning::ModelType::Quadratic}, trainIn, trainOut, 
+                                           1U).valid);
+        EXPECT_FALSE(tuning::crossValidate({tuning::ModelType::Quadratic}, trainIn, trainOut, 
+                                           trainIn.size() + 1U).valid);
+        EXPECT_FALSE(tuning::crossValidate({tuning::ModelType::GradientDescent, 2.0, 10U}, 
+                                           trainIn, trainOut, 5U).valid);
+        EXPECT_FALSE(tuning::crossValidate({tuning::ModelType::Count}, trainIn, trainOut, 
+                                           5U).valid);
+    }
+}
+
+/**
+ * @brief Configuration generation test.
+ * 
+ *        Verify that grids combine the hyperparameters of gradient descent only and that 
+ *        random configurations lie within the given ranges.
+ */
+TEST(Host_Sweep, Configs)
+{
+    // Case 1 - Expect 3 x 2 gradient descent configurations and one per closed-form model.
+    {
+        const std::vector<tuning::Config> configs{tuning::gridConfigs(
+            {tuning::ModelType::Cubic, tuning::ModelType::GradientDescent}, 
+            {0.01, 0.1, 1.0}, {10U, 100U})};
+        ASSERT_EQ(7U, configs.size());
+        EXPECT_EQ(tuning::ModelType::Cubic, configs[0U].model);
+        EXPECT_EQ(tuning::ModelType::GradientDescent, configs[6U].model);
+        EXPECT_EQ(1.0, configs[6U].learningRate);
+        EXPECT_EQ(100U, configs[6U].epochCount);
+    }
+
+    // Case 2 - Expect random configurations within the ranges, reproducible with the seed.
+    {
+        const std::vector<tuning::Config> configs{
+            tuning::randomConfigs(100U, 1.0e-3, 0.1, 10U, 1000U, 42U)};
+        const std::vector<tuning::Config> repeated{
+            tuning::randomConfigs(100U, 1.0e-3, 0.1, 10U, 1000U, 42U)};
+        ASSERT_EQ(100U, configs.size());
+        ASSERT_EQ(100U, repeated.size());
+
+        for (std::size_t i{}; i < configs.size(); ++i)
+        {
+            EXPECT_EQ(tuning::ModelType::GradientDescent, configs[i].model);
+            EXPECT_LE(1.0e-3, configs[i].learningRate);
+            EXPECT_GE(0.1, configs[i].learningRate);
+            EXPECT_LE(10U, configs[i].epochCount);
+            EXPECT_GE(1000U, configs[i].epochCount);
+            EXPECT_EQ(configs[i].learningRate, repeated[i].learningRate);
+            EXPECT_EQ(configs[i].epochCount, repeated[i].epochCount);
+        }
+    }
+
+    // Case 3 - Expect invalid ranges to produce no configurations.
+    {
+        EXPECT_TRUE(tuning::randomConfigs(10U, 0.0, 0.1, 10U, 100U).empty());
+        EXPECT_TRUE(tuning::randomConfigs(10U, 0.1, 0.01, 10U, 100U).empty());
+        EXPECT_TRUE(tuning::randomConfigs(10U, 0.01, 0.1, 0U, 100U).empty());
+        EXPECT_TRUE(tuning::randomConfigs(10U, 0.01, 0.1, 100U, 10U).empty());
+    }
+}
+
+/**
+ * @brief Parallel sweep test.
+ * 
+ *        Verify that a parallel sweep matches sequential cross-validation and ranks the
+ *        results by ascending error with failed configurations last.
+ */
+TEST(Host_Sweep, Sweep)
+{
+    std::vector<double> trainIn{};
+    std::vector<double> trainOut{};
+    createTrainingData(trainIn, trainOut);
+    concurrency::ThreadPool pool{4U};
+
+    std::vector<tuning::Config> configs{tuning::gridConfigs(
+        {tuning::ModelType::GradientDescent, tuning::ModelType::LeastSquares, 
+         tuning::ModelType::Quadratic, tuning::ModelType::Cubic, tuning::ModelType::Piecewise},
+        {0.001, 0.01, 0.1, 1.0}, {10U, 100U, 1000U})};
+    configs.push_back({tuning::ModelType::GradientDescent, 0.0, 10U});
+    const std::vector<tuning::Result> results{tuning::sweep(configs, trainIn, trainOut, 4U, pool)};
+    ASSERT_EQ(configs.size(), results.size());
+
+    // Case 1 - Expect the valid results to be ranked by ascending error with a polynomial
+    //          model first, followed by the failed configurations, such as the one with 
+    //          learning rate 0.
+    {
+        std::size_t validCount{};
+        while ((results.size() > validCount) && results[validCount].valid) { ++validCount; }
+        EXPECT_LT(0U, validCount);
+        EXPECT_GT(results.size(), validCount);
+
+        for (std::size_t i{1U}; i < validCount; ++i)
+        {
+            EXPECT_LE(results[i - 1U].meanError, results[i].meanError);
+        }
+        for (std::size_t i{validCount}; i < results.size(); ++i) 
+        { 
+            EXPECT_FALSE(results[i].valid); 
+        }
+        EXPECT_TRUE((tuning::ModelType::Quadratic == results[0U].config.model) || 
+                    (tuning::ModelType::Cubic == results[0U].config.model));
+        EXPECT_EQ(0.0, results.back().config.learningRate);
+    }
+
+    // Case 2 - Expect each result to match sequential cross-validation.
+    {
+        for (const auto& result : results)
+        {
+            const tuning::Result expected{
+                tuning::crossValidate(result.config, trainIn, trainOut, 4U)};
+            EXPECT_EQ(expected.valid, result.valid);
+            if (expected.valid) { EXPECT_DOUBLE_EQ(expected.meanError, result.meanError); }
+        }
+    }
+
+    // Case 3 - Expect the table to hold a header and the requested number of rows.
+    {
+        const std::string table{tuning::formatTable(results, 3U)};
+        EXPECT_EQ(4, std::count(table.begin(), table.end(), '\n'));
+        EXPECT_NE(std::string::npos, table.find("Rank"));
+        EXPECT_NE(std::string::npos, table.find(tuning::modelName(results[0U].config.model)));
+        EXPECT_NE(std::string::npos, tuning::formatTable(results).find("failed"));
+    }
+
+    // Case 4 - Expect an invalid fold count to fail every configuration.
+    {
+        const std::vector<tuning::Result> failed{tuning::sweep(configs, trainIn, trainOut, 
+                                                               1U, pool)};
+        ASSERT_EQ(configs.size(), failed.size());
+        for (const auto& result : failed) { EXPECT_FALSE(result.valid); }
+    }
+}
+} // namespace
+} // namespace host
+
+#endif /** TESTSUITE */
@@ -0,0 +1,125 @@
+/**
+ * @brief Unit tests for deferred logging.
+ */
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "arch/avr/hw_platform.h"
+#include "driver/serial/stub.h"
+#include "logging/deferred.h"
+#include "protocol/decoder.h"
+#include "utils/utils.h"
+
+#ifdef TESTSUITE
+
+namespace logging
+{
+namespace
+{
+// -----------------------------------------------------------------------------
+std::vector<std::string> decode(const container::Vector<std::uint8_t>& data)
+{
+    host::protocol::Decoder decoder{};
+    decoder.feed(data.data(), data.size());
+    std::vector<std::string> messages{};
+    host::protocol::Message message{};
+    while (decoder.next(message)) { messages.push_back(host::protocol::format(message)); }
+    return messages;
+}
+
+/**
+ * @brief Deferred logging test.
+ * 
+ *        Verify that log records are stored without being transmitted, that the records are 
+ *        transmitted on flush and that the host formats them as the corresponding text.
+ */
+TEST(Logging_Deferred, Transmit)
+{
+    driver::serial::Stub serial{};
+    serial.setEnabled(true);
+    driver::serial::Protocol protocol{serial};
+    Deferred logger{protocol};
+
+    // Case 1 - Log messages, expect nothing to be transmitted before flush.
+    {
+        EXPECT_TRUE(logger.log(Id::SystemRunning));
+        EXPECT_TRUE(logger.log(Id::Temperature, static_cast<std::int16_t>(-12)));
+        EXPECT_TRUE(logger.log(Id::ToggleEnabled));
+        EXPECT_LT(0U, logger.pendingBytes());
+        EXPECT_TRUE(serial.writeBuffer().empty());
+    }
+
+    // Case 2 - Flush one record at a time, expect the records to be transmitted in order.
+    {
+        EXPECT_EQ(logger.flush(1U), 1U);
+        EXPECT_EQ(decode(serial.writeBuffer()).size(), 1U);
+        EXPECT_EQ(logger.flush(), 2U);
+        EXPECT_EQ(logger.pendingBytes(), 0U);
+
+        const std::vector<std::string> messages{decode(serial.writeBuffer())};
+        ASSERT_EQ(messages.size(), 3U);
+        EXPECT_EQ(messages[0U], "Running the system!");
+        EXPECT_EQ(messages[1U], "Temperature: -12 Celsius");
+        EXPECT_EQ(messages[2U], "Toggle timer enabled!");
+        serial.clearWriteBuffer();
+    }
+
+    // Case 3 - Expect flush to transmit nothing when no records are pending.
+    {
+        EXPECT_EQ(logger.flush(), 0U);
+        EXPECT_TRUE(serial.writeBuffer().empty());
+    }
+
+    // Case 4 - Expect invalid ids to be rejected.
+    {
+        EXPECT_FALSE(logger.log(Id::Count));
+        EXPECT_EQ(logger.pendingBytes(), 0U);
+    }
+}
+
+/**
+ * @brief Deferred logging overflow test.
+ * 
+ *        Verify that records are dropped when the buffer is full and that the interrupt 
+ *        state is restored after storing records.
+ */
+TEST(Logging_Deferred, Overflow)
+{
+    driver::serial::Stub serial{};
+    serial.setEnabled(true);
+    driver::serial::Protocol protocol{serial};
+    Deferred logger{protocol};
+
+    // Case 1 - Fill the buffer, expect subsequent records to be dropped and counted.
+    {
+        std::uint16_t stored{};
+        while (logger.log(Id::Temperature, INT32_MAX)) { stored++; }
+        EXPECT_LT(0U, stored);
+        EXPECT_FALSE(logger.log(Id::Temperature, INT32_MAX));
+        EXPECT_EQ(logger.droppedRecords(), 2U);
+        EXPECT_GE(Deferred::BufferSize, logger.pendingBytes());
+
+        // Expect all stored records to be transmitted intact.
+        EXPECT_EQ(logger.flush(), stored);
+        const std::vector<std::string> messages{decode(serial.writeBuffer())};
+        ASSERT_EQ(messages.size(), stored);
+        EXPECT_EQ(messages.back(), "Temperature: 2147483647 Celsius");
+    }
+
+    // Case 2 - Expect the global interrupt flag to be unaffected by logging.
+    {
+        utils::globalInterruptEnable();
+        EXPECT_TRUE(logger.log(Id::ToggleDisabled));
+        EXPECT_TRUE(utils::read(SREG, I_FLAG));
+
+        utils::globalInterruptDisable();
+        EXPECT_TRUE(logger.log(Id::ToggleDisabled));
+        EXPECT_FALSE(utils::read(SREG, I_FLAG));
+    }
+}
+} // namespace
+} // namespace logging
+
+#endif /** TESTSUITE */
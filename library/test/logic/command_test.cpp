@@ -0,0 +1,207 @@
+/**
+ * @brief Unit tests for the serial command interpreter.
+ */
+#include <cstdint>
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+#include "driver/serial/stub.h"
+#include "logic/command.h"
+
+#ifdef TESTSUITE
+
+namespace logic
+{
+namespace
+{
+/**
+ * @brief Structure of a command context for testing.
+ */
+struct Context
+{
+    /** The value set by the last command. */
+    std::uint32_t value;
+
+    /** Pointer to the first argument of the last command. */
+    const char* firstArg;
+};
+
+// -----------------------------------------------------------------------------
+command::Status set(Context& context, const command::Args& args) noexcept
+{
+    std::uint32_t value{};
+    if ((1U != args.count) || !args.toUint(0U, value)) { return command::Status::InvalidArgs; }
+    context.value    = value;
+    context.firstArg = args.values[0U];
+    return command::Status::Ok;
+}
+
+// -----------------------------------------------------------------------------
+command::Status reset(Context& context, const command::Args& args) noexcept
+{
+    (void) (args);
+    context.value = 0U;
+    return command::Status::Ok;
+}
+
+// -----------------------------------------------------------------------------
+std::uint32_t clock_us() noexcept
+{
+    // Advance the simulated time 5 us on each call.
+    static std::uint32_t time_us{};
+    return time_us += 5U;
+}
+
+/** Command table for testing. */
+constexpr command::Entry<Context> Commands[]{{"set", &set}, {"reset", &reset}};
+static_assert(command::isUnique(Commands), "Command names must be unique!");
+
+/**
+ * @brief Tokenizer test.
+ * 
+ *        Verify that command lines are tokenized in place and that arguments are parsed 
+ *        correctly.
+ */
+TEST(Logic_Command, Tokenize)
+{
+    // Case 1 - Tokenize a line with surrounding and repeated whitespace, expect the tokens
+    // to point directly into the line.
+    {
+        char line[]{"  eeprom\t 12  4 "};
+        const char* tokens[4U]{};
+        EXPECT_EQ(command::tokenize(line, tokens, 4U), 3U);
+        EXPECT_STREQ(tokens[0U], "eeprom");
+        EXPECT_STREQ(tokens[1U], "12");
+        EXPECT_STREQ(tokens[2U], "4");
+        EXPECT_EQ(tokens[0U], line + 2U);
+    }
+
+    // Case 2 - Expect maxTokens + 1 to be returned if the line holds too many tokens.
+    {
+        char line[]{"a b c"};
+        const char* tokens[2U]{};
+        EXPECT_EQ(command::tokenize(line, tokens, 2U), 3U);
+    }
+
+    // Case 3 - Expect empty lines and invalid parameters to yield no tokens.
+    {
+        char line[]{"   "};
+        const char* tokens[2U]{};
+        EXPECT_EQ(command::tokenize(line, tokens, 2U), 0U);
+        EXPECT_EQ(command::tokenize(nullptr, tokens, 2U), 0U);
+    }
+
+    // Case 4 - Parse arguments, expect invalid digits and overflow to be rejected.
+    {
+        const command::Args args{{"4294967295", "4294967296", "12a", ""}, 4U};
+        std::uint32_t value{};
+        EXPECT_TRUE(args.toUint(0U, value));
+        EXPECT_EQ(value, UINT32_MAX);
+        EXPECT_FALSE(args.toUint(1U, value));
+        EXPECT_FALSE(args.toUint(2U, value));
+        EXPECT_FALSE(args.toUint(3U, value));
+        EXPECT_FALSE(args.toUint(4U, value));
+    }
+}
+
+/**
+ * @brief Interpreter test.
+ * 
+ *        Verify that commands are looked up and executed, and that statistics are updated.
+ */
+TEST(Logic_Command, Execute)
+{
+    Context context{};
+    command::Interpreter<Context, 2U> interpreter{Commands, clock_us};
+    EXPECT_EQ(interpreter.commandCount(), 2U);
+    EXPECT_STREQ(interpreter.name(1U), "reset");
+    EXPECT_EQ(interpreter.name(2U), nullptr);
+    EXPECT_EQ(interpreter.statistics(2U), nullptr);
+
+    // Case 1 - Execute a valid command, expect the argument to point into the line.
+    {
+        char line[]{"set 42"};
+        EXPECT_EQ(interpreter.execute(context, line), command::Status::Ok);
+        EXPECT_EQ(context.value, 42U);
+        EXPECT_EQ(context.firstArg, line + 4U);
+        EXPECT_EQ(interpreter.statistics(0U)->callCount, 1U);
+        EXPECT_EQ(interpreter.statistics(0U)->lastLatency_us, 5U);
+        EXPECT_EQ(interpreter.statistics(0U)->maxLatency_us, 5U);
+        EXPECT_EQ(interpreter.statistics(1U)->callCount, 0U);
+    }
+
+    // Case 2 - Expect unknown commands, empty lines and invalid arguments to be reported.
+    {
+        char unknown[]{"sett 1"};
+        char empty[]{""};
+        char invalid[]{"set x"};
+        char tooMany[]{"set 1 2 3 4 5"};
+        EXPECT_EQ(interpreter.execute(context, unknown), command::Status::Unknown);
+        EXPECT_EQ(interpreter.execute(context, empty), command::Status::Empty);
+        EXPECT_EQ(interpreter.execute(context, invalid), command::Status::InvalidArgs);
+        EXPECT_EQ(interpreter.execute(context, tooMany), command::Status::InvalidArgs);
+        EXPECT_EQ(context.value, 42U);
+        EXPECT_EQ(interpreter.statistics(0U)->callCount, 2U);
+    }
+
+    // Case 3 - Disable latency measurement, expect latency 0 to be recorded.
+    {
+        char line[]{"reset"};
+        interpreter.setClock(nullptr);
+        EXPECT_EQ(interpreter.execute(context, line), command::Status::Ok);
+        EXPECT_EQ(context.value, 0U);
+        EXPECT_EQ(interpreter.statistics(1U)->lastLatency_us, 0U);
+    }
+}
+
+/**
+ * @brief Interpreter polling test.
+ * 
+ *        Verify that commands received via the serial port are executed once complete.
+ */
+TEST(Logic_Command, Poll)
+{
+    Context context{};
+    driver::serial::Stub serial{};
+    command::Interpreter<Context, 2U, 8U> interpreter{Commands};
+    command::Status status{};
+
+    // Case 1 - Receive a partial command, expect nothing to be executed.
+    {
+        const char data[]{"set 1"};
+        serial.setReadBuffer(reinterpret_cast<const std::uint8_t*>(data), std::strlen(data));
+        EXPECT_FALSE(interpreter.poll(serial, context, status));
+        EXPECT_EQ(context.value, 0U);
+    }
+
+    // Case 2 - Receive the rest of the command, expect it to be executed.
+    {
+        const char data[]{"7\r\n"};
+        serial.setReadBuffer(reinterpret_cast<const std::uint8_t*>(data), std::strlen(data));
+        EXPECT_TRUE(interpreter.poll(serial, context, status));
+        EXPECT_EQ(status, command::Status::Ok);
+        EXPECT_EQ(context.value, 17U);
+
+        // Expect the line feed following the carriage return to be ignored.
+        EXPECT_FALSE(interpreter.poll(serial, context, status));
+    }
+
+    // Case 3 - Receive a line exceeding the line buffer, expect it to be dropped.
+    {
+        const char data[]{"set 123456789\nset 5\n"};
+        serial.setReadBuffer(reinterpret_cast<const std::uint8_t*>(data), std::strlen(data));
+        EXPECT_TRUE(interpreter.poll(serial, context, status));
+        EXPECT_EQ(status, command::Status::Overflow);
+        EXPECT_EQ(context.value, 17U);
+
+        // Expect the next command to be executed.
+        EXPECT_TRUE(interpreter.poll(serial, context, status));
+        EXPECT_EQ(status, command::Status::Ok);
+        EXPECT_EQ(context.value, 5U);
+    }
+}
+} // namespace
+} // namespace logic
+
+#endif /** TESTSUITE */
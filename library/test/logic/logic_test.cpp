@@ -16,6 +16,7 @@
 #include "driver/timer/stub.h"
 #include "driver/watchdog/stub.h"
 #include "logic/stub.h"
+#include "protocol/decoder.h"
 
 #ifdef TESTSUITE
 
@@ -411,11 +412,17 @@ TEST(Logic, TempHandling)
         // Release the temperature button.
         mock.tempButton.write(false);
 
-        // Get the number of temperature printouts after pressdown.
+        // Expect the temperature to not be printed from interrupt context.
+        EXPECT_EQ(tempPrintouts1, mock.logicImpl->tempPrintoutCount());
+        EXPECT_TRUE(mock.tempSensor.isReading());
+
+        // Run the system to consume the reading, get the number of temperature printouts.
+        mock.runSystem();
         const uint16_t tempPrintouts2{mock.logicImpl->tempPrintoutCount()};
 
         // Expect one temperature printout.
         EXPECT_EQ(tempPrintouts1 + 1U, tempPrintouts2);
+        EXPECT_FALSE(mock.tempSensor.isReading());
 
         // Simulate debounce timer timeout.
         mock.debounceTimer.setTimedOut(true);
@@ -436,7 +443,11 @@ TEST(Logic, TempHandling)
         // Simulate temperature timer interrupt.
         logic.handleTempTimerTimeout();
 
-        // Get the number of temperature printouts after pressdown.
+        // Expect the temperature to not be printed from interrupt context.
+        EXPECT_EQ(tempPrintouts1, mock.logicImpl->tempPrintoutCount());
+
+        // Run the system to consume the reading, get the number of temperature printouts.
+        mock.runSystem();
         const uint16_t tempPrintouts2{mock.logicImpl->tempPrintoutCount()};
 
         // Expect one temperature printout.
@@ -496,6 +507,190 @@ TEST(Logic, Eeprom)
         EXPECT_TRUE(mock.toggleTimer.isEnabled());
     }
 }
+
+/**
+ * @brief Binary output test.
+ *
+ *        Verify that temperature and state messages are transmitted as binary frames when
+ *        the binary output format is selected.
+ */
+TEST(Logic, BinaryOutput)
+{
+    // Create logic implementation, select binary output and run the system.
+    Mock mock{};
+    logic::Interface& logic{mock.createLogic()};
+    mock.logicImpl->setOutputFormat(OutputFormat::Binary);
+    EXPECT_EQ(mock.logicImpl->outputFormat(), OutputFormat::Binary);
+    mock.runSystem();
+    mock.serial.clearWriteBuffer();
+
+    // Case 1 - Press the toggle button, run the system to transmit the new state. Expect a 
+    // toggle state frame to be transmitted from the main loop.
+    {
+        mock.toggleButton.write(true);
+        logic.handleButtonEvent();
+        mock.toggleButton.write(false);
+        EXPECT_TRUE(mock.serial.writeBuffer().empty());
+        mock.runSystem();
+
+        const auto& data{mock.serial.writeBuffer()};
+        host::protocol::Decoder decoder{};
+        EXPECT_LT(0U, decoder.feed(data.data(), data.size()));
+        host::protocol::Message message{};
+        EXPECT_TRUE(decoder.next(message));
+        EXPECT_EQ(message.type, driver::serial::MessageType::ToggleState);
+        EXPECT_EQ(message.values[0U], 1);
+
+        mock.serial.clearWriteBuffer();
+        mock.debounceTimer.setTimedOut(true);
+        logic.handleDebounceTimerTimeout();
+    }
+
+    // Case 2 - Simulate temperature timer timeout, run the system to consume the reading. 
+    // Expect a temperature frame to be transmitted from the main loop.
+    {
+        mock.tempSensor.setTemp(-5);
+        mock.tempTimer.setTimedOut(true);
+        logic.handleTempTimerTimeout();
+        EXPECT_TRUE(mock.serial.writeBuffer().empty());
+        mock.runSystem();
+
+        const auto& data{mock.serial.writeBuffer()};
+        host::protocol::Decoder decoder{};
+        EXPECT_LT(0U, decoder.feed(data.data(), data.size()));
+        host::protocol::Message message{};
+        EXPECT_TRUE(decoder.next(message));
+        EXPECT_EQ(message.type, driver::serial::MessageType::Temperature);
+        EXPECT_EQ(message.values[0U], -5);
+        mock.serial.clearWriteBuffer();
+    }
+
+    // Case 3 - Switch back to text output, expect no binary frames to be transmitted.
+    {
+        mock.logicImpl->setOutputFormat(OutputFormat::Text);
+        mock.tempTimer.setTimedOut(true);
+        logic.handleTempTimerTimeout();
+        EXPECT_TRUE(mock.serial.writeBuffer().empty());
+    }
+}
+
+/**
+ * @brief Deferred output test.
+ *
+ *        Verify that messages are stored as deferred log records when the deferred output 
+ *        format is selected, and that the records are transmitted by the main loop.
+ */
+TEST(Logic, DeferredOutput)
+{
+    // Create logic implementation and select deferred output.
+    Mock mock{};
+    logic::Interface& logic{mock.createLogic()};
+    mock.logicImpl->setOutputFormat(OutputFormat::Deferred);
+    EXPECT_EQ(mock.logicImpl->outputFormat(), OutputFormat::Deferred);
+
+    // Case 1 - Press the toggle button and simulate temperature timer timeout, expect
+    // nothing to be transmitted outside the main loop.
+    {
+        mock.toggleButton.write(true);
+        logic.handleButtonEvent();
+        mock.toggleButton.write(false);
+        mock.tempSensor.setTemp(21);
+        mock.tempTimer.setTimedOut(true);
+        logic.handleTempTimerTimeout();
+        EXPECT_TRUE(mock.serial.writeBuffer().empty());
+    }
+
+    // Case 2 - Run the system, expect the log records to be transmitted and formatted on
+    // the host in the order they were issued. The toggle state and the temperature are 
+    // printed from the main loop.
+    {
+        mock.runSystem();
+        const auto& data{mock.serial.writeBuffer()};
+        host::protocol::Decoder decoder{};
+        EXPECT_EQ(decoder.feed(data.data(), data.size()), 3U);
+
+        host::protocol::Message message{};
+        EXPECT_TRUE(decoder.next(message));
+        EXPECT_EQ(host::protocol::format(message), "Running the system!");
+        EXPECT_TRUE(decoder.next(message));
+        EXPECT_EQ(host::protocol::format(message), "Toggle timer enabled!");
+        EXPECT_TRUE(decoder.next(message));
+        EXPECT_EQ(host::protocol::format(message), "Temperature: 21 Celsius");
+    }
+}
+
+/**
+ * @brief Command test.
+ *
+ *        Verify that commands received via the serial port are executed by the main loop,
+ *        and that invalid commands are rejected.
+ */
+TEST(Logic, Commands)
+{
+    // Create logic implementation and measure the latency using a simulated clock.
+    Mock mock{};
+    mock.createLogic();
+    mock.logicImpl->setCommandClock([]() noexcept -> std::uint32_t
+    {
+        static std::uint32_t time_us{};
+        return time_us += 10U;
+    });
+
+    // Case 1 - Receive commands via the serial port, expect them to be executed by the main
+    // loop, one command per iteration.
+    {
+        const char commands[]{"toggle 250\ntemp 5000\n"};
+        mock.serial.setReadBuffer(reinterpret_cast<const std::uint8_t*>(commands), 
+                                  sizeof(commands) - 1U);
+        mock.runSystem();
+        EXPECT_EQ(mock.toggleTimer.timeout_ms(), 250U);
+        EXPECT_EQ(mock.tempTimer.timeout_ms(), 5000U);
+    }
+
+    // Case 2 - Execute commands directly, expect invalid commands to be rejected.
+    {
+        char unknown[]{"blink 1"};
+        char zeroTimeout[]{"toggle 0"};
+        char eepromRange[]{"eeprom 1020 8"};
+        char eepromCount[]{"eeprom 0 17"};
+        char statsArgs[]{"stats 1"};
+        EXPECT_EQ(mock.logicImpl->executeCommand(unknown), command::Status::Unknown);
+        EXPECT_EQ(mock.logicImpl->executeCommand(zeroTimeout), command::Status::InvalidArgs);
+        EXPECT_EQ(mock.logicImpl->executeCommand(eepromRange), command::Status::InvalidArgs);
+        EXPECT_EQ(mock.logicImpl->executeCommand(eepromCount), command::Status::InvalidArgs);
+        EXPECT_EQ(mock.logicImpl->executeCommand(statsArgs), command::Status::InvalidArgs);
+        EXPECT_EQ(mock.toggleTimer.timeout_ms(), 250U);
+    }
+
+    // Case 3 - Read EEPROM in deferred output format, expect the stored bytes to be printed.
+    {
+        char eeprom[]{"eeprom 10 2"};
+        mock.eeprom.write<std::uint16_t>(10U, 0xBEEFU);
+        mock.logicImpl->setOutputFormat(OutputFormat::Deferred);
+        mock.serial.clearWriteBuffer();
+        EXPECT_EQ(mock.logicImpl->executeCommand(eeprom), command::Status::Ok);
+        mock.runSystem();
+
+        const auto& data{mock.serial.writeBuffer()};
+        host::protocol::Decoder decoder{};
+        decoder.feed(data.data(), data.size());
+        host::protocol::Message message{};
+        EXPECT_TRUE(decoder.next(message));
+        EXPECT_EQ(host::protocol::format(message), "EEPROM[10]: 0xef");
+        EXPECT_TRUE(decoder.next(message));
+        EXPECT_EQ(host::protocol::format(message), "EEPROM[11]: 0xbe");
+    }
+
+    // Case 4 - Expect the statistics to hold the number of calls and the latency.
+    {
+        const command::Statistics* toggle{mock.logicImpl->commandStatistics(0U)};
+        ASSERT_NE(toggle, nullptr);
+        EXPECT_EQ(toggle->callCount, 2U);
+        EXPECT_EQ(toggle->maxLatency_us, 10U);
+        EXPECT_EQ(mock.logicImpl->commandStatistics(2U)->callCount, 3U);
+        EXPECT_EQ(mock.logicImpl->commandStatistics(4U), nullptr);
+    }
+}
 } // namespace
 } // namespace logic
 
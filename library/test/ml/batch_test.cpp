@@ -0,0 +1,165 @@
+/**
+ * @brief Unit tests for batch prediction.
+ */
+#include <cstddef>
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "ml/batch.h"
+#include "ml/lin_reg/fixed.h"
+#include "ml/lin_reg/interface.h"
+#include "ml/lin_reg/online.h"
+#include "ml/lin_reg/piecewise.h"
+#include "ml/poly_reg/fixed.h"
+
+#ifdef TESTSUITE
+
+namespace ml
+{
+namespace
+{
+/** The number of inputs per batch, chosen to not be a multiple of the vector width. */
+constexpr std::size_t InputCount{23U};
+
+/**
+ * @brief Model implementing predict() only, to test the default batch implementation.
+ */
+class Square final : public lin_reg::Interface
+{
+public:
+    bool isTrained() const noexcept override { return true; }
+    double predict(const double input) const noexcept override { return input * input; }
+    std::uint8_t serializedSize() const noexcept override { return 0U; }
+    bool serialize(std::uint8_t*, std::uint8_t) const noexcept override { return false; }
+    bool deserialize(const std::uint8_t*, std::uint8_t) noexcept override { return false; }
+};
+
+// -----------------------------------------------------------------------------
+void createInputs(double (&inputs)[InputCount]) noexcept
+{
+    for (std::size_t i{}; i < InputCount; ++i)
+    {
+        inputs[i] = -1.0 + 0.25 * static_cast<double>(i);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void verifyBatch(const lin_reg::Interface& model) noexcept
+{
+    double inputs[InputCount]{};
+    double outputs[InputCount]{};
+    createInputs(inputs);
+
+    // Predict all inputs at once, expect the same values as predicted one at a time.
+    EXPECT_TRUE(model.predictBatch(inputs, outputs, InputCount));
+    for (std::size_t i{}; i < InputCount; ++i)
+    {
+        EXPECT_DOUBLE_EQ(model.predict(inputs[i]), outputs[i]);
+    }
+
+    // Predict in place, expect the inputs to be replaced with the same values.
+    EXPECT_TRUE(model.predictBatch(inputs, inputs, InputCount));
+    for (std::size_t i{}; i < InputCount; ++i) { EXPECT_DOUBLE_EQ(outputs[i], inputs[i]); }
+
+    // Pass null pointers, expect failure unless there are no inputs.
+    EXPECT_FALSE(model.predictBatch(nullptr, outputs, InputCount));
+    EXPECT_FALSE(model.predictBatch(inputs, nullptr, InputCount));
+    EXPECT_TRUE(model.predictBatch(nullptr, nullptr, 0U));
+}
+
+/**
+ * @brief Batch kernel test.
+ *
+ *        Verify that the batch kernels evaluate every input, including the inputs remaining
+ *        after the last full vector, and that invalid pointers are rejected.
+ */
+TEST(Batch, Kernels)
+{
+    double inputs[InputCount]{};
+    double outputs[InputCount]{};
+    createInputs(inputs);
+
+    // Case 1 - Evaluate an affine function, expect each output to match.
+    {
+        EXPECT_TRUE(batch::affine(inputs, outputs, InputCount, 100.0, -50.0));
+        for (std::size_t i{}; i < InputCount; ++i)
+        {
+            EXPECT_DOUBLE_EQ(100.0 * inputs[i] - 50.0, outputs[i]);
+        }
+    }
+
+    // Case 2 - Evaluate a polynomial of normalized inputs, expect each output to match.
+    {
+        constexpr double coefficients[]{1.0, -2.0, 0.5, 0.25};
+        EXPECT_TRUE(batch::polynomial(inputs, outputs, InputCount, coefficients, 3U, 1.0, 0.5));
+        for (std::size_t i{}; i < InputCount; ++i)
+        {
+            const double t{(inputs[i] - 1.0) * 0.5};
+            EXPECT_DOUBLE_EQ(1.0 - 2.0 * t + 0.5 * t * t + 0.25 * t * t * t, outputs[i]);
+        }
+    }
+
+    // Case 3 - Evaluate a polynomial of degree 0, expect the constant coefficient.
+    {
+        constexpr double coefficients[]{4.0};
+        EXPECT_TRUE(batch::polynomial(inputs, outputs, InputCount, coefficients, 0U, 0.0, 1.0));
+        for (std::size_t i{}; i < InputCount; ++i) { EXPECT_DOUBLE_EQ(4.0, outputs[i]); }
+    }
+
+    // Case 4 - Pass null pointers, expect failure unless there are no inputs.
+    {
+        constexpr double coefficients[]{1.0, 2.0};
+        EXPECT_FALSE(batch::affine(nullptr, outputs, InputCount, 1.0, 0.0));
+        EXPECT_FALSE(batch::affine(inputs, nullptr, InputCount, 1.0, 0.0));
+        EXPECT_TRUE(batch::affine(nullptr, nullptr, 0U, 1.0, 0.0));
+        EXPECT_FALSE(batch::polynomial(inputs, outputs, InputCount, nullptr, 1U, 0.0, 1.0));
+        EXPECT_FALSE(batch::polynomial(nullptr, outputs, InputCount, coefficients, 1U, 0.0, 1.0));
+        EXPECT_TRUE(batch::polynomial(nullptr, nullptr, 0U, nullptr, 1U, 0.0, 1.0));
+    }
+}
+
+/**
+ * @brief Batch prediction model test.
+ *
+ *        Verify that each model predicts the same values in a batch as one at a time, both
+ *        for the default implementation and for the models overriding it.
+ */
+TEST(Batch, Models)
+{
+    // Case 1 - Verify the default implementation, which calls predict() for each input.
+    {
+        const Square model{};
+        verifyBatch(model);
+    }
+
+    // Case 2 - Verify the fixed linear regression model.
+    {
+        const lin_reg::Fixed model{lin_reg::Parameters{100.0, -50.0, true}};
+        verifyBatch(model);
+    }
+
+    // Case 3 - Verify the online linear regression model.
+    {
+        lin_reg::Online model{};
+        EXPECT_TRUE(model.update(0.0, -50.0));
+        EXPECT_TRUE(model.update(1.0, 50.0));
+        verifyBatch(model);
+    }
+
+    // Case 4 - Verify the polynomial regression model.
+    {
+        const poly_reg::Fixed<3U> model{{1.0, -2.0, 0.5, 0.25}};
+        verifyBatch(model);
+    }
+
+    // Case 5 - Verify the piecewise linear regression model, including extrapolation.
+    {
+        const lin_reg::Piecewise<2U> model{{0.0, 1.0, 2.0}, {-50.0, 50.0, 100.0}};
+        verifyBatch(model);
+    }
+}
+} // namespace
+} // namespace ml
+
+#endif /** TESTSUITE */
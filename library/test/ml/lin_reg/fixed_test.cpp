@@ -1,6 +1,8 @@
 /**
  * @brief Unit tests for the fixed linear regression model.
  */
+#include <cstddef>
+
 #include <gtest/gtest.h>
 
 #include "ml/lin_reg/fixed.h"
@@ -177,6 +179,229 @@ TEST(LinRegFixed, LearningRate)
         EXPECT_EQ(valid, linReg.isTrained());   
     }
 }
+
+/**
+ * @brief Closed-form least squares training test.
+ * 
+ *        Verify that least squares training finds the exact line for linear data, the 
+ *        ordinary least squares fit for noisy data and that it remains accurate for badly 
+ *        scaled inputs. Also verify that training fails if the weight is undefined.
+ */
+TEST(LinRegFixed, LeastSquares)
+{
+    // Case 1 - Train on linear data, expect the exact line to be found.
+    {
+        lin_reg::Fixed linReg{};
+        const Matrix1d trainIn{0.0, 1.0, 2.0, 3.0, 4.0};
+        const Matrix2d trainOut{2.0, 4.0, 6.0, 8.0, 10.0};
+
+        EXPECT_TRUE(linReg.trainLeastSquares(trainIn, trainOut));
+        EXPECT_TRUE(linReg.isTrained());
+        EXPECT_NEAR(linReg.predict(0.0), 2.0, 1e-12);
+        EXPECT_NEAR(linReg.predict(10.0), 22.0, 1e-12);
+    }
+
+    // Case 2 - Train on noisy data, expect the ordinary least squares fit.
+    {
+        lin_reg::Fixed linReg{};
+        const Matrix1d trainIn{1.0, 2.0, 3.0, 4.0};
+        const Matrix2d trainOut{6.0, 5.0, 7.0, 10.0};
+
+        // The fit is y = 1.4x + 3.5, computed by hand.
+        EXPECT_TRUE(linReg.trainLeastSquares(trainIn, trainOut));
+        EXPECT_NEAR(linReg.predict(0.0), 3.5, 1e-12);
+        EXPECT_NEAR(linReg.predict(1.0), 4.9, 1e-12);
+    }
+
+    // Case 3 - Train on inputs with a large offset, expect the line to be found accurately 
+    // where the raw sums of squares would cancel out.
+    {
+        lin_reg::Fixed linReg{};
+        Matrix1d trainIn{};
+        Matrix2d trainOut{};
+
+        for (std::size_t i{}; i < 16U; ++i)
+        {
+            const double input{1e8 + 0.1 * i};
+            trainIn.pushBack(input);
+            trainOut.pushBack(100.0 * (input - 1e8) - 50.0);
+        }
+        EXPECT_TRUE(linReg.trainLeastSquares(trainIn, trainOut));
+        EXPECT_NEAR(linReg.predict(1e8 + 0.5), 0.0, 1e-4);
+        EXPECT_NEAR(linReg.predict(1e8 + 1.5), 100.0, 1e-4);
+    }
+
+    // Case 4 - Expect training to fail without training sets or with equal inputs.
+    {
+        lin_reg::Fixed linReg{};
+        EXPECT_FALSE(linReg.trainLeastSquares(Matrix1d{}, Matrix2d{1.0}));
+        EXPECT_FALSE(linReg.trainLeastSquares(Matrix1d{2.0, 2.0, 2.0}, Matrix2d{1.0, 2.0, 3.0}));
+        EXPECT_FALSE(linReg.isTrained());
+    }
+}
+
+/**
+ * @brief Early stopping test.
+ * 
+ *        Verify that training stops once the loss stops improving and that the training 
+ *        report matches the trained model.
+ */
+TEST(LinRegFixed, EarlyStopping)
+{
+    Matrix1d trainIn{0.0, 1.0, 2.0, 3.0, 4.0};
+    Matrix2d trainOut{2.0, 4.0, 6.0, 8.0, 10.0};
+
+    // Case 1 - Verify that all epochs are performed if early stopping is disabled.
+    {
+        lin_reg::Fixed linReg{};
+        lin_reg::TrainingOptions options{};
+        options.epochCount = 50U;
+        const auto report{linReg.train(trainIn, trainOut, options)};
+
+        EXPECT_TRUE(report.valid);
+        EXPECT_FALSE(report.converged);
+        EXPECT_EQ(options.epochCount, report.epochCount);
+        EXPECT_TRUE(linReg.isTrained());
+
+        // Expect the same model as training with the same number of epochs without a report.
+        lin_reg::Fixed reference{};
+        EXPECT_TRUE(reference.train(trainIn, trainOut, options.epochCount));
+        EXPECT_EQ(reference.predict(10.0), linReg.predict(10.0));
+    }
+
+    // Case 2 - Verify that training stops early once the loss has converged.
+    {
+        lin_reg::Fixed linReg{};
+        lin_reg::TrainingOptions options{};
+        options.epochCount   = 10000U;
+        options.minLossDelta = 1e-12;
+        const auto report{linReg.train(trainIn, trainOut, options)};
+
+        EXPECT_TRUE(report.valid);
+        EXPECT_TRUE(report.converged);
+        EXPECT_LT(1U, report.epochCount);
+        EXPECT_GT(options.epochCount, report.epochCount);
+        EXPECT_NEAR(0.0, report.loss, 1e-6);
+
+        // Expect the model to predict as intended.
+        constexpr double precision{1e-3};
+        for (std::size_t i{}; i < trainIn.size(); ++i)
+        {
+            EXPECT_NEAR(trainOut[i], linReg.predict(trainIn[i]), precision);
+        }
+    }
+
+    // Case 3 - Verify that a larger threshold stops training sooner.
+    {
+        lin_reg::Fixed precise{};
+        lin_reg::Fixed coarse{};
+        lin_reg::TrainingOptions options{};
+        options.epochCount   = 10000U;
+        options.minLossDelta = 1e-12;
+        const auto preciseReport{precise.train(trainIn, trainOut, options)};
+        options.minLossDelta = 1e-3;
+        const auto coarseReport{coarse.train(trainIn, trainOut, options)};
+
+        EXPECT_TRUE(coarseReport.converged);
+        EXPECT_GT(preciseReport.epochCount, coarseReport.epochCount);
+        EXPECT_GT(coarseReport.loss, preciseReport.loss);
+    }
+}
+
+/**
+ * @brief Shuffled training test.
+ * 
+ *        Verify that shuffling keeps the training sets paired, is reproducible for a given 
+ *        seed and that the shuffled training converges.
+ */
+TEST(LinRegFixed, Shuffle)
+{
+    Matrix1d trainIn{0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0};
+    Matrix2d trainOut{2.0, 4.0, 6.0, 8.0, 10.0, 12.0, 14.0, 16.0};
+    Matrix1d otherIn{0.0, 1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0};
+    Matrix2d otherOut{2.0, 4.0, 6.0, 8.0, 10.0, 12.0, 14.0, 16.0};
+
+    lin_reg::TrainingOptions options{};
+    options.epochCount   = 5000U;
+    options.minLossDelta = 1e-12;
+    options.shuffle      = true;
+    options.seed         = 42U;
+
+    // Case 1 - Verify that the shuffled model converges and predicts as intended.
+    lin_reg::Fixed linReg{};
+    const auto report{linReg.train(trainIn, trainOut, options)};
+    {
+        EXPECT_TRUE(report.valid);
+        EXPECT_TRUE(report.converged);
+
+        constexpr double precision{1e-3};
+        EXPECT_NEAR(2.0, linReg.predict(0.0), precision);
+        EXPECT_NEAR(22.0, linReg.predict(10.0), precision);
+    }
+
+    // Case 2 - Verify that the training sets are reordered, but each set is kept intact.
+    {
+        bool reordered{false};
+        double inputSum{};
+        for (std::size_t i{}; i < trainIn.size(); ++i)
+        {
+            EXPECT_EQ(2.0 * trainIn[i] + 2.0, trainOut[i]);
+            reordered = reordered || (static_cast<double>(i) != trainIn[i]);
+            inputSum += trainIn[i];
+        }
+        EXPECT_TRUE(reordered);
+        EXPECT_EQ(28.0, inputSum);
+    }
+
+    // Case 3 - Verify that training with the same seed gives the same model and order.
+    {
+        lin_reg::Fixed other{};
+        const auto otherReport{other.train(otherIn, otherOut, options)};
+        EXPECT_EQ(report.epochCount, otherReport.epochCount);
+        EXPECT_EQ(linReg.predict(10.0), other.predict(10.0));
+        for (std::size_t i{}; i < trainIn.size(); ++i) { EXPECT_EQ(trainIn[i], otherIn[i]); }
+    }
+}
+
+/**
+ * @brief Invalid training options test.
+ * 
+ *        Verify that the model doesn't get trained if the training options are invalid.
+ */
+TEST(LinRegFixed, InvalidOptions)
+{
+    Matrix1d trainIn{0.0, 1.0, 2.0, 3.0, 4.0};
+    Matrix2d trainOut{2.0, 4.0, 6.0, 8.0, 10.0};
+    Matrix1d emptyIn{};
+    Matrix2d emptyOut{};
+
+    // Case 1 - Verify that invalid epoch counts, learning rates and thresholds are rejected.
+    {
+        lin_reg::TrainingOptions invalidEpochs{};
+        invalidEpochs.epochCount = 0U;
+        lin_reg::TrainingOptions invalidLearningRate{};
+        invalidLearningRate.learningRate = 1.5;
+        lin_reg::TrainingOptions invalidThreshold{};
+        invalidThreshold.minLossDelta = -1.0;
+
+        for (const auto& options : {invalidEpochs, invalidLearningRate, invalidThreshold})
+        {
+            lin_reg::Fixed linReg{};
+            const auto report{linReg.train(trainIn, trainOut, options)};
+            EXPECT_FALSE(report.valid);
+            EXPECT_EQ(0U, report.epochCount);
+            EXPECT_FALSE(linReg.isTrained());
+        }
+    }
+
+    // Case 2 - Verify that training without training sets is rejected.
+    {
+        lin_reg::Fixed linReg{};
+        const auto report{linReg.train(emptyIn, emptyOut, lin_reg::TrainingOptions{})};
+        EXPECT_FALSE(report.valid);
+        EXPECT_FALSE(linReg.isTrained());
+    }
+}
 } // namespace
 } // namespace ml
 
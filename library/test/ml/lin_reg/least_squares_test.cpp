@@ -0,0 +1,113 @@
+/**
+ * @brief Unit tests for closed-form least squares fitting.
+ */
+#include <gtest/gtest.h>
+
+#include "ml/lin_reg/fixed.h"
+#include "ml/lin_reg/least_squares.h"
+
+#ifdef TESTSUITE
+
+namespace ml
+{
+namespace
+{
+// -----------------------------------------------------------------------------
+constexpr bool isNear(const double x, const double y, const double precision) noexcept
+{
+    return (x > y ? x - y : y - x) <= precision;
+}
+
+/** Training data input values. */
+constexpr double TrainIn[]{0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 
+                           0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5};
+
+/** Training data output values according to y = 100x - 50. */
+constexpr double TrainOut[]{-50.0, -40.0, -30.0, -20.0, -10.0, 0.0, 10.0, 20.0, 
+                            30.0, 40.0, 50.0, 60.0, 70.0, 80.0, 90.0, 100.0};
+
+/** Model parameters computed by the compiler. */
+constexpr lin_reg::Parameters Model{lin_reg::leastSquares(TrainIn, TrainOut)};
+
+// Verify that the model is fitted at compile time.
+static_assert(Model.valid, "Compile-time least squares fitting failed!");
+static_assert(isNear(100.0, Model.weight, 1e-9), "Invalid compile-time weight!");
+static_assert(isNear(-50.0, Model.bias, 1e-9), "Invalid compile-time bias!");
+
+/**
+ * @brief Compile-time fitting test.
+ * 
+ *        Verify that models fitted at compile time match models trained at runtime.
+ */
+TEST(LinRegLeastSquares, CompileTime)
+{
+    // Case 1 - Verify that a pre-trained model predicts as a model trained at runtime.
+    {
+        const lin_reg::Fixed pretrained{Model};
+        EXPECT_TRUE(pretrained.isTrained());
+
+        lin_reg::Fixed trained{};
+        EXPECT_TRUE(trained.trainLeastSquares(Matrix1d{0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7, 
+                                                       0.8, 0.9, 1.0, 1.1, 1.2, 1.3, 1.4, 1.5},
+                                              Matrix2d{-50.0, -40.0, -30.0, -20.0, -10.0, 0.0, 
+                                                       10.0, 20.0, 30.0, 40.0, 50.0, 60.0, 
+                                                       70.0, 80.0, 90.0, 100.0}));
+
+        for (const auto& input : TrainIn)
+        {
+            EXPECT_EQ(trained.predict(input), pretrained.predict(input));
+        }
+    }
+
+    // Case 2 - Verify that equal inputs give invalid parameters and an untrained model.
+    {
+        constexpr double trainIn[]{2.0, 2.0, 2.0};
+        constexpr double trainOut[]{1.0, 2.0, 3.0};
+        constexpr lin_reg::Parameters model{lin_reg::leastSquares(trainIn, trainOut)};
+        static_assert(!model.valid, "Equal inputs must give invalid parameters!");
+
+        const lin_reg::Fixed pretrained{model};
+        EXPECT_FALSE(pretrained.isTrained());
+        EXPECT_EQ(0.0, pretrained.predict(1.0));
+    }
+}
+
+/**
+ * @brief Least squares accumulator test.
+ * 
+ *        Verify that the accumulator fits training sets added one at a time.
+ */
+TEST(LinRegLeastSquares, Accumulator)
+{
+    lin_reg::LeastSquares accumulator{};
+
+    // Case 1 - Verify that the parameters are invalid without training sets.
+    {
+        EXPECT_EQ(0U, accumulator.count());
+        EXPECT_FALSE(accumulator.solve().valid);
+    }
+
+    // Case 2 - Verify that the parameters are invalid with a single training set.
+    {
+        accumulator.add(1.0, 1.0);
+        EXPECT_EQ(1U, accumulator.count());
+        EXPECT_FALSE(accumulator.solve().valid);
+    }
+
+    // Case 3 - Verify that y = -2x + 3 is fitted after adding more training sets.
+    {
+        accumulator.add(2.0, -1.0);
+        accumulator.add(4.0, -5.0);
+        EXPECT_EQ(3U, accumulator.count());
+
+        const lin_reg::Parameters parameters{accumulator.solve()};
+        constexpr double precision{1e-12};
+        EXPECT_TRUE(parameters.valid);
+        EXPECT_NEAR(-2.0, parameters.weight, precision);
+        EXPECT_NEAR(3.0, parameters.bias, precision);
+    }
+}
+} // namespace
+} // namespace ml
+
+#endif /** TESTSUITE */
@@ -0,0 +1,200 @@
+/**
+ * @brief Unit tests for the multivariate linear regression model.
+ */
+#include <cstddef>
+
+#include <gtest/gtest.h>
+
+#include "ml/lin_reg/multi.h"
+#include "ml/matrix.h"
+
+#ifdef TESTSUITE
+
+namespace ml
+{
+namespace
+{
+/** The number of training sets. */
+constexpr std::size_t SetCount{12U};
+
+/** The number of inputs. */
+constexpr std::size_t InputCount{3U};
+
+// -----------------------------------------------------------------------------
+constexpr double target(const double x0, const double x1, const double x2) noexcept
+{
+    // The function to learn: y = 2 * x0 - 3 * x1 + 0.5 * x2 + 1.
+    return 2.0 * x0 - 3.0 * x1 + 0.5 * x2 + 1.0;
+}
+
+// -----------------------------------------------------------------------------
+void createTrainingData(Matrix<double, SetCount, InputCount>& trainIn,
+                        double (&trainOut)[SetCount]) noexcept
+{
+    for (std::size_t i{}; i < SetCount; ++i)
+    {
+        trainIn(i, 0U) = 0.1 * static_cast<double>(i);
+        trainIn(i, 1U) = 0.1 * static_cast<double>((i * 5U) % 7U);
+        trainIn(i, 2U) = 0.1 * static_cast<double>((i * 3U) % 4U);
+        trainOut[i]    = target(trainIn(i, 0U), trainIn(i, 1U), trainIn(i, 2U));
+    }
+}
+
+/**
+ * @brief Normal equation training test.
+ * 
+ *        Verify that the closed-form solution recovers the weights and the bias exactly.
+ */
+TEST(LinRegMulti, NormalEquation)
+{
+    Matrix<double, SetCount, InputCount> trainIn{};
+    double trainOut[SetCount]{};
+    createTrainingData(trainIn, trainOut);
+    lin_reg::Multi<InputCount> model{};
+
+    // Case 1 - Verify that the model predicts 0 when untrained.
+    {
+        EXPECT_FALSE(model.isTrained());
+        EXPECT_EQ(0.0, model.predict(trainIn.row(1U)));
+    }
+
+    // Case 2 - Train the model, expect the parameters to be recovered.
+    {
+        EXPECT_TRUE(model.trainNormalEquation(trainIn, VectorView<const double>{trainOut, 
+                                                                                SetCount}));
+        EXPECT_TRUE(model.isTrained());
+
+        constexpr double precision{1e-9};
+        EXPECT_NEAR(2.0, model.weights()[0U], precision);
+        EXPECT_NEAR(-3.0, model.weights()[1U], precision);
+        EXPECT_NEAR(0.5, model.weights()[2U], precision);
+        EXPECT_NEAR(1.0, model.bias(), precision);
+
+        for (std::size_t i{}; i < SetCount; ++i)
+        {
+            EXPECT_NEAR(trainOut[i], model.predict(trainIn.row(i)), precision);
+        }
+    }
+
+    // Case 3 - Verify that linearly dependent inputs are rejected.
+    {
+        Matrix<double, SetCount, InputCount> dependent{};
+        for (std::size_t i{}; i < SetCount; ++i)
+        {
+            dependent(i, 0U) = trainIn(i, 0U);
+            dependent(i, 1U) = trainIn(i, 1U);
+            dependent(i, 2U) = trainIn(i, 0U) - 2.0 * trainIn(i, 1U);
+        }
+        lin_reg::Multi<InputCount> other{};
+        EXPECT_FALSE(other.trainNormalEquation(dependent, VectorView<const double>{trainOut, 
+                                                                                  SetCount}));
+        EXPECT_FALSE(other.isTrained());
+    }
+}
+
+/**
+ * @brief Gradient descent training test.
+ * 
+ *        Verify that mini-batch gradient descent converges for different batch sizes.
+ */
+TEST(LinRegMulti, GradientDescent)
+{
+    Matrix<double, SetCount, InputCount> trainIn{};
+    double trainOut[SetCount]{};
+    createTrainingData(trainIn, trainOut);
+    const VectorView<const double> output{trainOut, SetCount};
+
+    // Verify that the model converges with batch sizes of one, a partial batch and all sets.
+    for (const std::size_t batchSize : {1U, 5U, 12U})
+    {
+        lin_reg::Multi<InputCount> model{};
+        constexpr std::size_t epochCount{20000U};
+        constexpr double learningRate{0.1};
+        EXPECT_TRUE(model.train(trainIn, output, epochCount, learningRate, batchSize));
+        EXPECT_TRUE(model.isTrained());
+
+        constexpr double precision{1e-3};
+        for (std::size_t i{}; i < SetCount; ++i)
+        {
+            EXPECT_NEAR(trainOut[i], model.predict(trainIn.row(i)), precision);
+        }
+    }
+}
+
+/**
+ * @brief Batch prediction test.
+ * 
+ *        Verify that batch predictions match single predictions.
+ */
+TEST(LinRegMulti, PredictBatch)
+{
+    Matrix<double, SetCount, InputCount> trainIn{};
+    double trainOut[SetCount]{};
+    createTrainingData(trainIn, trainOut);
+    lin_reg::Multi<InputCount> model{};
+    double predictions[SetCount]{};
+    const VectorView<double> output{predictions, SetCount};
+
+    // Case 1 - Verify that batch predictions fail when untrained.
+    {
+        EXPECT_FALSE(model.predictBatch(trainIn, output));
+    }
+
+    // Case 2 - Verify that batch predictions match single predictions.
+    {
+        EXPECT_TRUE(model.trainNormalEquation(trainIn, VectorView<const double>{trainOut, 
+                                                                                SetCount}));
+        EXPECT_TRUE(model.predictBatch(trainIn, output));
+
+        for (std::size_t i{}; i < SetCount; ++i)
+        {
+            EXPECT_DOUBLE_EQ(model.predict(trainIn.row(i)), predictions[i]);
+        }
+    }
+
+    // Case 3 - Verify that mismatching sizes are rejected.
+    {
+        Matrix<double> wrongInput{SetCount, InputCount + 1U};
+        EXPECT_FALSE(model.predictBatch(wrongInput, output));
+        EXPECT_FALSE(model.predictBatch(trainIn, VectorView<double>{predictions, 1U}));
+        EXPECT_EQ(0.0, model.predict(wrongInput.row(0U)));
+    }
+}
+
+/**
+ * @brief Invalid training test.
+ * 
+ *        Verify that the model doesn't get trained with invalid training parameters.
+ */
+TEST(LinRegMulti, InvalidTraining)
+{
+    Matrix<double, SetCount, InputCount> trainIn{};
+    double trainOut[SetCount]{};
+    createTrainingData(trainIn, trainOut);
+    const VectorView<const double> output{trainOut, SetCount};
+    lin_reg::Multi<InputCount> model{};
+
+    // Case 1 - Invalid epoch count, learning rate and batch size.
+    {
+        EXPECT_FALSE(model.train(trainIn, output, 0U));
+        EXPECT_FALSE(model.train(trainIn, output, 10U, 0.0));
+        EXPECT_FALSE(model.train(trainIn, output, 10U, 1.5));
+        EXPECT_FALSE(model.train(trainIn, output, 10U, 0.01, 0U));
+    }
+
+    // Case 2 - No training sets and wrong number of inputs.
+    {
+        const Matrix<double> empty{};
+        const Matrix<double> wrongInput{SetCount, InputCount - 1U};
+        EXPECT_FALSE(model.train(empty, output, 10U));
+        EXPECT_FALSE(model.train(wrongInput, output, 10U));
+        EXPECT_FALSE(model.train(trainIn, VectorView<const double>{trainOut, 0U}, 10U));
+        EXPECT_FALSE(model.trainNormalEquation(empty, output));
+        EXPECT_FALSE(model.trainNormalEquation(wrongInput, output));
+    }
+    EXPECT_FALSE(model.isTrained());
+}
+} // namespace
+} // namespace ml
+
+#endif /** TESTSUITE */
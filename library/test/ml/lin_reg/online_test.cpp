@@ -0,0 +1,189 @@
+/**
+ * @brief Unit tests for the online linear regression model.
+ */
+#include <cstddef>
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "driver/eeprom/stub.h"
+#include "ml/lin_reg/fixed.h"
+#include "ml/lin_reg/online.h"
+#include "ml/lin_reg/storage.h"
+#include "ml/types.h"
+
+#ifdef TESTSUITE
+
+namespace ml
+{
+namespace
+{
+/**
+ * @brief Online training happy path test.
+ * 
+ *        Verify that the model converges to the least squares solution with measurements 
+ *        added one at a time.
+ */
+TEST(LinRegOnline, HappyPath)
+{
+    lin_reg::Online model{};
+
+    // Case 1 - Verify that the model is untrained until two measurements have been added.
+    {
+        EXPECT_FALSE(model.isTrained());
+        EXPECT_TRUE(model.update(0.0, -50.0));
+        EXPECT_FALSE(model.isTrained());
+        EXPECT_TRUE(model.update(1.0, 50.0));
+        EXPECT_TRUE(model.isTrained());
+    }
+
+    // Case 2 - Verify that the model predicts T = 100 * Uin - 50 after more measurements.
+    {
+        for (double input{0.1}; input < 1.5; input += 0.1)
+        {
+            EXPECT_TRUE(model.update(input, 100.0 * input - 50.0));
+        }
+
+        // The initial covariance acts as a weak prior, so allow a small deviation.
+        constexpr double precision{0.1};
+        for (double input{0.0}; input <= 2.0; input += 0.25)
+        {
+            EXPECT_NEAR(100.0 * input - 50.0, model.predict(input), precision);
+        }
+    }
+
+    // Case 3 - Verify that the model matches the least squares solution on noisy data.
+    {
+        const Matrix1d trainIn{0.0, 0.1, 0.2, 0.3, 0.4, 0.5, 0.6, 0.7};
+        const Matrix2d trainOut{-49.0, -41.5, -29.0, -20.5, -9.0, -0.5, 11.0, 19.5};
+        lin_reg::Fixed reference{};
+        EXPECT_TRUE(reference.trainLeastSquares(trainIn, trainOut));
+
+        // Use a large initial covariance, so that the prior is negligible for few training sets.
+        lin_reg::Online precise{1.0, 1.0e6};
+        EXPECT_TRUE(precise.train(trainIn, trainOut));
+
+        constexpr double precision{0.001};
+        for (const auto& input : trainIn)
+        {
+            EXPECT_NEAR(reference.predict(input), precise.predict(input), precision);
+        }
+    }
+}
+
+/**
+ * @brief Forgetting factor test.
+ * 
+ *        Verify that a forgetting factor below 1 lets the model follow sensor drift.
+ */
+TEST(LinRegOnline, ForgettingFactor)
+{
+    lin_reg::Online forgetting{0.8};
+    lin_reg::Online remembering{1.0};
+
+    // Add measurements of the original sensor characteristic.
+    for (std::size_t i{}; i < 50U; ++i)
+    {
+        const double input{0.1 * static_cast<double>(i % 10U)};
+        EXPECT_TRUE(forgetting.update(input, 100.0 * input - 50.0));
+        EXPECT_TRUE(remembering.update(input, 100.0 * input - 50.0));
+    }
+
+    // Add measurements after the sensor has drifted by 5 degrees.
+    for (std::size_t i{}; i < 50U; ++i)
+    {
+        const double input{0.1 * static_cast<double>(i % 10U)};
+        EXPECT_TRUE(forgetting.update(input, 100.0 * input - 45.0));
+        EXPECT_TRUE(remembering.update(input, 100.0 * input - 45.0));
+    }
+
+    // Expect the forgetting model to follow the drift, while the other model averages.
+    constexpr double precision{0.01};
+    EXPECT_NEAR(-45.0, forgetting.predict(0.0), precision);
+    EXPECT_NEAR(-47.5, remembering.predict(0.0), 0.1);
+}
+
+/**
+ * @brief Online model serialization test.
+ * 
+ *        Verify that a stored model is restored with its covariance, so that further updates
+ *        continue as if the model had never been stored.
+ */
+TEST(LinRegOnline, Storage)
+{
+    driver::eeprom::Stub<128U> eeprom{};
+    constexpr std::uint16_t address{0U};
+    lin_reg::Online model{0.95};
+
+    // Case 1 - Verify that an untrained model cannot be stored.
+    {
+        EXPECT_TRUE(model.update(0.5, 0.0));
+        EXPECT_FALSE(lin_reg::storage::save(model, eeprom, address));
+    }
+
+    // Case 2 - Verify that the restored model updates exactly as the original model.
+    {
+        EXPECT_TRUE(model.update(1.0, 50.0));
+        EXPECT_TRUE(model.update(0.2, -30.0));
+        EXPECT_TRUE(lin_reg::storage::save(model, eeprom, address));
+
+        lin_reg::Online restored{0.95};
+        EXPECT_TRUE(lin_reg::storage::load(restored, eeprom, address));
+        EXPECT_TRUE(restored.isTrained());
+
+        EXPECT_TRUE(model.update(0.8, 31.0));
+        EXPECT_TRUE(restored.update(0.8, 31.0));
+        for (double input{0.0}; input <= 1.5; input += 0.5)
+        {
+            EXPECT_EQ(model.predict(input), restored.predict(input));
+        }
+    }
+
+    // Case 3 - Verify that a record of another model type is rejected.
+    {
+        lin_reg::Fixed fixed{lin_reg::Parameters{1.0, 2.0, true}};
+        EXPECT_TRUE(lin_reg::storage::save(fixed, eeprom, address));
+        lin_reg::Online restored{};
+        EXPECT_FALSE(lin_reg::storage::load(restored, eeprom, address));
+    }
+}
+
+/**
+ * @brief Invalid online training test.
+ * 
+ *        Verify that invalid parameters and training data are handled.
+ */
+TEST(LinRegOnline, Invalid)
+{
+    // Case 1 - Verify that training requires at least two training sets.
+    {
+        lin_reg::Online model{};
+        EXPECT_FALSE(model.train(Matrix1d{}, Matrix2d{}));
+        EXPECT_FALSE(model.train(Matrix1d{1.0}, Matrix2d{2.0}));
+        EXPECT_FALSE(model.isTrained());
+    }
+
+    // Case 2 - Verify that invalid forgetting factors are replaced by 1.
+    {
+        lin_reg::Online invalid{0.0, -1.0};
+        lin_reg::Online reference{};
+        const Matrix1d trainIn{0.0, 1.0, 2.0};
+        const Matrix2d trainOut{1.0, 2.5, 5.0};
+        EXPECT_TRUE(invalid.train(trainIn, trainOut));
+        EXPECT_TRUE(reference.train(trainIn, trainOut));
+        EXPECT_EQ(reference.predict(1.5), invalid.predict(1.5));
+    }
+
+    // Case 3 - Verify that reset returns the model to the untrained state.
+    {
+        lin_reg::Online model{};
+        EXPECT_TRUE(model.train(Matrix1d{0.0, 1.0}, Matrix2d{1.0, 3.0}));
+        model.reset();
+        EXPECT_FALSE(model.isTrained());
+        EXPECT_EQ(0.0, model.predict(1.0));
+    }
+}
+} // namespace
+} // namespace ml
+
+#endif /** TESTSUITE */
@@ -0,0 +1,244 @@
+/**
+ * @brief Unit tests for the piecewise linear regression model.
+ */
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "driver/eeprom/stub.h"
+#include "ml/lin_reg/piecewise.h"
+#include "ml/lin_reg/storage.h"
+#include "ml/types.h"
+#include "utils/utils.h"
+
+#ifdef TESTSUITE
+
+namespace ml
+{
+namespace
+{
+/** Max value of a 10-bit ADC. */
+constexpr std::uint16_t AdcMax{1023U};
+
+/** ADC supply voltage in Volts. */
+constexpr double SupplyVoltage{5.0};
+
+// -----------------------------------------------------------------------------
+double toVoltage(const std::uint16_t adcValue) noexcept
+{
+    return static_cast<double>(adcValue) / AdcMax * SupplyVoltage;
+}
+
+// -----------------------------------------------------------------------------
+double thermistor(const double voltage) noexcept
+{
+    // NTC thermistor (10 kOhm, B = 3950) in a voltage divider with 10 kOhm at 5 V.
+    const double resistanceRatio{voltage / (5.0 - voltage)};
+    return 1.0 / (1.0 / 298.15 + std::log(resistanceRatio) / 3950.0) - 273.15;
+}
+
+/**
+ * @brief Piecewise linear happy path test.
+ * 
+ *        Verify that a pre-trained model interpolates between the knots and extrapolates the 
+ *        end segments.
+ */
+TEST(LinRegPiecewise, HappyPath)
+{
+    // Case 1 - Verify that the model is untrained and predicts 0 before training.
+    {
+        lin_reg::Piecewise<3U> model{};
+        EXPECT_FALSE(model.isTrained());
+        EXPECT_EQ(0.0, model.predict(1.0));
+    }
+
+    // Case 2 - Verify interpolation, the knots themselves and extrapolation.
+    {
+        const lin_reg::Piecewise<3U> model{{0.0, 1.0, 2.0, 3.0}, {0.0, 10.0, 15.0, 30.0}};
+        EXPECT_TRUE(model.isTrained());
+
+        constexpr double precision{1e-12};
+        EXPECT_NEAR(5.0, model.predict(0.5), precision);
+        EXPECT_NEAR(12.5, model.predict(1.5), precision);
+        EXPECT_NEAR(22.5, model.predict(2.5), precision);
+        EXPECT_NEAR(10.0, model.predict(1.0), precision);
+        EXPECT_NEAR(15.0, model.predict(2.0), precision);
+        EXPECT_NEAR(30.0, model.predict(3.0), precision);
+        EXPECT_NEAR(-10.0, model.predict(-1.0), precision);
+        EXPECT_NEAR(45.0, model.predict(4.0), precision);
+    }
+
+    // Case 3 - Verify that knots not in strictly increasing order are rejected.
+    {
+        const lin_reg::Piecewise<2U> unordered{{0.0, 2.0, 1.0}, {0.0, 1.0, 2.0}};
+        const lin_reg::Piecewise<2U> duplicate{{0.0, 1.0, 1.0}, {0.0, 1.0, 2.0}};
+        EXPECT_FALSE(unordered.isTrained());
+        EXPECT_FALSE(duplicate.isTrained());
+    }
+}
+
+/**
+ * @brief Piecewise linear training test.
+ * 
+ *        Verify that training recovers piecewise linear data exactly and that more segments 
+ *        fit a thermistor more closely.
+ */
+TEST(LinRegPiecewise, Train)
+{
+    // Case 1 - Train on piecewise linear data with knots at 0, 1, 2 and 3.
+    {
+        const lin_reg::Piecewise<3U> reference{{0.0, 1.0, 2.0, 3.0}, {-5.0, 10.0, 12.0, 30.0}};
+        Matrix1d trainIn{};
+        Matrix2d trainOut{};
+        for (double input{0.0}; input <= 3.0; input += 0.125)
+        {
+            trainIn.pushBack(input);
+            trainOut.pushBack(reference.predict(input));
+        }
+
+        lin_reg::Piecewise<3U> model{};
+        EXPECT_TRUE(model.train(trainIn, trainOut));
+        EXPECT_TRUE(model.isTrained());
+        for (std::uint8_t i{}; i < 4U; ++i) { EXPECT_NEAR(i, model.knot(i), 1e-12); }
+        for (double input{-0.5}; input <= 3.5; input += 0.1)
+        {
+            EXPECT_NEAR(reference.predict(input), model.predict(input), 1e-9);
+        }
+    }
+
+    // Case 2 - Train on thermistor data, expect the error to decrease with more segments.
+    {
+        Matrix1d trainIn{};
+        Matrix2d trainOut{};
+        for (double voltage{0.5}; voltage <= 4.5; voltage += 0.05)
+        {
+            trainIn.pushBack(voltage);
+            trainOut.pushBack(thermistor(voltage));
+        }
+
+        auto maxError{[&trainIn, &trainOut](const lin_reg::Interface& model)
+        {
+            double result{};
+            for (std::size_t i{}; i < trainIn.size(); ++i)
+            {
+                const double error{std::fabs(trainOut[i] - model.predict(trainIn[i]))};
+                result = error > result ? error : result;
+            }
+            return result;
+        }};
+
+        lin_reg::Piecewise<4U> coarse{};
+        lin_reg::Piecewise<12U> fine{};
+        EXPECT_TRUE(coarse.train(trainIn, trainOut));
+        EXPECT_TRUE(fine.train(trainIn, trainOut));
+        EXPECT_GT(maxError(coarse), maxError(fine));
+        EXPECT_GT(1.0, maxError(fine));
+    }
+}
+
+/**
+ * @brief Invalid piecewise linear training test.
+ * 
+ *        Verify that the model doesn't get trained if the knots can't be determined.
+ */
+TEST(LinRegPiecewise, Invalid)
+{
+    lin_reg::Piecewise<4U> model{};
+
+    // Case 1 - Verify that too few training sets and equal inputs are rejected.
+    EXPECT_FALSE(model.train(Matrix1d{}, Matrix2d{}));
+    EXPECT_FALSE(model.train(Matrix1d{1.0}, Matrix2d{1.0}));
+    EXPECT_FALSE(model.train(Matrix1d{1.0, 1.0, 1.0}, Matrix2d{1.0, 2.0, 3.0}));
+
+    // Case 2 - Verify that knots without training data in their segments are rejected.
+    EXPECT_FALSE(model.train(Matrix1d{0.0, 0.1, 0.2, 10.0}, Matrix2d{0.0, 1.0, 2.0, 3.0}));
+    EXPECT_FALSE(model.isTrained());
+}
+
+/**
+ * @brief Piecewise linear model storage test.
+ * 
+ *        Verify that a stored model is restored with its knots and values.
+ */
+TEST(LinRegPiecewise, Storage)
+{
+    driver::eeprom::Stub<128U> eeprom{};
+    constexpr std::uint16_t address{0U};
+    const lin_reg::Piecewise<3U> model{{0.0, 1.0, 2.0, 3.0}, {0.0, 10.0, 15.0, 30.0}};
+    EXPECT_TRUE(lin_reg::storage::save(model, eeprom, address));
+
+    lin_reg::Piecewise<3U> restored{};
+    EXPECT_TRUE(lin_reg::storage::load(restored, eeprom, address));
+    for (double input{-1.0}; input <= 4.0; input += 0.25)
+    {
+        EXPECT_EQ(model.predict(input), restored.predict(input));
+    }
+
+    // Verify that a model with another number of segments rejects the record.
+    lin_reg::Piecewise<2U> other{};
+    EXPECT_FALSE(lin_reg::storage::load(other, eeprom, address));
+}
+
+/**
+ * @brief Piecewise linear quantization test.
+ * 
+ *        Verify that the quantized model predicts as the floating-point model over the entire 
+ *        ADC range, including knots outside the ADC range.
+ */
+TEST(LinRegPiecewise, Quantized)
+{
+    double maxError{};
+
+    // Case 1 - Verify that untrained models and invalid parameters are rejected.
+    {
+        lin_reg::QuantizedPiecewise<3U> quantized{};
+        const lin_reg::Piecewise<3U> untrained{};
+        const lin_reg::Piecewise<3U> model{{0.0, 1.0, 2.0, 3.0}, {0.0, 10.0, 15.0, 30.0}};
+        EXPECT_FALSE(quantized.quantize(untrained, AdcMax, SupplyVoltage, maxError));
+        EXPECT_FALSE(quantized.quantize(model, 0U, SupplyVoltage, maxError));
+        EXPECT_FALSE(quantized.quantize(model, AdcMax, 0.0, maxError));
+        EXPECT_FALSE(quantized.isTrained());
+        EXPECT_EQ(0, quantized.predict(AdcMax));
+    }
+
+    // Case 2 - Quantize a thermistor model, expect each prediction to match within rounding.
+    {
+        Matrix1d trainIn{};
+        Matrix2d trainOut{};
+        for (double voltage{0.5}; voltage <= 4.5; voltage += 0.05)
+        {
+            trainIn.pushBack(voltage);
+            trainOut.pushBack(thermistor(voltage));
+        }
+        lin_reg::Piecewise<8U> model{};
+        lin_reg::QuantizedPiecewise<8U> quantized{};
+        EXPECT_TRUE(model.train(trainIn, trainOut));
+        EXPECT_TRUE(quantized.quantize(model, AdcMax, SupplyVoltage, maxError));
+        EXPECT_TRUE(quantized.isTrained());
+        EXPECT_GT(0.05, maxError);
+
+        for (std::uint16_t adcValue{}; adcValue <= AdcMax; ++adcValue)
+        {
+            const double expected{model.predict(toVoltage(adcValue))};
+            EXPECT_NEAR(expected, quantized.predict(adcValue), 0.5 + maxError);
+        }
+        EXPECT_EQ(quantized.predict(AdcMax), quantized.predict(UINT16_MAX));
+    }
+
+    // Case 3 - Verify that knots outside the ADC range are clamped.
+    {
+        const lin_reg::Piecewise<3U> model{{-1.0, 0.0, 5.0, 6.0}, {-10.0, 0.0, 50.0, 100.0}};
+        lin_reg::QuantizedPiecewise<3U> quantized{};
+        EXPECT_TRUE(quantized.quantize(model, AdcMax, SupplyVoltage, maxError));
+        EXPECT_GT(0.01, maxError);
+        EXPECT_EQ(0, quantized.predict(0U));
+        EXPECT_EQ(25, quantized.predict(512U));
+        EXPECT_EQ(50, quantized.predict(AdcMax));
+    }
+}
+} // namespace
+} // namespace ml
+
+#endif /** TESTSUITE */
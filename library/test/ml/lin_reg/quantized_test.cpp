@@ -0,0 +1,136 @@
+/**
+ * @brief Unit tests for the quantized linear regression model.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "ml/lin_reg/fixed.h"
+#include "ml/lin_reg/quantized.h"
+#include "utils/utils.h"
+
+#ifdef TESTSUITE
+
+namespace ml
+{
+namespace
+{
+/** Max value of a 10-bit ADC. */
+constexpr std::uint16_t AdcMax{1023U};
+
+/** ADC supply voltage in Volts. */
+constexpr double SupplyVoltage{5.0};
+
+// -----------------------------------------------------------------------------
+double toVoltage(const std::uint16_t adcValue) noexcept
+{
+    return static_cast<double>(adcValue) / AdcMax * SupplyVoltage;
+}
+
+/**
+ * @brief Quantization happy path test.
+ * 
+ *        Verify that the quantized model predicts as the floating-point model over the entire 
+ *        ADC range, with the reported max error.
+ */
+TEST(LinRegQuantized, HappyPath)
+{
+    // Create a model predicting T = 100 * Uin - 50.
+    const lin_reg::Fixed model{lin_reg::Parameters{100.0, -50.0, true}};
+    lin_reg::Quantized<> quantized{};
+    double maxError{};
+
+    // Expect the quantized model to be untrained and predict 0 before quantization.
+    EXPECT_FALSE(quantized.isTrained());
+    EXPECT_EQ(0, quantized.predict(AdcMax));
+
+    // Quantize the model, expect a max error well below one degree.
+    EXPECT_TRUE(quantized.quantize(model, AdcMax, SupplyVoltage, maxError));
+    EXPECT_TRUE(quantized.isTrained());
+    EXPECT_GT(0.01, maxError);
+
+    // Verify that each prediction is within the max error plus rounding.
+    for (std::uint16_t adcValue{}; adcValue <= AdcMax; ++adcValue)
+    {
+        const double expected{model.predict(toVoltage(adcValue))};
+        EXPECT_NEAR(expected, quantized.predict(adcValue), 0.5 + maxError);
+        EXPECT_NEAR(utils::round<std::int16_t>(expected), quantized.predict(adcValue), 1);
+    }
+
+    // Verify that ADC values above the max value are saturated.
+    EXPECT_EQ(quantized.predict(AdcMax), quantized.predict(AdcMax + 1U));
+    EXPECT_EQ(quantized.predict(AdcMax), quantized.predict(UINT16_MAX));
+}
+
+/**
+ * @brief Quantization precision test.
+ * 
+ *        Verify that the reported max error shrinks with more fractional bits.
+ */
+TEST(LinRegQuantized, Precision)
+{
+    const lin_reg::Fixed model{lin_reg::Parameters{100.0, -50.0, true}};
+    lin_reg::Quantized<4U> coarse{};
+    lin_reg::Quantized<20U> fine{};
+    double coarseError{};
+    double fineError{};
+
+    EXPECT_TRUE(coarse.quantize(model, AdcMax, SupplyVoltage, coarseError));
+    EXPECT_TRUE(fine.quantize(model, AdcMax, SupplyVoltage, fineError));
+    EXPECT_LT(fineError, coarseError);
+
+    // Verify that the coarse model stays within its reported error bound (plus rounding).
+    constexpr double precision{1e-9};
+    for (std::uint16_t adcValue{}; adcValue <= AdcMax; ++adcValue)
+    {
+        EXPECT_NEAR(model.predict(toVoltage(adcValue)), coarse.predict(adcValue), 
+                    0.5 + coarseError + precision);
+    }
+}
+
+/**
+ * @brief Invalid quantization test.
+ * 
+ *        Verify that models are only quantized if trained and representable.
+ */
+TEST(LinRegQuantized, Invalid)
+{
+    double maxError{};
+
+    // Case 1 - Verify that an untrained model isn't quantized.
+    {
+        const lin_reg::Fixed model{};
+        lin_reg::Quantized<> quantized{};
+        EXPECT_FALSE(quantized.quantize(model, AdcMax, SupplyVoltage, maxError));
+        EXPECT_FALSE(quantized.isTrained());
+    }
+
+    // Case 2 - Verify that an invalid ADC range is rejected.
+    {
+        const lin_reg::Fixed model{lin_reg::Parameters{100.0, -50.0, true}};
+        lin_reg::Quantized<> quantized{};
+        EXPECT_FALSE(quantized.quantize(model, 0U, SupplyVoltage, maxError));
+        EXPECT_FALSE(quantized.quantize(model, AdcMax, 0.0, maxError));
+        EXPECT_FALSE(quantized.isTrained());
+    }
+
+    // Case 3 - Verify that predictions overflowing the fixed-point format are rejected.
+    {
+        const lin_reg::Fixed model{lin_reg::Parameters{100.0, -50.0, true}};
+        lin_reg::Quantized<24U> quantized{};
+        EXPECT_FALSE(quantized.quantize(model, AdcMax, SupplyVoltage, maxError));
+        EXPECT_FALSE(quantized.isTrained());
+    }
+
+    // Case 4 - Verify that predictions overflowing 16 bits are rejected.
+    {
+        const lin_reg::Fixed model{lin_reg::Parameters{10000.0, 0.0, true}};
+        lin_reg::Quantized<1U> quantized{};
+        EXPECT_FALSE(quantized.quantize(model, AdcMax, SupplyVoltage, maxError));
+        EXPECT_FALSE(quantized.isTrained());
+    }
+}
+} // namespace
+} // namespace ml
+
+#endif /** TESTSUITE */
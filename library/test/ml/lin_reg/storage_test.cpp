@@ -0,0 +1,180 @@
+/**
+ * @brief Unit tests for the persistent storage of linear regression models.
+ */
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "driver/eeprom/stub.h"
+#include "ml/lin_reg/fixed.h"
+#include "ml/lin_reg/storage.h"
+#include "ml/types.h"
+#include "utils/codec.h"
+
+#ifdef TESTSUITE
+
+namespace ml
+{
+namespace
+{
+/** EEPROM size in bytes. */
+constexpr std::uint16_t EepromSize{64U};
+
+/** Start address of the stored model. */
+constexpr std::uint16_t ModelAddress{16U};
+
+// -----------------------------------------------------------------------------
+void trainModel(lin_reg::Fixed& model) noexcept
+{
+    const Matrix1d trainIn{0.0, 1.0, 2.0, 3.0, 4.0};
+    const Matrix2d trainOut{-3.0, -1.0, 1.0, 3.0, 5.0};
+    EXPECT_TRUE(model.trainLeastSquares(trainIn, trainOut));
+}
+
+/**
+ * @brief Model serialization test.
+ * 
+ *        Verify that serialized model parameters restore an identical model.
+ */
+TEST(LinRegStorage, Serialize)
+{
+    lin_reg::Fixed model{};
+    std::uint8_t data[32U]{};
+    EXPECT_EQ(2U * sizeof(double), model.serializedSize());
+
+    // Case 1 - Verify that an untrained model cannot be serialized.
+    {
+        EXPECT_FALSE(model.serialize(data, sizeof(data)));
+    }
+
+    // Case 2 - Verify that a trained model is restored by deserialization.
+    {
+        trainModel(model);
+        EXPECT_TRUE(model.serialize(data, sizeof(data)));
+
+        lin_reg::Fixed restored{};
+        EXPECT_TRUE(restored.deserialize(data, model.serializedSize()));
+        EXPECT_TRUE(restored.isTrained());
+
+        for (double input{-2.0}; input <= 2.0; input += 0.5)
+        {
+            EXPECT_EQ(model.predict(input), restored.predict(input));
+        }
+    }
+
+    // Case 3 - Verify that invalid buffer sizes are rejected.
+    {
+        lin_reg::Fixed restored{};
+        EXPECT_FALSE(model.serialize(data, model.serializedSize() - 1U));
+        EXPECT_FALSE(restored.deserialize(data, model.serializedSize() - 1U));
+        EXPECT_FALSE(restored.deserialize(nullptr, model.serializedSize()));
+        EXPECT_FALSE(restored.isTrained());
+    }
+}
+
+/**
+ * @brief Model save and load test.
+ * 
+ *        Verify that a stored model is loaded with identical parameters.
+ */
+TEST(LinRegStorage, SaveAndLoad)
+{
+    driver::eeprom::Stub<EepromSize> eeprom{};
+    lin_reg::Fixed model{};
+
+    // Case 1 - Verify that an untrained model cannot be saved.
+    {
+        EXPECT_FALSE(lin_reg::storage::save(model, eeprom, ModelAddress));
+    }
+
+    // Case 2 - Verify that the loaded model predicts exactly as the stored model.
+    {
+        trainModel(model);
+        EXPECT_TRUE(lin_reg::storage::save(model, eeprom, ModelAddress));
+        EXPECT_EQ(lin_reg::storage::Version, eeprom.readByte(ModelAddress));
+        EXPECT_EQ(model.serializedSize(), eeprom.readByte(ModelAddress + 1U));
+
+        lin_reg::Fixed loaded{};
+        EXPECT_TRUE(lin_reg::storage::load(loaded, eeprom, ModelAddress));
+        EXPECT_TRUE(loaded.isTrained());
+
+        for (double input{-2.0}; input <= 2.0; input += 0.5)
+        {
+            EXPECT_EQ(model.predict(input), loaded.predict(input));
+        }
+    }
+
+    // Case 3 - Verify that records that don't fit in EEPROM are rejected.
+    {
+        const std::uint16_t address{
+            static_cast<std::uint16_t>(EepromSize - lin_reg::storage::recordSize(model) + 1U)};
+        EXPECT_FALSE(lin_reg::storage::save(model, eeprom, address));
+    }
+}
+
+/**
+ * @brief Invalid record test.
+ * 
+ *        Verify that missing, outdated or corrupt records aren't loaded.
+ */
+TEST(LinRegStorage, InvalidRecord)
+{
+    driver::eeprom::Stub<EepromSize> eeprom{};
+
+    // Case 1 - Verify that nothing is loaded from empty EEPROM.
+    {
+        lin_reg::Fixed loaded{};
+        EXPECT_FALSE(lin_reg::storage::load(loaded, eeprom, ModelAddress));
+        EXPECT_FALSE(loaded.isTrained());
+    }
+
+    // Store a valid record for the following cases.
+    lin_reg::Fixed model{};
+    trainModel(model);
+    const std::uint16_t recordSize{lin_reg::storage::recordSize(model)};
+    EXPECT_TRUE(lin_reg::storage::save(model, eeprom, ModelAddress));
+
+    // Case 2 - Verify that a corrupt byte anywhere in the record is detected.
+    {
+        for (std::uint16_t i{}; i < recordSize; ++i)
+        {
+            const std::uint16_t address{static_cast<std::uint16_t>(ModelAddress + i)};
+            const std::uint8_t original{eeprom.readByte(address)};
+            eeprom.writeByte(address, original ^ 0x10U);
+
+            lin_reg::Fixed loaded{};
+            EXPECT_FALSE(lin_reg::storage::load(loaded, eeprom, ModelAddress));
+            EXPECT_FALSE(loaded.isTrained());
+            eeprom.writeByte(address, original);
+        }
+    }
+
+    // Case 3 - Verify that records of another version are rejected, even with a valid checksum.
+    {
+        // Update the version and the checksum of the stored record.
+        std::uint8_t data[32U]{};
+        const std::uint16_t dataSize{static_cast<std::uint16_t>(recordSize - 2U)};
+        for (std::uint16_t i{}; i < dataSize; ++i) { data[i] = eeprom.readByte(ModelAddress + i); }
+        data[0U] = lin_reg::storage::Version + 1U;
+        eeprom.writeByte(ModelAddress, data[0U]);
+        EXPECT_TRUE(eeprom.write(ModelAddress + dataSize, utils::crc::crc16(data, dataSize)));
+
+        lin_reg::Fixed loaded{};
+        EXPECT_FALSE(lin_reg::storage::load(loaded, eeprom, ModelAddress));
+        EXPECT_FALSE(loaded.isTrained());
+        EXPECT_TRUE(lin_reg::storage::save(model, eeprom, ModelAddress));
+    }
+
+    // Case 4 - Verify that nothing is loaded when the EEPROM is disabled.
+    {
+        lin_reg::Fixed loaded{};
+        eeprom.setEnabled(false);
+        EXPECT_FALSE(lin_reg::storage::load(loaded, eeprom, ModelAddress));
+        eeprom.setEnabled(true);
+        EXPECT_TRUE(lin_reg::storage::load(loaded, eeprom, ModelAddress));
+    }
+}
+} // namespace
+} // namespace ml
+
+#endif /** TESTSUITE */
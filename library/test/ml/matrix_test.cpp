@@ -0,0 +1,317 @@
+/**
+ * @brief Unit tests for the ml::Matrix class and the linear algebra kernels.
+ */
+#include <cstddef>
+
+#include <gtest/gtest.h>
+
+#include "ml/matrix.h"
+
+#ifdef TESTSUITE
+
+namespace ml
+{
+namespace
+{
+// -----------------------------------------------------------------------------
+template <typename T, std::size_t Rows, std::size_t Cols, std::size_t ValueCount>
+void assign(Matrix<T, Rows, Cols>& matrix, const T (&values)[ValueCount]) noexcept
+{
+    ASSERT_EQ(ValueCount, matrix.size());
+    for (std::size_t i{}; i < ValueCount; ++i) { matrix.data()[i] = values[i]; }
+}
+
+/**
+ * @brief Matrix construction test.
+ * 
+ *        Verify that matrices with compile-time and runtime dimensions are created and 
+ *        resized as intended.
+ */
+TEST(Matrix, Construction)
+{
+    // Case 1 - Verify that matrices with compile-time dimensions are zero-initialized.
+    {
+        Matrix<double, 2U, 3U> matrix{};
+        EXPECT_TRUE(matrix.isStatic());
+        EXPECT_EQ(2U, matrix.rows());
+        EXPECT_EQ(3U, matrix.cols());
+        EXPECT_EQ(6U, matrix.size());
+        for (std::size_t i{}; i < matrix.size(); ++i) { EXPECT_EQ(0.0, matrix.data()[i]); }
+
+        // Expect the dimensions to be fixed.
+        EXPECT_TRUE(matrix.resize(2U, 3U));
+        EXPECT_FALSE(matrix.resize(3U, 2U));
+        EXPECT_EQ(2U, matrix.rows());
+    }
+
+    // Case 2 - Verify that matrices with runtime dimensions are empty by default.
+    {
+        Matrix<double> matrix{};
+        EXPECT_FALSE(matrix.isStatic());
+        EXPECT_TRUE(matrix.empty());
+        EXPECT_EQ(nullptr, matrix.data());
+    }
+
+    // Case 3 - Verify that matrices with runtime dimensions are resized and zeroed.
+    {
+        Matrix<double> matrix{3U, 4U};
+        EXPECT_EQ(3U, matrix.rows());
+        EXPECT_EQ(4U, matrix.cols());
+        matrix.fill(1.0);
+
+        EXPECT_TRUE(matrix.resize(5U, 2U));
+        EXPECT_EQ(5U, matrix.rows());
+        EXPECT_EQ(2U, matrix.cols());
+        for (std::size_t i{}; i < matrix.size(); ++i) { EXPECT_EQ(0.0, matrix.data()[i]); }
+
+        EXPECT_FALSE(matrix.resize(0U, 2U));
+        EXPECT_TRUE(matrix.resize(0U, 0U));
+        EXPECT_TRUE(matrix.empty());
+    }
+}
+
+/**
+ * @brief Matrix view test.
+ * 
+ *        Verify that row and column views refer to the matrix elements without copying.
+ */
+TEST(Matrix, Views)
+{
+    Matrix<int, 3U, 2U> matrix{};
+    assign(matrix, {1, 2, 
+                    3, 4, 
+                    5, 6});
+
+    // Case 1 - Verify that row views are contiguous.
+    {
+        const VectorView<int> row{matrix.row(1U)};
+        EXPECT_EQ(2U, row.size());
+        EXPECT_EQ(1U, row.stride());
+        EXPECT_EQ(&matrix(1U, 0U), row.data());
+        EXPECT_EQ(3, row[0U]);
+        EXPECT_EQ(4, row[1U]);
+    }
+
+    // Case 2 - Verify that column views are strided.
+    {
+        const VectorView<int> col{matrix.col(1U)};
+        EXPECT_EQ(3U, col.size());
+        EXPECT_EQ(2U, col.stride());
+        EXPECT_EQ(2, col[0U]);
+        EXPECT_EQ(4, col[1U]);
+        EXPECT_EQ(6, col[2U]);
+    }
+
+    // Case 3 - Verify that writes through views update the matrix.
+    {
+        matrix.col(0U)[2U] = 50;
+        matrix.row(0U)[1U] = 20;
+        EXPECT_EQ(50, matrix(2U, 0U));
+        EXPECT_EQ(20, matrix(0U, 1U));
+
+        const Matrix<int, 3U, 2U>& constMatrix{matrix};
+        const VectorView<const int> row{constMatrix.row(2U)};
+        EXPECT_EQ(50, row[0U]);
+    }
+}
+
+/**
+ * @brief Matrix multiplication test.
+ * 
+ *        Verify that matrices are multiplied as intended, also with mixed dimension types.
+ */
+TEST(Matrix, Multiply)
+{
+    Matrix<double, 2U, 3U> a{};
+    Matrix<double> b{3U, 2U};
+    assign(a, {1.0, 2.0, 3.0, 
+               4.0, 5.0, 6.0});
+    assign(b, {7.0, 8.0, 
+               9.0, 10.0, 
+               11.0, 12.0});
+
+    // Case 1 - Verify that the output matrix is resized and holds the product.
+    {
+        Matrix<double> out{};
+        EXPECT_TRUE(multiply(a, b, out));
+        EXPECT_EQ(2U, out.rows());
+        EXPECT_EQ(2U, out.cols());
+        EXPECT_EQ(58.0, out(0U, 0U));
+        EXPECT_EQ(64.0, out(0U, 1U));
+        EXPECT_EQ(139.0, out(1U, 0U));
+        EXPECT_EQ(154.0, out(1U, 1U));
+    }
+
+    // Case 2 - Verify that outputs with compile-time dimensions are supported.
+    {
+        Matrix<double, 3U, 3U> out{};
+        EXPECT_TRUE(multiply(b, a, out));
+        EXPECT_EQ(39.0, out(0U, 0U));
+        EXPECT_EQ(105.0, out(2U, 2U));
+    }
+
+    // Case 3 - Verify that mismatching dimensions and aliasing are rejected.
+    {
+        Matrix<double, 2U, 2U> out{};
+        EXPECT_FALSE(multiply(a, a, out));
+        EXPECT_FALSE(multiply(b, a, out));
+
+        Matrix<double> square{2U, 2U};
+        EXPECT_FALSE(multiply(square, square, square));
+    }
+}
+
+/**
+ * @brief Matrix-vector multiplication test.
+ * 
+ *        Verify that matrices are multiplied with row and column views.
+ */
+TEST(Matrix, MultiplyVector)
+{
+    Matrix<double, 2U, 3U> a{};
+    Matrix<double, 3U, 2U> x{};
+    Matrix<double> y{2U, 2U};
+    assign(a, {1.0, 2.0, 3.0, 
+               4.0, 5.0, 6.0});
+    assign(x, {1.0, 0.0, 
+               2.0, 1.0, 
+               3.0, 0.0});
+
+    // Case 1 - Verify that a column view is multiplied into a column view.
+    {
+        EXPECT_TRUE(multiply(a, x.col(0U), y.col(1U)));
+        EXPECT_EQ(14.0, y(0U, 1U));
+        EXPECT_EQ(32.0, y(1U, 1U));
+        EXPECT_EQ(0.0, y(0U, 0U));
+    }
+
+    // Case 2 - Verify that mismatching sizes are rejected.
+    {
+        EXPECT_FALSE(multiply(a, y.row(0U), y.col(0U)));
+        EXPECT_FALSE(multiply(a, x.col(0U), x.col(1U)));
+    }
+}
+
+/**
+ * @brief Matrix transpose test.
+ * 
+ *        Verify that matrices larger than one block are transposed as intended.
+ */
+TEST(Matrix, Transpose)
+{
+    constexpr std::size_t rows{11U};
+    constexpr std::size_t cols{19U};
+    Matrix<int> a{rows, cols};
+    for (std::size_t i{}; i < a.size(); ++i) { a.data()[i] = static_cast<int>(i); }
+
+    // Case 1 - Verify that each element is moved to its transposed position.
+    {
+        Matrix<int> out{};
+        EXPECT_TRUE(transpose(a, out));
+        EXPECT_EQ(cols, out.rows());
+        EXPECT_EQ(rows, out.cols());
+
+        for (std::size_t i{}; i < rows; ++i)
+        {
+            for (std::size_t j{}; j < cols; ++j) { EXPECT_EQ(a(i, j), out(j, i)); }
+        }
+    }
+
+    // Case 2 - Verify that mismatching dimensions and aliasing are rejected.
+    {
+        Matrix<int, rows, cols> out{};
+        EXPECT_FALSE(transpose(a, out));
+        EXPECT_FALSE(transpose(a, a));
+    }
+}
+
+/**
+ * @brief Scaled vector addition test.
+ * 
+ *        Verify that scaled vectors are added to rows and columns as intended.
+ */
+TEST(Matrix, Axpy)
+{
+    Matrix<double, 2U, 2U> matrix{};
+    assign(matrix, {1.0, 2.0, 
+                    3.0, 4.0});
+
+    // Case 1 - Verify that a scaled row is added to the other row.
+    {
+        EXPECT_TRUE(axpy(-3.0, matrix.row(0U), matrix.row(1U)));
+        EXPECT_EQ(0.0, matrix(1U, 0U));
+        EXPECT_EQ(-2.0, matrix(1U, 1U));
+    }
+
+    // Case 2 - Verify that mismatching sizes are rejected.
+    {
+        Matrix<double> other{3U, 1U};
+        EXPECT_FALSE(axpy(1.0, other.col(0U), matrix.row(0U)));
+        EXPECT_EQ(1.0, matrix(0U, 0U));
+    }
+}
+
+/**
+ * @brief Linear system solver test.
+ * 
+ *        Verify that square systems are solved with partial pivoting, also if the diagonal 
+ *        contains zeros, and that singular systems are rejected.
+ */
+TEST(Matrix, Solve)
+{
+    // Case 1 - Solve a system with a dominant diagonal.
+    {
+        Matrix<double, 2U, 2U> a{};
+        assign(a, {4.0, 1.0, 
+                   2.0, 3.0});
+        double b[2U]{9.0, 13.0};
+        double x[2U]{};
+        EXPECT_TRUE(solve(a, b, x));
+        EXPECT_NEAR(1.4, x[0U], 1e-12);
+        EXPECT_NEAR(3.4, x[1U], 1e-12);
+    }
+
+    // Case 2 - Solve a permutation system with a zero diagonal, which requires pivoting.
+    {
+        Matrix<double, 2U, 2U> a{};
+        assign(a, {0.0, 1.0, 
+                   1.0, 0.0});
+        double b[2U]{2.0, 3.0};
+        double x[2U]{};
+        EXPECT_TRUE(solve(a, b, x));
+        EXPECT_DOUBLE_EQ(3.0, x[0U]);
+        EXPECT_DOUBLE_EQ(2.0, x[1U]);
+    }
+
+    // Case 3 - Solve a 3x3 system with a zero diagonal.
+    {
+        Matrix<double, 3U, 3U> a{};
+        assign(a, {0.0, 2.0, 1.0, 
+                   1.0, 0.0, 1.0, 
+                   2.0, 1.0, 0.0});
+        double b[3U]{5.0, 2.0, 4.0};
+        double x[3U]{};
+        EXPECT_TRUE(solve(a, b, x));
+        EXPECT_NEAR(1.0, x[0U], 1e-12);
+        EXPECT_NEAR(2.0, x[1U], 1e-12);
+        EXPECT_NEAR(1.0, x[2U], 1e-12);
+    }
+
+    // Case 4 - Expect singular systems to be rejected.
+    {
+        Matrix<double, 2U, 2U> a{};
+        assign(a, {1.0, 2.0, 
+                   2.0, 4.0});
+        double b[2U]{1.0, 2.0};
+        double x[2U]{};
+        EXPECT_FALSE(solve(a, b, x));
+
+        Matrix<double, 2U, 2U> zero{};
+        double zeroB[2U]{};
+        EXPECT_FALSE(solve(zero, zeroB, x));
+    }
+}
+} // namespace
+} // namespace ml
+
+#endif /** TESTSUITE */
@@ -0,0 +1,240 @@
+/**
+ * @brief Unit tests for the fixed-point dense neural network inference engine.
+ */
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+
+#include <gtest/gtest.h>
+
+#include "ml/nn/activation.h"
+#include "ml/nn/dense.h"
+#include "ml/nn/network.h"
+
+#ifdef TESTSUITE
+
+namespace ml
+{
+namespace
+{
+/** Q12 representation of 1.0. */
+constexpr std::int16_t One{1 << nn::ActivationFracBits};
+
+/** Hidden layer weights computing relu(x) and relu(-x), 6 fractional bits. */
+constexpr std::int8_t HiddenWeights[]{64, -64};
+
+/** Hidden layer biases, 12 + 6 fractional bits. */
+constexpr std::int32_t HiddenBiases[]{0, 0};
+
+/** Output layer weights computing 100 * (h0 + h1), no fractional bits. */
+constexpr std::int8_t OutputWeights[]{100, 100};
+
+/** Output layer bias 20, 12 fractional bits. */
+constexpr std::int32_t OutputBiases[]{20L << nn::ActivationFracBits};
+
+/** Layers of a network predicting y = 20 + 100 * |x| with a 4-bit output fraction. */
+constexpr nn::Dense<std::int8_t> AbsLayers[]{
+    {HiddenWeights, HiddenBiases, 1U, 2U, 6U, nn::Activation::Relu},
+    {OutputWeights, OutputBiases, 2U, 1U, 8U, nn::Activation::Linear},
+};
+
+/**
+ * @brief Activation function test.
+ * 
+ *        Verify that the ReLU and linear activations are exact and that the hyperbolic 
+ *        tangent lookup table is accurate over the entire input range.
+ */
+TEST(NeuralNetwork, Activation)
+{
+    // Case 1 - Verify the linear and ReLU activations.
+    {
+        EXPECT_EQ(-5, nn::activate(nn::Activation::Linear, -5));
+        EXPECT_EQ(5, nn::activate(nn::Activation::Linear, 5));
+        EXPECT_EQ(0, nn::activate(nn::Activation::Relu, -5));
+        EXPECT_EQ(0, nn::activate(nn::Activation::Relu, INT16_MIN));
+        EXPECT_EQ(5, nn::activate(nn::Activation::Relu, 5));
+    }
+
+    // Case 2 - Verify that the hyperbolic tangent is odd and accurate within 1/1024.
+    {
+        for (std::int32_t value{INT16_MIN}; value <= INT16_MAX; value += 7)
+        {
+            const std::int16_t input{static_cast<std::int16_t>(value)};
+            const std::int16_t output{nn::activate(nn::Activation::Tanh, input)};
+            EXPECT_NEAR(std::tanh(static_cast<double>(value) / One), 
+                        static_cast<double>(output) / One, 1.0 / 1024.0);
+
+            if (INT16_MIN < value)
+            {
+                const std::int16_t negated{static_cast<std::int16_t>(-value)};
+                EXPECT_EQ(-output, nn::activate(nn::Activation::Tanh, negated));
+            }
+        }
+        EXPECT_EQ(0, nn::activate(nn::Activation::Tanh, 0));
+    }
+}
+
+/**
+ * @brief Dense layer test.
+ * 
+ *        Verify that dense layers with 8-bit and 16-bit weights compute the weighted sums, 
+ *        round and saturate the outputs and apply the activation function.
+ */
+TEST(NeuralNetwork, Dense)
+{
+    // Rows [1.0, 2.0] and [-0.5, 0.25] with 4 fractional bits, biases 1.0 and 0.
+    constexpr std::int8_t weights[]{16, 32, -8, 4};
+    constexpr std::int32_t biases[]{1L << (nn::ActivationFracBits + 4U), 0};
+
+    // Case 1 - Compute [1.0, 0.5], expect outputs [3.0, -0.375].
+    {
+        const nn::Dense<std::int8_t> layer{weights, biases, 2U, 2U, 4U, nn::Activation::Linear};
+        const std::int16_t input[]{One, One / 2};
+        std::int16_t output[2U]{};
+        nn::forward(layer, input, output);
+        EXPECT_EQ(3 * One, output[0U]);
+        EXPECT_EQ(-3 * One / 8, output[1U]);
+    }
+
+    // Case 2 - Expect the ReLU activation to clear the negative output.
+    {
+        const nn::Dense<std::int8_t> layer{weights, biases, 2U, 2U, 4U, nn::Activation::Relu};
+        const std::int16_t input[]{One, One / 2};
+        std::int16_t output[2U]{};
+        nn::forward(layer, input, output);
+        EXPECT_EQ(3 * One, output[0U]);
+        EXPECT_EQ(0, output[1U]);
+    }
+
+    // Case 3 - Expect outputs out of range to be saturated.
+    {
+        const nn::Dense<std::int8_t> layer{weights, biases, 2U, 2U, 4U, nn::Activation::Linear};
+        const std::int16_t maxInput[]{INT16_MAX, INT16_MAX};
+        const std::int16_t minInput[]{INT16_MIN, INT16_MIN};
+        std::int16_t output[2U]{};
+        nn::forward(layer, maxInput, output);
+        EXPECT_EQ(INT16_MAX, output[0U]);
+        nn::forward(layer, minInput, output);
+        EXPECT_EQ(INT16_MIN, output[0U]);
+    }
+
+    // Case 4 - Expect 16-bit weights to be accumulated without overflow and rounded.
+    {
+        constexpr std::int16_t wideWeights[]{INT16_MAX, INT16_MAX, INT16_MAX, 8};
+        constexpr std::int32_t wideBiases[]{0};
+        const nn::Dense<std::int16_t> layer{wideWeights, wideBiases, 3U, 1U, 17U, 
+                                            nn::Activation::Linear};
+        const std::int16_t input[]{INT16_MAX, INT16_MAX, INT16_MAX};
+        std::int16_t output{};
+        nn::forward(layer, input, &output);
+        EXPECT_EQ(24575, output);
+
+        // Expect 3 * 0.5 = 1.5 to be rounded to 2.
+        const nn::Dense<std::int16_t> rounded{&wideWeights[3U], wideBiases, 1U, 1U, 4U, 
+                                              nn::Activation::Linear};
+        const std::int16_t three{3};
+        nn::forward(rounded, &three, &output);
+        EXPECT_EQ(2, output);
+    }
+}
+
+/**
+ * @brief Network happy path test.
+ * 
+ *        Verify that a network predicts based on normalized ADC values and runs inference
+ *        on fixed-point inputs.
+ */
+TEST(NeuralNetwork, HappyPath)
+{
+    // Map ADC values [0, 1023] to inputs [-1.0, 1.0) with 512 / 2^24 ADC values per input.
+    const nn::Network<std::int8_t, 2U, 2U> network{AbsLayers, 512U, 32768U, 4U};
+    EXPECT_TRUE(network.isTrained());
+    EXPECT_EQ(1U, network.inputCount());
+    EXPECT_EQ(1U, network.outputCount());
+
+    // Case 1 - Expect predictions of y = 20 + 100 * |x| over the entire ADC range.
+    {
+        for (std::uint16_t adcValue{}; adcValue <= 1023U; ++adcValue)
+        {
+            const double input{(static_cast<double>(adcValue) - 512.0) / 512.0};
+            EXPECT_NEAR(20.0 + 100.0 * std::fabs(input), network.predict(adcValue), 0.5 + 0.1);
+        }
+        EXPECT_EQ(20, network.predict(512U));
+        EXPECT_EQ(120, network.predict(0U));
+    }
+
+    // Case 2 - Expect inference on x = 0.5 to output 70 with 4 fractional bits.
+    {
+        const std::int16_t input{One / 2};
+        std::int16_t output{};
+        EXPECT_TRUE(network.infer(&input, &output));
+        EXPECT_EQ(70 * 16, output);
+    }
+
+    // Case 3 - Expect ADC values far from the offset to saturate the input.
+    {
+        const nn::Network<std::int8_t, 2U, 2U> steep{AbsLayers, 0U, UINT16_MAX, 0U};
+        EXPECT_EQ(steep.predict(UINT16_MAX / 2U), steep.predict(UINT16_MAX));
+    }
+}
+
+/**
+ * @brief Invalid network test.
+ * 
+ *        Verify that networks with mismatching or oversized layers are invalid and that
+ *        invalid networks neither predict nor run inference.
+ */
+TEST(NeuralNetwork, Invalid)
+{
+    const std::int16_t input[2U]{One / 16, One / 16};
+    std::int16_t output[2U]{};
+
+    // Case 1 - Expect layers with mismatching sizes to be invalid.
+    {
+        const nn::Dense<std::int8_t> layers[]{
+            {HiddenWeights, HiddenBiases, 1U, 2U, 6U, nn::Activation::Relu},
+            {OutputWeights, OutputBiases, 1U, 1U, 8U, nn::Activation::Linear},
+        };
+        const nn::Network<std::int8_t, 2U, 2U> network{layers};
+        EXPECT_FALSE(network.isTrained());
+        EXPECT_EQ(0U, network.inputCount());
+        EXPECT_EQ(0U, network.outputCount());
+        EXPECT_EQ(0, network.predict(512U));
+        EXPECT_FALSE(network.infer(input, output));
+    }
+
+    // Case 2 - Expect layers wider than the buffers to be invalid.
+    {
+        const nn::Network<std::int8_t, 2U, 1U> network{AbsLayers};
+        EXPECT_FALSE(network.isTrained());
+    }
+
+    // Case 3 - Expect missing weights and too many output fractional bits to be invalid.
+    {
+        const nn::Dense<std::int8_t> layers[]{
+            {nullptr, OutputBiases, 1U, 1U, 0U, nn::Activation::Linear},
+        };
+        EXPECT_FALSE((nn::Network<std::int8_t, 1U, 1U>{layers}.isTrained()));
+        EXPECT_FALSE((nn::Network<std::int8_t, 2U, 2U>{AbsLayers, 0U, 1U, 16U}.isTrained()));
+    }
+
+    // Case 4 - Expect a valid network with two inputs to run inference, but not predict.
+    {
+        const nn::Dense<std::int8_t> layers[]{
+            {OutputWeights, OutputBiases, 2U, 1U, 8U, nn::Activation::Linear},
+        };
+        const nn::Network<std::int8_t, 1U, 2U> network{layers, 0U, 1U << 14U, 4U};
+        EXPECT_TRUE(network.isTrained());
+        EXPECT_EQ(0, network.predict(512U));
+
+        // Expect 20 + 100 * (1/16 + 1/16) = 32.5 with 4 fractional bits.
+        EXPECT_TRUE(network.infer(input, output));
+        EXPECT_EQ(520, output[0U]);
+        EXPECT_FALSE(network.infer(nullptr, output));
+        EXPECT_FALSE(network.infer(input, nullptr));
+    }
+}
+} // namespace
+} // namespace ml
+
+#endif /** TESTSUITE */
@@ -0,0 +1,202 @@
+/**
+ * @brief Unit tests for the polynomial regression model.
+ */
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "driver/eeprom/stub.h"
+#include "ml/lin_reg/fixed.h"
+#include "ml/lin_reg/storage.h"
+#include "ml/poly_reg/fixed.h"
+#include "ml/types.h"
+
+#ifdef TESTSUITE
+
+namespace ml
+{
+namespace
+{
+// -----------------------------------------------------------------------------
+double cubic(const double input) noexcept
+{
+    return 1.0 - 2.0 * input + 0.5 * input * input + 0.25 * input * input * input;
+}
+
+// -----------------------------------------------------------------------------
+double thermistor(const double voltage) noexcept
+{
+    // NTC thermistor (10 kOhm, B = 3950) in a voltage divider with 10 kOhm at 5 V.
+    const double resistanceRatio{voltage / (5.0 - voltage)};
+    return 1.0 / (1.0 / 298.15 + std::log(resistanceRatio) / 3950.0) - 273.15;
+}
+
+/**
+ * @brief Polynomial regression happy path test.
+ * 
+ *        Verify that the model fits polynomial data exactly and that the coefficients can be
+ *        expressed in terms of a transformed input.
+ */
+TEST(PolyRegFixed, HappyPath)
+{
+    Matrix1d trainIn{};
+    Matrix2d trainOut{};
+    for (double input{0.0}; input <= 5.0; input += 0.25)
+    {
+        trainIn.pushBack(input);
+        trainOut.pushBack(cubic(input));
+    }
+    poly_reg::Fixed<3U> model{};
+
+    // Case 1 - Verify that the model is untrained and predicts 0 before training.
+    {
+        double coefficients[4U]{};
+        EXPECT_FALSE(model.isTrained());
+        EXPECT_EQ(0.0, model.predict(1.0));
+        EXPECT_FALSE(model.coefficients(coefficients));
+    }
+
+    // Case 2 - Train the model, expect the polynomial to be found.
+    {
+        EXPECT_TRUE(model.train(trainIn, trainOut));
+        EXPECT_TRUE(model.isTrained());
+
+        constexpr double precision{1e-9};
+        for (double input{-1.0}; input <= 6.0; input += 0.1)
+        {
+            EXPECT_NEAR(cubic(input), model.predict(input), precision);
+        }
+    }
+
+    // Case 3 - Verify the coefficients of the input itself and of a transformed input.
+    {
+        constexpr double precision{1e-9};
+        double coefficients[4U]{};
+        EXPECT_TRUE(model.coefficients(coefficients));
+        EXPECT_NEAR(1.0, coefficients[0U], precision);
+        EXPECT_NEAR(-2.0, coefficients[1U], precision);
+        EXPECT_NEAR(0.5, coefficients[2U], precision);
+        EXPECT_NEAR(0.25, coefficients[3U], precision);
+
+        // Express the polynomial in terms of u = x / 5, the ADC value divided by its max value.
+        EXPECT_TRUE(model.coefficients(coefficients, 5.0));
+        for (double fraction{0.0}; fraction <= 1.0; fraction += 0.125)
+        {
+            const double prediction{coefficients[0U] + fraction * (coefficients[1U] + 
+                                    fraction * (coefficients[2U] + fraction * coefficients[3U]))};
+            EXPECT_NEAR(cubic(5.0 * fraction), prediction, precision);
+        }
+    }
+
+    // Case 4 - Verify that a pre-trained model with the same coefficients predicts the same.
+    {
+        const poly_reg::Fixed<3U> preTrained{{1.0, -2.0, 0.5, 0.25}};
+        EXPECT_TRUE(preTrained.isTrained());
+        for (double input{-1.0}; input <= 6.0; input += 0.5)
+        {
+            EXPECT_NEAR(model.predict(input), preTrained.predict(input), 1e-9);
+        }
+    }
+}
+
+/**
+ * @brief Nonlinear sensor test.
+ * 
+ *        Verify that polynomial models fit a thermistor much better than a linear model and 
+ *        that the error decreases with the degree.
+ */
+TEST(PolyRegFixed, Thermistor)
+{
+    Matrix1d trainIn{};
+    Matrix2d trainOut{};
+    for (double voltage{0.5}; voltage <= 4.5; voltage += 0.1)
+    {
+        trainIn.pushBack(voltage);
+        trainOut.pushBack(thermistor(voltage));
+    }
+
+    // Compute the max error of each model over the training range.
+    auto maxError{[&trainIn, &trainOut](const lin_reg::Interface& model)
+    {
+        double result{};
+        for (std::size_t i{}; i < trainIn.size(); ++i)
+        {
+            const double error{std::fabs(trainOut[i] - model.predict(trainIn[i]))};
+            result = error > result ? error : result;
+        }
+        return result;
+    }};
+
+    lin_reg::Fixed linear{};
+    poly_reg::Fixed<3U> cubicModel{};
+    poly_reg::Fixed<5U> quinticModel{};
+    EXPECT_TRUE(linear.trainLeastSquares(trainIn, trainOut));
+    EXPECT_TRUE(cubicModel.train(trainIn, trainOut));
+    EXPECT_TRUE(quinticModel.train(trainIn, trainOut));
+
+    EXPECT_LT(10.0, maxError(linear));
+    EXPECT_GT(3.0, maxError(cubicModel));
+    EXPECT_GT(0.5, maxError(quinticModel));
+}
+
+/**
+ * @brief Polynomial model storage test.
+ * 
+ *        Verify that a stored model is restored with its coefficients and input normalization.
+ */
+TEST(PolyRegFixed, Storage)
+{
+    driver::eeprom::Stub<128U> eeprom{};
+    constexpr std::uint16_t address{0U};
+    const Matrix1d trainIn{0.0, 1.0, 2.0, 3.0, 4.0, 5.0};
+    const Matrix2d trainOut{cubic(0.0), cubic(1.0), cubic(2.0), cubic(3.0), cubic(4.0), 
+                            cubic(5.0)};
+
+    poly_reg::Fixed<3U> model{};
+    EXPECT_FALSE(lin_reg::storage::save(model, eeprom, address));
+    EXPECT_TRUE(model.train(trainIn, trainOut));
+    EXPECT_TRUE(lin_reg::storage::save(model, eeprom, address));
+
+    poly_reg::Fixed<3U> restored{};
+    EXPECT_TRUE(lin_reg::storage::load(restored, eeprom, address));
+    EXPECT_TRUE(restored.isTrained());
+    for (double input{0.0}; input <= 5.0; input += 0.5)
+    {
+        EXPECT_EQ(model.predict(input), restored.predict(input));
+    }
+
+    // Verify that a model of another degree rejects the record.
+    poly_reg::Fixed<2U> other{};
+    EXPECT_FALSE(lin_reg::storage::load(other, eeprom, address));
+}
+
+/**
+ * @brief Invalid polynomial training test.
+ * 
+ *        Verify that the model doesn't get trained without enough distinct input values.
+ */
+TEST(PolyRegFixed, Invalid)
+{
+    poly_reg::Fixed<2U> model{};
+
+    // Case 1 - Verify that at least Degree + 1 training sets are required.
+    EXPECT_FALSE(model.train(Matrix1d{}, Matrix2d{}));
+    EXPECT_FALSE(model.train(Matrix1d{1.0, 2.0}, Matrix2d{1.0, 4.0}));
+
+    // Case 2 - Verify that all inputs being equal is rejected.
+    EXPECT_FALSE(model.train(Matrix1d{1.0, 1.0, 1.0}, Matrix2d{1.0, 2.0, 3.0}));
+
+    // Case 3 - Verify that too few distinct inputs are rejected.
+    EXPECT_FALSE(model.train(Matrix1d{1.0, 2.0, 2.0, 1.0}, Matrix2d{1.0, 4.0, 4.0, 1.0}));
+    EXPECT_FALSE(model.isTrained());
+
+    // Case 4 - Verify that three distinct inputs suffice for a quadratic.
+    EXPECT_TRUE(model.train(Matrix1d{1.0, 2.0, 3.0}, Matrix2d{1.0, 4.0, 9.0}));
+    EXPECT_NEAR(16.0, model.predict(4.0), 1e-9);
+}
+} // namespace
+} // namespace ml
+
+#endif /** TESTSUITE */
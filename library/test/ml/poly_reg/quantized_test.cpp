@@ -0,0 +1,127 @@
+/**
+ * @brief Unit tests for the quantized polynomial regression model.
+ */
+#include <cmath>
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+#include "ml/poly_reg/fixed.h"
+#include "ml/poly_reg/quantized.h"
+#include "ml/types.h"
+#include "utils/utils.h"
+
+#ifdef TESTSUITE
+
+namespace ml
+{
+namespace
+{
+/** Max value of a 10-bit ADC. */
+constexpr std::uint16_t AdcMax{1023U};
+
+/** ADC supply voltage in Volts. */
+constexpr double SupplyVoltage{5.0};
+
+// -----------------------------------------------------------------------------
+double toVoltage(const std::uint16_t adcValue) noexcept
+{
+    return static_cast<double>(adcValue) / AdcMax * SupplyVoltage;
+}
+
+/**
+ * @brief Quantization happy path test.
+ * 
+ *        Verify that the quantized model predicts as the floating-point model over the entire 
+ *        ADC range, with the reported max error.
+ */
+TEST(PolyRegQuantized, HappyPath)
+{
+    // Create a model predicting T = -40 + 30 * Uin - 4 * Uin^2 + 0.5 * Uin^3.
+    const poly_reg::Fixed<3U> model{{-40.0, 30.0, -4.0, 0.5}};
+    poly_reg::Quantized<3U> quantized{};
+    double maxError{};
+
+    // Expect the quantized model to be untrained and predict 0 before quantization.
+    EXPECT_FALSE(quantized.isTrained());
+    EXPECT_EQ(0, quantized.predict(AdcMax));
+
+    // Quantize the model, expect a max error well below one degree.
+    EXPECT_TRUE(quantized.quantize(model, AdcMax, SupplyVoltage, maxError));
+    EXPECT_TRUE(quantized.isTrained());
+    EXPECT_GT(0.01, maxError);
+
+    // Verify that each prediction is within the max error plus rounding.
+    for (std::uint16_t adcValue{}; adcValue <= AdcMax; ++adcValue)
+    {
+        const double expected{model.predict(toVoltage(adcValue))};
+        EXPECT_NEAR(expected, quantized.predict(adcValue), 0.5 + maxError);
+        EXPECT_NEAR(utils::round<std::int16_t>(expected), quantized.predict(adcValue), 1);
+    }
+
+    // Verify that ADC values above the max value are saturated.
+    EXPECT_EQ(quantized.predict(AdcMax), quantized.predict(AdcMax + 1U));
+    EXPECT_EQ(quantized.predict(AdcMax), quantized.predict(UINT16_MAX));
+}
+
+/**
+ * @brief Quantization of a trained model test.
+ * 
+ *        Verify that a model trained with normalized inputs is quantized correctly.
+ */
+TEST(PolyRegQuantized, TrainedModel)
+{
+    Matrix1d trainIn{};
+    Matrix2d trainOut{};
+    for (double voltage{0.5}; voltage <= 4.5; voltage += 0.25)
+    {
+        trainIn.pushBack(voltage);
+        trainOut.pushBack(25.0 + 20.0 * std::sin(voltage - 2.5));
+    }
+    poly_reg::Fixed<4U> model{};
+    poly_reg::Quantized<4U, 20U> quantized{};
+    double maxError{};
+
+    EXPECT_TRUE(model.train(trainIn, trainOut));
+    EXPECT_TRUE(quantized.quantize(model, AdcMax, SupplyVoltage, maxError));
+    EXPECT_GT(0.01, maxError);
+
+    for (std::uint16_t adcValue{}; adcValue <= AdcMax; ++adcValue)
+    {
+        const double expected{model.predict(toVoltage(adcValue))};
+        EXPECT_NEAR(expected, quantized.predict(adcValue), 0.5 + maxError);
+    }
+}
+
+/**
+ * @brief Invalid quantization test.
+ * 
+ *        Verify that quantization fails if the model is untrained, if the parameters are
+ *        invalid or if the predictions don't fit in the fixed-point format.
+ */
+TEST(PolyRegQuantized, Invalid)
+{
+    poly_reg::Quantized<2U> quantized{};
+    double maxError{};
+
+    // Case 1 - Verify that untrained models and invalid parameters are rejected.
+    {
+        const poly_reg::Fixed<2U> untrained{};
+        const poly_reg::Fixed<2U> model{{1.0, 2.0, 3.0}};
+        EXPECT_FALSE(quantized.quantize(untrained, AdcMax, SupplyVoltage, maxError));
+        EXPECT_FALSE(quantized.quantize(model, 0U, SupplyVoltage, maxError));
+        EXPECT_FALSE(quantized.quantize(model, AdcMax, 0.0, maxError));
+        EXPECT_FALSE(quantized.isTrained());
+    }
+
+    // Case 2 - Verify that predictions outside the 16-bit range are rejected.
+    {
+        const poly_reg::Fixed<2U> model{{0.0, 0.0, 2000.0}};
+        EXPECT_FALSE(quantized.quantize(model, AdcMax, SupplyVoltage, maxError));
+        EXPECT_FALSE(quantized.isTrained());
+    }
+}
+} // namespace
+} // namespace ml
+
+#endif /** TESTSUITE */